@@ -36,14 +36,23 @@
 #include "Events/EventStandard.hpp"
 #include "Events/EventTime.hpp"
 #include "Events/IEvent.hpp"
+#include "Files/Binary/BinaryNode.hpp"
+#include "Files/Binary/FileBinary.hpp"
+#include "Files/Csv/CsvReader.hpp"
+#include "Files/Csv/CsvWriter.hpp"
 #include "Files/Csv/FileCsv.hpp"
 #include "Files/Csv/RowCsv.hpp"
+#include "Files/FileBuffer.hpp"
 #include "Files/Files.hpp"
 #include "Files/IFile.hpp"
 #include "Files/Json/FileJson.hpp"
+#include "Files/Json/JsonParser.hpp"
 #include "Files/Json/JsonSection.hpp"
+#include "Files/Pack/FilePack.hpp"
+#include "Files/Pack/Lz4.hpp"
 #include "Files/Xml/FileXml.hpp"
 #include "Files/Xml/XmlNode.hpp"
+#include "Files/Xml/XmlReader.hpp"
 #include "Fonts/FontCharacter.hpp"
 #include "Fonts/FontLine.hpp"
 #include "Fonts/FontMetafile.hpp"
@@ -56,6 +65,7 @@
 //#include "Helpers/dirent.h"
 #include "Helpers/FileSystem.hpp"
 #include "Helpers/String.hpp"
+#include "Helpers/TypeInfo.hpp"
 #include "Inputs/AxisButton.hpp"
 #include "Inputs/AxisCompound.hpp"
 #include "Inputs/AxisJoystick.hpp"
@@ -124,11 +134,13 @@
 #include "Network/Tcp/TcpSocket.hpp"
 #include "Network/Udp/UdpSocket.hpp"
 #include "Noise/Noise.hpp"
+#include "Objects/ComponentIndex.hpp"
 #include "Objects/ComponentRegister.hpp"
 #include "Objects/GameObject.hpp"
 #include "Objects/IComponent.hpp"
 #include "Objects/Prefabs/PrefabObject.hpp"
 #include "Particles/Particle.hpp"
+#include "Particles/ParticlePool.hpp"
 #include "Particles/Particles.hpp"
 #include "Particles/ParticleSystem.hpp"
 #include "Particles/ParticleType.hpp"
@@ -179,6 +191,8 @@
 #include "Renderer/Buffers/UniformBuffer.hpp"
 #include "Renderer/Buffers/VertexBuffer.hpp"
 #include "Renderer/Commands/CommandBuffer.hpp"
+#include "Renderer/Commands/FrameContext.hpp"
+#include "Renderer/Commands/UploadQueue.hpp"
 #include "Renderer/Descriptors/DescriptorSet.hpp"
 #include "Renderer/Descriptors/IDescriptor.hpp"
 #include "Renderer/Handlers/DescriptorsHandler.hpp"
@@ -187,6 +201,8 @@
 #include "Renderer/Handlers/UniformHandler.hpp"
 #include "Renderer/IManagerRender.hpp"
 #include "Renderer/IRenderer.hpp"
+#include "Renderer/Memory/MemoryAllocator.hpp"
+#include "Renderer/Memory/MemoryBlock.hpp"
 #include "Renderer/Pipelines/Compute.hpp"
 #include "Renderer/Pipelines/IPipeline.hpp"
 #include "Renderer/Pipelines/Pipeline.hpp"
@@ -202,12 +218,14 @@
 #include "Renderer/Swapchain/Swapchain.hpp"
 #include "Resources/IResource.hpp"
 #include "Resources/Resources.hpp"
+#include "Scenes/AabbTree.hpp"
 #include "Scenes/ICamera.hpp"
 #include "Scenes/IScene.hpp"
 #include "Scenes/ISpatialStructure.hpp"
 #include "Scenes/ScenePhysics.hpp"
 #include "Scenes/Scenes.hpp"
 #include "Scenes/SceneStructure.hpp"
+#include "Scenes/SceneTree.hpp"
 #include "Serialized/Metadata.hpp"
 #include "Serialized/Serialize.hpp"
 #include "Shadows/RendererShadows.hpp"
@@ -219,8 +237,10 @@
 //#include "Textures/stb_image.h"
 //#include "Textures/stb_image_write.h"
 #include "Textures/Texture.hpp"
+#include "Threads/Job.hpp"
 #include "Threads/Thread.hpp"
 #include "Threads/ThreadPool.hpp"
+#include "Threads/WorkStealingDeque.hpp"
 #include "Uis/UiBound.hpp"
 #include "Uis/UiInputButton.hpp"
 #include "Uis/UiInputDelay.hpp"
@@ -32,12 +32,13 @@ namespace acid
 	std::vector<Time> AnimationLoader::GetKeyTimes()
 	{
 		auto timeData = m_libraryAnimations->FindChild("animation")->FindChild("source")->FindChild("float_array");
-		auto rawTimes = String::Split(timeData->GetValue(), " ");
+		std::vector<float> rawTimes;
+		String::ParseFloats(timeData->GetValue(), rawTimes);
 		auto times = std::vector<Time>(rawTimes.size());
 
 		for (uint32_t i = 0; i < times.size(); i++)
 		{
-			times[i] = Time::Seconds(String::From<float>(rawTimes[i]));
+			times[i] = Time::Seconds(rawTimes[i]);
 		}
 
 		return times;
@@ -58,9 +59,9 @@ namespace acid
 
 		auto transformData = jointData->FindChildWithAttribute("source", "id", dataId);
 
-		std::string data = transformData->FindChild("float_array")->GetValue();
-		auto splitData = String::Split(data, " ");
-		ProcessTransforms(jointNameId, splitData, jointNameId == rootNodeId);
+		std::vector<float> data;
+		String::ParseFloats(transformData->FindChild("float_array")->GetValue(), data);
+		ProcessTransforms(jointNameId, data, jointNameId == rootNodeId);
 	}
 
 	std::string AnimationLoader::GetDataId(Metadata *jointData)
@@ -77,15 +78,15 @@ namespace acid
 		return splitData[0];
 	}
 
-	void AnimationLoader::ProcessTransforms(const std::string &jointName, const std::vector<std::string> &rawData, const bool &root)
+	void AnimationLoader::ProcessTransforms(const std::string &jointName, const std::vector<float> &rawData, const bool &root)
 	{
-		for (uint32_t i = 0; i < m_keyframeData.size(); i++)
+		for (uint32_t i = 0; i < m_keyframeData.size() && (i + 1) * 16 <= rawData.size(); i++)
 		{
 			Matrix4 transform = Matrix4();
 
 			for (uint32_t j = 0; j < 16; j++)
 			{
-				transform.m_linear[j] = String::From<float>(rawData[i * 16 + j]);
+				transform.m_linear[j] = rawData[i * 16 + j];
 			}
 
 			transform = transform.Transpose();
@@ -31,6 +31,6 @@ namespace acid
 
 		std::string GetJointName(Metadata *jointData);
 
-		void ProcessTransforms(const std::string &jointName, const std::vector<std::string> &rawData, const bool &root);
+		void ProcessTransforms(const std::string &jointName, const std::vector<float> &rawData, const bool &root);
 	};
 }
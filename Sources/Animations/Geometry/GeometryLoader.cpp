@@ -1,5 +1,6 @@
 #include "GeometryLoader.hpp"
 
+#include <algorithm>
 #include "Animations/MeshAnimated.hpp"
 
 namespace acid
@@ -39,11 +40,14 @@ namespace acid
 		std::string positionsSource = m_meshData->FindChild("vertices")->FindChild("input")->FindAttribute("source").substr(1);
 		auto positionsData = m_meshData->FindChildWithAttribute("source", "id", positionsSource)->FindChild("float_array");
 		uint32_t positionsCount = String::From<uint32_t>(positionsData->FindAttribute("count"));
-		auto positionsRawData = String::Split(positionsData->GetValue(), " ");
+		std::vector<float> positionsRawData;
+		positionsRawData.reserve(positionsCount);
+		String::ParseFloats(positionsData->GetValue(), positionsRawData);
+		positionsCount = std::min(positionsCount, static_cast<uint32_t>(positionsRawData.size()));
 
 		for (uint32_t i = 0; i < positionsCount / 3; i++)
 		{
-			Vector4 position = Vector4(String::From<float>(positionsRawData[i * 3]), String::From<float>(positionsRawData[i * 3 + 1]), String::From<float>(positionsRawData[i * 3 + 2]), 1.0f);
+			Vector4 position = Vector4(positionsRawData[i * 3], positionsRawData[i * 3 + 1], positionsRawData[i * 3 + 2], 1.0f);
 			position = MeshAnimated::CORRECTION.Transform(position);
 			VertexAnimatedData *newVertex = new VertexAnimatedData(static_cast<int32_t>(m_positionsList.size()), position);
 			newVertex->SetSkinData(m_vertexWeights[m_positionsList.size()]);
@@ -56,11 +60,14 @@ namespace acid
 		std::string uvsSource = m_meshData->FindChild("polylist")->FindChildWithAttribute("input", "semantic", "TEXCOORD")->FindAttribute("source").substr(1);
 		auto uvsData = m_meshData->FindChildWithAttribute("source", "id", uvsSource)->FindChild("float_array");
 		uint32_t uvsCount = String::From<uint32_t>(uvsData->FindAttribute("count"));
-		auto uvsRawData = String::Split(uvsData->GetValue(), " ");
+		std::vector<float> uvsRawData;
+		uvsRawData.reserve(uvsCount);
+		String::ParseFloats(uvsData->GetValue(), uvsRawData);
+		uvsCount = std::min(uvsCount, static_cast<uint32_t>(uvsRawData.size()));
 
 		for (uint32_t i = 0; i < uvsCount / 2; i++)
 		{
-			Vector2 uv = Vector2(String::From<float>(uvsRawData[i * 2]), 1.0f - String::From<float>(uvsRawData[i * 2 + 1]));
+			Vector2 uv = Vector2(uvsRawData[i * 2], 1.0f - uvsRawData[i * 2 + 1]);
 			m_uvsList.emplace_back(uv);
 		}
 	}
@@ -70,11 +77,14 @@ namespace acid
 		std::string normalsSource = m_meshData->FindChild("polylist")->FindChildWithAttribute("input", "semantic", "NORMAL")->FindAttribute("source").substr(1);
 		auto normalsData = m_meshData->FindChildWithAttribute("source", "id", normalsSource)->FindChild("float_array");
 		uint32_t normalsCount = String::From<uint32_t>(normalsData->FindAttribute("count"));
-		auto normalsRawData = String::Split(normalsData->GetValue(), " ");
+		std::vector<float> normalsRawData;
+		normalsRawData.reserve(normalsCount);
+		String::ParseFloats(normalsData->GetValue(), normalsRawData);
+		normalsCount = std::min(normalsCount, static_cast<uint32_t>(normalsRawData.size()));
 
 		for (uint32_t i = 0; i < normalsCount / 3; i++)
 		{
-			Vector4 normal = Vector4(String::From<float>(normalsRawData[i * 3]), String::From<float>(normalsRawData[i * 3 + 1]), String::From<float>(normalsRawData[i * 3 + 2]), 0.0f);
+			Vector4 normal = Vector4(normalsRawData[i * 3], normalsRawData[i * 3 + 1], normalsRawData[i * 3 + 2], 0.0f);
 			normal = MeshAnimated::CORRECTION.Transform(normal);
 			m_normalsList.emplace_back(normal);
 		}
@@ -83,13 +93,14 @@ namespace acid
 	void GeometryLoader::AssembleVertices()
 	{
 		int32_t indexCount = static_cast<int32_t>(m_meshData->FindChild("polylist")->FindChildren("input").size());
-		auto indexRawData = String::Split(m_meshData->FindChild("polylist")->FindChild("p")->GetValue(), " ");
+		std::vector<int32_t> indexRawData;
+		String::ParseIntegers(m_meshData->FindChild("polylist")->FindChild("p")->GetValue(), indexRawData);
 
 		for (uint32_t i = 0; i < indexRawData.size() / indexCount; i++)
 		{
-			int32_t positionIndex = String::From<int32_t>(indexRawData[i * indexCount]);
-			int32_t normalIndex = String::From<int32_t>(indexRawData[i * indexCount + 1]);
-			int32_t uvIndex = String::From<int32_t>(indexRawData[i * indexCount + 2]);
+			int32_t positionIndex = indexRawData[i * indexCount];
+			int32_t normalIndex = indexRawData[i * indexCount + 1];
+			int32_t uvIndex = indexRawData[i * indexCount + 2];
 			ProcessVertex(positionIndex, normalIndex, uvIndex);
 		}
 	}
@@ -31,13 +31,14 @@ namespace acid
 	{
 		std::string nameId = jointNode->FindAttribute("id");
 		auto index = GetBoneIndex(nameId);
-		auto matrixData = String::Split(jointNode->FindChild("matrix")->GetValue(), " ");
+		std::vector<float> matrixData;
+		String::ParseFloats(jointNode->FindChild("matrix")->GetValue(), matrixData);
 
 		Matrix4 transform = Matrix4();
 
-		for (uint32_t i = 0; i < matrixData.size(); i++)
+		for (uint32_t i = 0; i < matrixData.size() && i < 16; i++)
 		{
-			transform.m_linear[i] = String::From<float>(matrixData[i]);
+			transform.m_linear[i] = matrixData[i];
 		}
 
 		transform = transform.Transpose();
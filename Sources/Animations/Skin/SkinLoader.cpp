@@ -29,43 +29,32 @@ namespace acid
 		std::string weightsDataId = inputNode->FindChildWithAttribute("input", "semantic", "WEIGHT")->FindAttribute("source").substr(1);
 		auto weightsNode = m_skinData->FindChildWithAttribute("source", "id", weightsDataId)->FindChild("float_array");
 
-		auto rawData = String::Split(weightsNode->GetValue(), " ");
-		auto weights = std::vector<float>(rawData.size());
-
-		for (uint32_t i = 0; i < weights.size(); i++)
-		{
-			weights[i] = String::From<float>(rawData[i]);
-		}
-
+		std::vector<float> weights;
+		String::ParseFloats(weightsNode->GetValue(), weights);
 		return weights;
 	}
 
 	std::vector<uint32_t> SkinLoader::GetEffectiveJointsCounts(Metadata *weightsDataNode)
 	{
-		auto rawData = String::Split(weightsDataNode->FindChild("vcount")->GetString(), " ");
-		auto counts = std::vector<uint32_t>(rawData.size());
-
-		for (uint32_t i = 0; i < rawData.size(); i++)
-		{
-			counts[i] = String::From<uint32_t>(rawData[i]);
-		}
-
-		return counts;
+		std::vector<int32_t> rawData;
+		String::ParseIntegers(weightsDataNode->FindChild("vcount")->GetValue(), rawData);
+		return std::vector<uint32_t>(rawData.begin(), rawData.end());
 	}
 
 	void SkinLoader::GetSkinData(Metadata *weightsDataNode, const std::vector<uint32_t> &counts, const std::vector<float> &weights)
 	{
-		auto rawData = String::Split(weightsDataNode->FindChild("v")->GetString(), " ");
+		std::vector<int32_t> rawData;
+		String::ParseIntegers(weightsDataNode->FindChild("v")->GetValue(), rawData);
 		uint32_t pointer = 0;
 
 		for (auto count : counts)
 		{
 			auto skinData = VertexSkinData();
 
-			for (uint32_t i = 0; i < count; i++)
+			for (uint32_t i = 0; i < count && pointer + 1 < rawData.size(); i++)
 			{
-				uint32_t jointId = String::From<uint32_t>(rawData[pointer++]);
-				uint32_t weightId = String::From<uint32_t>(rawData[pointer++]);
+				auto jointId = static_cast<uint32_t>(rawData[pointer++]);
+				auto weightId = static_cast<uint32_t>(rawData[pointer++]);
 				skinData.AddJointEffect(jointId, weights[weightId]);
 			}
 
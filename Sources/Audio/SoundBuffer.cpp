@@ -128,9 +128,9 @@ namespace acid
 
 	uint32_t SoundBuffer::LoadBufferOgg(const std::string &filename)
 	{
-		auto fileLoaded = Files::Read(filename);
+		auto fileLoaded = Files::ReadBuffer(filename);
 
-		if (!fileLoaded)
+		if (fileLoaded == nullptr)
 		{
 			Log::Error("OGG file could not be loaded: '%s'\n", filename.c_str());
 			return 0;
@@ -139,7 +139,7 @@ namespace acid
 		int32_t channels;
 		int32_t samplesPerSec;
 		short *data;
-		int32_t size = stb_vorbis_decode_memory((uint8_t*)fileLoaded->data(), (uint32_t)fileLoaded->size(), &channels, &samplesPerSec, &data);
+		int32_t size = stb_vorbis_decode_memory((uint8_t*)fileLoaded->GetData(), (uint32_t)fileLoaded->GetSize(), &channels, &samplesPerSec, &data);
 
 		if (size == -1)
 		{
@@ -7,6 +7,8 @@
 #include <GLFW/glfw3.h>
 #include <SPIRV/GlslangToSpv.h>
 #include "Files/Files.hpp"
+#include "Renderer/Commands/UploadQueue.hpp"
+#include "Renderer/Memory/MemoryAllocator.hpp"
 #include "Textures/Texture.hpp"
 
 namespace acid
@@ -24,6 +26,8 @@ namespace acid
 		VK_KHR_SWAPCHAIN_EXTENSION_NAME
 	};
 
+	bool Display::HEADLESS_REQUESTED = false;
+
 	void CallbackError(int32_t error, const char *description)
 	{
 		Display::CheckGlfw(error);
@@ -117,6 +121,7 @@ namespace acid
 	}
 
 	Display::Display() :
+		m_headless(HEADLESS_REQUESTED),
 		m_windowWidth(1080),
 		m_windowHeight(720),
 		m_fullscreenWidth(0),
@@ -159,9 +164,15 @@ namespace acid
 		m_graphicsQueue(VK_NULL_HANDLE),
 		m_presentQueue(VK_NULL_HANDLE),
 		m_computeQueue(VK_NULL_HANDLE),
-		m_transferQueue(VK_NULL_HANDLE)
+		m_transferQueue(VK_NULL_HANDLE),
+		m_memoryAllocator(nullptr),
+		m_uploadQueue(nullptr)
 	{
-		CreateGlfw();
+		if (!m_headless)
+		{
+			CreateGlfw();
+		}
+
 		SetupLayers();
 		SetupExtensions();
 		CreateInstance();
@@ -171,6 +182,9 @@ namespace acid
 		CreateQueueIndices();
 		CreateLogicalDevice();
 
+		m_memoryAllocator = std::make_unique<MemoryAllocator>(m_physicalDevice, m_logicalDevice);
+		m_uploadQueue = std::make_unique<UploadQueue>(m_physicalDevice, m_logicalDevice, m_memoryAllocator.get(), m_graphicsQueue, m_graphicsFamily, m_queueMutex);
+
 		glslang::InitializeProcess();
 	}
 
@@ -181,23 +195,37 @@ namespace acid
 		// Waits for the device to finish before destroying.
 		Display::CheckVk(vkDeviceWaitIdle(m_logicalDevice));
 
-		// Free the window callbacks and destroy the window.
-		glfwDestroyWindow(m_window);
+		m_uploadQueue.reset();
+		m_memoryAllocator.reset();
 
 		// Destroys Vulkan.
 		vkDestroyDevice(m_logicalDevice, nullptr);
 		FvkDestroyDebugReportCallbackEXT(m_instance, m_debugReportCallback, nullptr);
-		vkDestroySurfaceKHR(m_instance, m_surface, nullptr);
+
+		if (!m_headless)
+		{
+			vkDestroySurfaceKHR(m_instance, m_surface, nullptr);
+		}
+
 		vkDestroyInstance(m_instance, nullptr);
 
-		// Terminate GLFW.
-		glfwTerminate();
+		if (!m_headless)
+		{
+			// Free the window callbacks, destroy the window, and terminate GLFW.
+			glfwDestroyWindow(m_window);
+			glfwTerminate();
+		}
 
 		m_closed = true;
 	}
 
 	void Display::Update()
 	{
+		if (m_headless)
+		{
+			return;
+		}
+
 		// Polls for window events.
 		glfwPollEvents();
 	}
@@ -224,19 +252,33 @@ namespace acid
 		m_windowWidth = width;
 		m_windowHeight = height;
 		m_aspectRatio = static_cast<float>(width) / static_cast<float>(height);
-		glfwSetWindowSize(m_window, width, height);
+
+		// A headless display is resized by the renderer recreating its offscreen images at the new size.
+		if (!m_headless)
+		{
+			glfwSetWindowSize(m_window, width, height);
+		}
 	}
 
 	void Display::SetTitle(const std::string &title)
 	{
 		m_title = title;
-		glfwSetWindowTitle(m_window, m_title.c_str());
+
+		if (!m_headless)
+		{
+			glfwSetWindowTitle(m_window, m_title.c_str());
+		}
 	}
 
 	void Display::SetIcon(const std::string &filename)
 	{
 		m_iconPath = filename;
 
+		if (m_headless)
+		{
+			return;
+		}
+
 		uint32_t width = 0;
 		uint32_t height = 0;
 		uint32_t components = 0;
@@ -258,7 +300,7 @@ namespace acid
 
 	void Display::SetFullscreen(const bool &fullscreen)
 	{
-		if (m_fullscreen == fullscreen)
+		if (m_fullscreen == fullscreen || m_headless)
 		{
 			return;
 		}
@@ -522,21 +564,28 @@ namespace acid
 			}
 		}
 
-		for (auto &layerName : DEVICE_EXTENSIONS)
+		// Without a surface nothing is presented, so devices without the swapchain extension can be used.
+		if (!m_headless)
 		{
-			m_deviceExtensionList.emplace_back(layerName);
+			for (auto &layerName : DEVICE_EXTENSIONS)
+			{
+				m_deviceExtensionList.emplace_back(layerName);
+			}
 		}
 	}
 
 	void Display::SetupExtensions()
 	{
-		// Sets up the extensions.
-		uint32_t glfwExtensionCount = 0;
-		const char **glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
-
-		for (uint32_t i = 0; i < glfwExtensionCount; i++)
+		// Sets up the extensions, a headless display needs none for a surface.
+		if (!m_headless)
 		{
-			m_instanceExtensionList.emplace_back(glfwExtensions[i]);
+			uint32_t glfwExtensionCount = 0;
+			const char **glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+
+			for (uint32_t i = 0; i < glfwExtensionCount; i++)
+			{
+				m_instanceExtensionList.emplace_back(glfwExtensions[i]);
+			}
 		}
 
 		for (auto &instanceExtension : INSTANCE_EXTENSIONS)
@@ -643,7 +692,7 @@ namespace acid
 		vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionPropertyCount, extensionProperties.data());
 
 		// Iterates through all extensions requested.
-		for (const char *currentExtension : DEVICE_EXTENSIONS)
+		for (const char *currentExtension : m_deviceExtensionList)
 		{
 			bool extensionFound = false;
 
@@ -730,6 +779,14 @@ namespace acid
 
 	void Display::CreateSurface()
 	{
+		// Offscreen images use the format a surface would most likely have.
+		if (m_headless)
+		{
+			m_surfaceFormat.format = VK_FORMAT_B8G8R8A8_UNORM;
+			m_surfaceFormat.colorSpace = VK_COLORSPACE_SRGB_NONLINEAR_KHR;
+			return;
+		}
+
 		// Creates the WSI Vulkan surface.
 		CheckVk(glfwCreateWindowSurface(m_instance, m_window, nullptr, &m_surface));
 
@@ -771,9 +828,17 @@ namespace acid
 				m_supportedQueues |= VK_QUEUE_GRAPHICS_BIT;
 			}
 
-			// Check for presentation support.
+			// Check for presentation support, without a surface the graphics queue stands in.
 			VkBool32 presentSupport = VK_FALSE;
-			vkGetPhysicalDeviceSurfaceSupportKHR(m_physicalDevice, i, m_surface, &presentSupport);
+
+			if (m_headless)
+			{
+				presentSupport = (deviceQueueFamilyProperties[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) != 0;
+			}
+			else
+			{
+				vkGetPhysicalDeviceSurfaceSupportKHR(m_physicalDevice, i, m_surface, &presentSupport);
+			}
 
 			if (deviceQueueFamilyProperties[i].queueCount > 0 && presentSupport)
 			{
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <mutex>
 #include <string>
 #include <vector>
 #include <vulkan/vulkan.h>
@@ -10,6 +11,9 @@ struct GLFWmonitor;
 
 namespace acid
 {
+	class MemoryAllocator;
+	class UploadQueue;
+
 	/// <summary>
 	/// A module used for the creation, updating and destruction of the display.
 	/// </summary>
@@ -17,6 +21,10 @@ namespace acid
 		public IModule
 	{
 	private:
+		static bool HEADLESS_REQUESTED;
+
+		bool m_headless;
+
 		uint32_t m_windowWidth;
 		uint32_t m_windowHeight;
 		uint32_t m_fullscreenWidth;
@@ -67,6 +75,10 @@ namespace acid
 		VkQueue m_presentQueue;
 		VkQueue m_computeQueue;
 		VkQueue m_transferQueue;
+		std::mutex m_queueMutex;
+
+		std::unique_ptr<MemoryAllocator> m_memoryAllocator;
+		std::unique_ptr<UploadQueue> m_uploadQueue;
 
 		friend void CallbackError(int32_t error, const char *description);
 
@@ -97,6 +109,13 @@ namespace acid
 		/// <returns> The current module instance. </returns>
 		static Display *Get() { return Engine::Get()->GetModule<Display>(); }
 
+		/// <summary>
+		/// Requests the display is created without a window or surface, this must be called before the engine is created.
+		/// A headless display renders into offscreen images, so it runs without a window system, and without a GPU using a software driver such as lavapipe.
+		/// </summary>
+		/// <param name="headless"> If the display will be headless. </param>
+		static void RequestHeadless(const bool &headless) { HEADLESS_REQUESTED = headless; }
+
 		Display();
 
 		~Display();
@@ -240,6 +259,12 @@ namespace acid
 		/// <returns> If the window is minimized. </returns>
 		bool IsIconified() const { return m_iconified; }
 
+		/// <summary>
+		/// Gets if the display has no window or surface, and renders offscreen.
+		/// </summary>
+		/// <returns> If the display is headless. </returns>
+		bool IsHeadless() const { return m_headless; }
+
 		ACID_HIDDEN GLFWwindow *GetWindow() const { return m_window; }
 
 		VkInstance GetInstance() const { return m_instance; }
@@ -277,6 +302,24 @@ namespace acid
 		uint32_t GetComputeFamily() const { return m_computeFamily; }
 
 		uint32_t GetTransferFamily() const { return m_transferFamily; }
+
+		/// <summary>
+		/// Gets the mutex held around every submission and present, queues must not be used from two threads at once.
+		/// </summary>
+		/// <returns> The queue mutex. </returns>
+		std::mutex &GetQueueMutex() { return m_queueMutex; }
+
+		/// <summary>
+		/// Gets the allocator all buffer and image memory is taken from.
+		/// </summary>
+		/// <returns> The memory allocator. </returns>
+		MemoryAllocator *GetMemoryAllocator() const { return m_memoryAllocator.get(); }
+
+		/// <summary>
+		/// Gets the queue buffer and image data is uploaded through.
+		/// </summary>
+		/// <returns> The upload queue. </returns>
+		UploadQueue *GetUploadQueue() const { return m_uploadQueue.get(); }
 	private:
 		void CreateGlfw();
 
@@ -7,6 +7,7 @@ namespace acid
 
 	Engine::Engine(const bool &emptyRegister) :
 		m_timeOffset(Time::ZERO),
+		m_threadPool(std::max(ThreadPool::HARDWARE_CONCURRENCY, 2u) - 1),
 		m_moduleRegister(ModuleRegister()),
 		m_moduleUpdater(ModuleUpdater()),
 		m_fpsLimit(-1.0f),
@@ -6,6 +6,7 @@
 #include "Maths/Time.hpp"
 #include "ModuleRegister.hpp"
 #include "ModuleUpdater.hpp"
+#include "Threads/ThreadPool.hpp"
 
 /// <summary>
 /// The base Acid namespace.
@@ -26,6 +27,7 @@ namespace acid
 
 		Time m_timeOffset;
 
+		ThreadPool m_threadPool;
 		ModuleRegister m_moduleRegister;
 		ModuleUpdater m_moduleUpdater;
 
@@ -80,6 +82,14 @@ namespace acid
 		template<typename T>
 		T *RegisterModule(const ModuleUpdate &update) { return m_moduleRegister.RegisterModule<T>(update); }
 
+		/// <summary>
+		/// Declares what a module accesses during its update, allowing it to update in parallel with other modules in its stage.
+		/// </summary>
+		/// <param name="module"> The module to declare dependencies for. </param>
+		/// <param name="reads"> The modules that are read from during the update. </param>
+		/// <param name="writes"> The modules that are written into during the update. </param>
+		void SetModuleDependencies(IModule *module, const std::vector<IModule *> &reads = {}, const std::vector<IModule *> &writes = {}) { m_moduleRegister.SetDependencies(module, reads, writes); }
+
 		/// <summary>
 		/// Deregisters a module.
 		/// </summary>
@@ -95,6 +105,12 @@ namespace acid
 		template<typename T>
 		bool DeregisterModule() { return m_moduleRegister.DeregisterModule<T>(); }
 
+		/// <summary>
+		/// Gets the engines job system, the calling thread is left out of the worker count as it helps while waiting on jobs.
+		/// </summary>
+		/// <returns> The thread pool. </returns>
+		ThreadPool *GetThreadPool() { return &m_threadPool; }
+
 		/// <summary>
 		/// Gets the added/removed time for the engine.
 		/// </summary>
@@ -22,6 +22,8 @@ namespace acid
 	class ACID_EXPORT IModule
 	{
 	public:
+		virtual ~IModule() = default;
+
 		/// <summary>
 		/// The update function for the module.
 		/// </summary>
@@ -1,5 +1,7 @@
 #include "ModuleRegister.hpp"
 
+#include <algorithm>
+#include "Engine.hpp"
 #include "Log.hpp"
 #include "Audio/Audio.hpp"
 #include "Display/Display.hpp"
@@ -18,7 +20,9 @@
 namespace acid
 {
 	ModuleRegister::ModuleRegister() :
-		m_modules(std::map<float, std::unique_ptr<IModule>>())
+		m_modules(std::map<float, std::unique_ptr<IModule>>()),
+		m_moduleTypes(std::unordered_map<TypeId, IModule *>()),
+		m_dependencies(std::map<IModule *, ModuleDependencies>())
 	{
 	}
 
@@ -26,17 +30,27 @@ namespace acid
 	{
 		RegisterModule<Display>(MODULE_UPDATE_POST);
 		RegisterModule<Joysticks>(MODULE_UPDATE_PRE);
-		RegisterModule<Keyboard>(MODULE_UPDATE_PRE);
-		RegisterModule<Mouse>(MODULE_UPDATE_PRE);
-		RegisterModule<Audio>(MODULE_UPDATE_PRE);
-		RegisterModule<Files>(MODULE_UPDATE_PRE);
+		auto keyboard = RegisterModule<Keyboard>(MODULE_UPDATE_PRE);
+		auto mouse = RegisterModule<Mouse>(MODULE_UPDATE_PRE);
+		auto audio = RegisterModule<Audio>(MODULE_UPDATE_PRE);
+		auto files = RegisterModule<Files>(MODULE_UPDATE_PRE);
 		RegisterModule<Scenes>(MODULE_UPDATE_NORMAL);
 		RegisterModule<Renderer>(MODULE_UPDATE_RENDER);
-		RegisterModule<Resources>(MODULE_UPDATE_PRE);
+		auto resources = RegisterModule<Resources>(MODULE_UPDATE_PRE);
 		RegisterModule<Events>(MODULE_UPDATE_ALWAYS);
 		RegisterModule<Uis>(MODULE_UPDATE_PRE);
-		RegisterModule<Particles>(MODULE_UPDATE_NORMAL);
-		RegisterModule<Shadows>(MODULE_UPDATE_NORMAL);
+		auto particles = RegisterModule<Particles>(MODULE_UPDATE_NORMAL);
+		auto shadows = RegisterModule<Shadows>(MODULE_UPDATE_NORMAL);
+
+		// Joysticks polls GLFW, which must happen on the main thread, and Scenes and Uis run user code that may play sounds or hide the cursor, so they are left as barriers.
+		// A barrier finishes before any later module of its stage starts, so Particles and Shadows already see the updated scene and only read it.
+		SetDependencies(keyboard);
+		SetDependencies(mouse);
+		SetDependencies(audio);
+		SetDependencies(files);
+		SetDependencies(resources);
+		SetDependencies(particles);
+		SetDependencies(shadows);
 	}
 
 	IModule *ModuleRegister::RegisterModule(IModule *module, const ModuleUpdate &update)
@@ -74,6 +88,18 @@ namespace acid
 				continue;
 			}
 
+			for (auto it1 = m_moduleTypes.begin(); it1 != m_moduleTypes.end();)
+			{
+				if ((*it1).second == module)
+				{
+					it1 = m_moduleTypes.erase(it1);
+					continue;
+				}
+
+				++it1;
+			}
+
+			m_dependencies.erase(module);
 			m_modules.erase(it);
 			return true;
 		}
@@ -81,14 +107,104 @@ namespace acid
 		return false;
 	}
 
+	void ModuleRegister::SetDependencies(IModule *module, const std::vector<IModule *> &reads, const std::vector<IModule *> &writes)
+	{
+		m_dependencies[module] = {reads, writes};
+	}
+
 	void ModuleRegister::RunUpdate(const ModuleUpdate &update) const
 	{
+		auto threadPool = Engine::Get() != nullptr ? Engine::Get()->GetThreadPool() : nullptr;
+
+		// Declared modules are gathered into a group, the group is flushed when a barrier module is reached.
+		std::vector<std::pair<IModule *, std::shared_ptr<Job>>> group;
+		std::shared_ptr<Job> root;
+
+		auto flushGroup = [&]()
+		{
+			if (root != nullptr)
+			{
+				threadPool->Run(root);
+				threadPool->Wait(root);
+			}
+
+			group.clear();
+			root = nullptr;
+		};
+
 		for (auto &[key, module] : m_modules)
 		{
-			if (static_cast<int32_t>(std::floor(key)) == update)
+			if (static_cast<int32_t>(std::floor(key)) != update)
 			{
+				continue;
+			}
+
+			auto dependencies = m_dependencies.find(module.get());
+
+			if (threadPool == nullptr || dependencies == m_dependencies.end())
+			{
+				flushGroup();
 				module->Update();
+				continue;
+			}
+
+			if (root == nullptr)
+			{
+				root = threadPool->CreateJob(nullptr);
+			}
+
+			auto modulePtr = module.get();
+			auto job = threadPool->CreateJob([modulePtr]()
+			{
+				modulePtr->Update();
+			}, root);
+
+			// Conflicting modules keep their registration order.
+			for (auto &[other, otherJob] : group)
+			{
+				if (IsConflicting(modulePtr, dependencies->second, other, m_dependencies.at(other)))
+				{
+					threadPool->AddDependency(job, otherJob);
+				}
+			}
+
+			group.emplace_back(modulePtr, job);
+			threadPool->Run(job);
+		}
+
+		flushGroup();
+	}
+
+	bool ModuleRegister::IsConflicting(IModule *a, const ModuleDependencies &dependenciesA, IModule *b, const ModuleDependencies &dependenciesB) const
+	{
+		auto contains = [](const std::vector<IModule *> &modules, IModule *module)
+		{
+			return std::find(modules.begin(), modules.end(), module) != modules.end();
+		};
+
+		// A module always writes into itself.
+		if (contains(dependenciesA.m_reads, b) || contains(dependenciesA.m_writes, b) ||
+			contains(dependenciesB.m_reads, a) || contains(dependenciesB.m_writes, a))
+		{
+			return true;
+		}
+
+		for (auto &write : dependenciesA.m_writes)
+		{
+			if (contains(dependenciesB.m_reads, write) || contains(dependenciesB.m_writes, write))
+			{
+				return true;
 			}
 		}
+
+		for (auto &write : dependenciesB.m_writes)
+		{
+			if (contains(dependenciesA.m_reads, write))
+			{
+				return true;
+			}
+		}
+
+		return false;
 	}
 }
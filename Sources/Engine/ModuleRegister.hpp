@@ -1,11 +1,24 @@
 #pragma once
 
+#include <cstdlib>
 #include <map>
 #include <memory>
+#include <unordered_map>
+#include <vector>
+#include "Helpers/TypeInfo.hpp"
 #include "IModule.hpp"
 
 namespace acid
 {
+	/// <summary>
+	/// The modules a module reads from and writes into during its update, a module always writes into itself.
+	/// </summary>
+	struct ModuleDependencies
+	{
+		std::vector<IModule *> m_reads;
+		std::vector<IModule *> m_writes;
+	};
+
 	/// <summary>
 	/// A class that contains and manages modules registered to a engine.
 	/// </summary>
@@ -13,6 +26,8 @@ namespace acid
 	{
 	private:
 		std::map<float, std::unique_ptr<IModule>> m_modules;
+		std::unordered_map<TypeId, IModule *> m_moduleTypes;
+		std::map<IModule *, ModuleDependencies> m_dependencies;
 	public:
 		ModuleRegister();
 
@@ -40,6 +55,14 @@ namespace acid
 		template<typename T>
 		T *GetModule() const
 		{
+			auto it = m_moduleTypes.find(TypeInfo::GetTypeId<T>());
+
+			if (it != m_moduleTypes.end())
+			{
+				return static_cast<T *>(it->second);
+			}
+
+			// Modules registered without a type, or found by a base type.
 			for (auto &[key, module] : m_modules)
 			{
 				auto casted = dynamic_cast<T *>(module.get());
@@ -71,7 +94,12 @@ namespace acid
 		T *RegisterModule(const ModuleUpdate &update)
 		{
 			auto module = static_cast<T *>(malloc(sizeof(T)));
-			RegisterModule(module, update);
+
+			if (RegisterModule(module, update) != nullptr)
+			{
+				m_moduleTypes[TypeInfo::GetTypeId<T>()] = module;
+			}
+
 			new(module) T();
 			return module;
 		}
@@ -97,6 +125,8 @@ namespace acid
 
 				if (casted != nullptr)
 				{
+					m_moduleTypes.erase(TypeInfo::GetTypeId<T>());
+					m_dependencies.erase(casted);
 					m_modules.erase(it);
 					return true;
 				}
@@ -106,11 +136,22 @@ namespace acid
 		}
 
 		/// <summary>
-		/// Runs updates for all module update types.
+		/// Declares what a module accesses during its update, allowing it to update at the same time as other declared modules in its stage.
+		/// Modules without declared dependencies act as barriers and are updated alone on the calling thread.
+		/// </summary>
+		/// <param name="module"> The module to declare dependencies for. </param>
+		/// <param name="reads"> The modules that are read from during the update. </param>
+		/// <param name="writes"> The modules that are written into during the update. </param>
+		void SetDependencies(IModule *module, const std::vector<IModule *> &reads = {}, const std::vector<IModule *> &writes = {});
+
+		/// <summary>
+		/// Runs updates for all module update types. Declared modules that do not conflict are updated in parallel on the engines thread pool.
 		/// </summary>
 		/// <param name="update"> The modules update type. </param>
 		void RunUpdate(const ModuleUpdate &update) const;
 
 		uint32_t GetModuleCount() const { return static_cast<uint32_t>(m_modules.size()); }
+	private:
+		bool IsConflicting(IModule *a, const ModuleDependencies &dependenciesA, IModule *b, const ModuleDependencies &dependenciesB) const;
 	};
 }
@@ -0,0 +1,291 @@
+#include "BinaryNode.hpp"
+
+#include <cstring>
+
+namespace acid
+{
+	const char BinaryNode::MAGIC[4] = { 'A', 'C', 'M', 'B' };
+	const uint8_t BinaryNode::VERSION = 1;
+
+	static bool ReadVarint(const char *&data, const char *end, uint64_t &value)
+	{
+		value = 0;
+
+		for (uint32_t shift = 0; shift < 64; shift += 7)
+		{
+			if (data >= end)
+			{
+				return false;
+			}
+
+			auto byte = static_cast<uint8_t>(*data++);
+			value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+
+			if ((byte & 0x80) == 0)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	static bool ReadString(const char *&data, const char *end, std::string_view &value)
+	{
+		uint64_t length = 0;
+
+		if (!ReadVarint(data, end, length) || length > static_cast<uint64_t>(end - data))
+		{
+			return false;
+		}
+
+		value = std::string_view(data, static_cast<std::size_t>(length));
+		data += length;
+		return true;
+	}
+
+	static bool ReadKey(const char *&data, const char *end, const std::vector<std::string_view> &keys, std::string_view &value)
+	{
+		uint64_t index = 0;
+
+		if (!ReadVarint(data, end, index) || index >= keys.size())
+		{
+			return false;
+		}
+
+		value = keys[index];
+		return true;
+	}
+
+	BinaryNode::BinaryNode() :
+		m_keys(nullptr),
+		m_begin(nullptr),
+		m_end(nullptr),
+		m_name(std::string_view()),
+		m_type(BINARY_TYPE_NONE),
+		m_string(std::string_view()),
+		m_integer(0),
+		m_float(0.0f),
+		m_attributes(nullptr),
+		m_attributeCount(0),
+		m_children(nullptr),
+		m_childCount(0)
+	{
+	}
+
+	BinaryNode::BinaryNode(const std::vector<std::string_view> *keys, const char *data, const char *end) :
+		BinaryNode()
+	{
+		m_keys = keys;
+		const char *read = data;
+		uint64_t value = 0;
+
+		if (!ReadKey(read, end, *keys, m_name) || read >= end)
+		{
+			return;
+		}
+
+		m_type = static_cast<BinaryType>(*read++);
+
+		switch (m_type)
+		{
+		case BINARY_TYPE_NONE:
+		case BINARY_TYPE_TRUE:
+		case BINARY_TYPE_FALSE:
+			break;
+		case BINARY_TYPE_STRING:
+		case BINARY_TYPE_QUOTED:
+			if (!ReadString(read, end, m_string))
+			{
+				return;
+			}
+
+			break;
+		case BINARY_TYPE_INTEGER:
+			if (!ReadVarint(read, end, value))
+			{
+				return;
+			}
+
+			// Zig-zag decoding, small negative numbers are stored in as few bytes as small positive ones.
+			m_integer = static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+			break;
+		case BINARY_TYPE_FLOAT:
+			if (end - read < static_cast<std::ptrdiff_t>(sizeof(float)))
+			{
+				return;
+			}
+
+			std::memcpy(&m_float, read, sizeof(float));
+			read += sizeof(float);
+			break;
+		default:
+			return;
+		}
+
+		if (!ReadVarint(read, end, value))
+		{
+			return;
+		}
+
+		m_attributeCount = static_cast<uint32_t>(value);
+		m_attributes = read;
+
+		for (uint32_t i = 0; i < m_attributeCount; i++)
+		{
+			std::string_view attribute;
+			std::string_view attributeValue;
+
+			if (!ReadKey(read, end, *keys, attribute) || !ReadString(read, end, attributeValue))
+			{
+				return;
+			}
+		}
+
+		uint32_t childrenSize = 0;
+
+		if (!ReadVarint(read, end, value) || end - read < static_cast<std::ptrdiff_t>(sizeof(childrenSize)))
+		{
+			return;
+		}
+
+		m_childCount = static_cast<uint32_t>(value);
+		std::memcpy(&childrenSize, read, sizeof(childrenSize));
+		read += sizeof(childrenSize);
+
+		if (childrenSize > static_cast<std::size_t>(end - read))
+		{
+			return;
+		}
+
+		m_children = read;
+		m_begin = data;
+		m_end = read + childrenSize;
+	}
+
+	BinaryNode BinaryNode::ReadDocument(const char *data, const std::size_t &size, std::vector<std::string_view> &keys)
+	{
+		keys.clear();
+		const char *end = data + size;
+
+		if (data == nullptr || size < sizeof(MAGIC) + 1 || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0 ||
+			static_cast<uint8_t>(data[sizeof(MAGIC)]) != VERSION)
+		{
+			return BinaryNode();
+		}
+
+		const char *read = data + sizeof(MAGIC) + 1;
+		uint64_t keyCount = 0;
+
+		if (!ReadVarint(read, end, keyCount) || keyCount > static_cast<uint64_t>(end - read))
+		{
+			return BinaryNode();
+		}
+
+		keys.reserve(static_cast<std::size_t>(keyCount));
+
+		for (uint64_t i = 0; i < keyCount; i++)
+		{
+			std::string_view key;
+
+			if (!ReadString(read, end, key))
+			{
+				keys.clear();
+				return BinaryNode();
+			}
+
+			keys.emplace_back(key);
+		}
+
+		return BinaryNode(&keys, read, end);
+	}
+
+	std::string BinaryNode::GetValue() const
+	{
+		switch (m_type)
+		{
+		case BINARY_TYPE_STRING:
+			return std::string(m_string);
+		case BINARY_TYPE_QUOTED:
+			return "\"" + std::string(m_string) + "\"";
+		case BINARY_TYPE_INTEGER:
+			return std::to_string(m_integer);
+		case BINARY_TYPE_FLOAT:
+			return std::to_string(m_float);
+		case BINARY_TYPE_TRUE:
+			return "true";
+		case BINARY_TYPE_FALSE:
+			return "false";
+		default:
+			return "";
+		}
+	}
+
+	std::string_view BinaryNode::FindAttribute(const std::string_view &attribute) const
+	{
+		const char *read = m_attributes;
+
+		for (uint32_t i = 0; i < m_attributeCount; i++)
+		{
+			std::string_view name;
+			std::string_view value;
+			ReadKey(read, m_end, *m_keys, name);
+			ReadString(read, m_end, value);
+
+			if (name == attribute)
+			{
+				return value;
+			}
+		}
+
+		return std::string_view();
+	}
+
+	BinaryNode BinaryNode::FindChild(const std::string_view &name) const
+	{
+		BinaryNode result = BinaryNode();
+		const char *child = m_children;
+
+		for (uint32_t i = 0; i < m_childCount; i++)
+		{
+			BinaryNode node = BinaryNode(m_keys, child, m_end);
+
+			if (!node.IsValid())
+			{
+				break;
+			}
+
+			if (node.m_name == name)
+			{
+				result = node;
+				break;
+			}
+
+			child += node.GetSize();
+		}
+
+		return result;
+	}
+
+	void BinaryNode::ToMetadata(Metadata &metadata) const
+	{
+		metadata.SetName(std::string(m_name));
+		metadata.SetValue(GetValue());
+
+		const char *read = m_attributes;
+
+		for (uint32_t i = 0; i < m_attributeCount; i++)
+		{
+			std::string_view name;
+			std::string_view value;
+			ReadKey(read, m_end, *m_keys, name);
+			ReadString(read, m_end, value);
+			metadata.AddAttribute(std::string(name), std::string(value));
+		}
+
+		ForEachChild([&metadata](const BinaryNode &node)
+		{
+			node.ToMetadata(*metadata.AddChild(new Metadata()));
+		});
+	}
+}
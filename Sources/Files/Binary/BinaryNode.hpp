@@ -0,0 +1,190 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Serialized/Metadata.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// The type tag stored in front of every binary node value.
+	/// </summary>
+	enum BinaryType
+	{
+		BINARY_TYPE_NONE = 0,
+		BINARY_TYPE_STRING = 1,
+		BINARY_TYPE_QUOTED = 2,
+		BINARY_TYPE_INTEGER = 3,
+		BINARY_TYPE_FLOAT = 4,
+		BINARY_TYPE_TRUE = 5,
+		BINARY_TYPE_FALSE = 6
+	};
+
+	/// <summary>
+	/// A read only view of one node in a binary metadata buffer, such as a memory mapped file.
+	/// Nothing is copied or allocated, names and strings point into the buffer, so the buffer must outlive every view made from it.
+	/// </summary>
+	class ACID_EXPORT BinaryNode
+	{
+	private:
+		const std::vector<std::string_view> *m_keys;
+		const char *m_begin;
+		const char *m_end;
+
+		std::string_view m_name;
+		BinaryType m_type;
+		std::string_view m_string;
+		int64_t m_integer;
+		float m_float;
+
+		const char *m_attributes;
+		uint32_t m_attributeCount;
+		const char *m_children;
+		uint32_t m_childCount;
+	public:
+		/// <summary>
+		/// The bytes every binary metadata buffer starts with.
+		/// </summary>
+		static const char MAGIC[4];
+
+		/// <summary>
+		/// The format version written after the magic, buffers of other versions are not read.
+		/// </summary>
+		static const uint8_t VERSION;
+
+		/// <summary>
+		/// Creates an invalid node.
+		/// </summary>
+		BinaryNode();
+
+		/// <summary>
+		/// Reads the header of a node.
+		/// </summary>
+		/// <param name="keys"> The key table of the buffer, names are stored as indices into it. </param>
+		/// <param name="data"> The first byte of the node. </param>
+		/// <param name="end"> One past the last byte of the buffer, the node is invalid if it runs past this. </param>
+		BinaryNode(const std::vector<std::string_view> *keys, const char *data, const char *end);
+
+		/// <summary>
+		/// Reads the header and key table of a binary metadata buffer.
+		/// </summary>
+		/// <param name="data"> The buffer, as written by <seealso cref="FileBinary#Write"/>. </param>
+		/// <param name="size"> The size of the buffer. </param>
+		/// <param name="keys"> Filled with the key table, it must outlive the returned node. </param>
+		/// <returns> The root node, invalid if the buffer is not binary metadata. </returns>
+		static BinaryNode ReadDocument(const char *data, const std::size_t &size, std::vector<std::string_view> &keys);
+
+		/// <summary>
+		/// Gets if this node was read successfully.
+		/// </summary>
+		/// <returns> If the node is valid. </returns>
+		bool IsValid() const { return m_begin != nullptr; }
+
+		/// <summary>
+		/// Gets the number of bytes this node and all of its children take up.
+		/// </summary>
+		/// <returns> The size of the node. </returns>
+		std::size_t GetSize() const { return static_cast<std::size_t>(m_end - m_begin); }
+
+		std::string_view GetName() const { return m_name; }
+
+		BinaryType GetType() const { return m_type; }
+
+		/// <summary>
+		/// Gets the text value without quotes, without copying it.
+		/// Numbers and booleans are not stored as text and give an empty view, <seealso cref="#Get()"/> gives their text.
+		/// </summary>
+		/// <returns> The string value. </returns>
+		std::string_view GetString() const { return m_string; }
+
+		/// <summary>
+		/// Gets the value as the text a <seealso cref="Metadata"/> would hold.
+		/// </summary>
+		/// <returns> The value text. </returns>
+		std::string GetValue() const;
+
+		/// <summary>
+		/// Gets if the value is stored as text, rather than as a number or boolean.
+		/// </summary>
+		/// <returns> If the value is text. </returns>
+		bool IsText() const { return m_type == BINARY_TYPE_STRING || m_type == BINARY_TYPE_QUOTED; }
+
+		template<typename T>
+		T Get() const
+		{
+			if constexpr (std::is_same_v<std::string, T>)
+			{
+				return IsText() ? std::string(m_string) : GetValue();
+			}
+			else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+			{
+				// Text that was not stored as a number is parsed the same way Metadata parses it, without its quotes.
+				if (IsText())
+				{
+					return String::From<T>(std::string(m_string));
+				}
+
+				if constexpr (std::is_same_v<bool, T>)
+				{
+					return m_type == BINARY_TYPE_TRUE || (m_type == BINARY_TYPE_INTEGER && m_integer == 1);
+				}
+				else
+				{
+					return m_type == BINARY_TYPE_FLOAT ? static_cast<T>(m_float) : static_cast<T>(m_integer);
+				}
+			}
+			else
+			{
+				return String::From<T>(GetValue());
+			}
+		}
+
+		uint32_t GetAttributeCount() const { return m_attributeCount; }
+
+		/// <summary>
+		/// Finds the value of an attribute.
+		/// </summary>
+		/// <param name="attribute"> The attribute name. </param>
+		/// <returns> The attribute value, empty if it was not found. </returns>
+		std::string_view FindAttribute(const std::string_view &attribute) const;
+
+		uint32_t GetChildCount() const { return m_childCount; }
+
+		/// <summary>
+		/// Calls a function with each child in order, children that can not be read end the walk.
+		/// </summary>
+		/// <param name="function"> The function to call with each child. </param>
+		template<typename F>
+		void ForEachChild(const F &function) const
+		{
+			const char *child = m_children;
+
+			for (uint32_t i = 0; i < m_childCount; i++)
+			{
+				BinaryNode node = BinaryNode(m_keys, child, m_end);
+
+				if (!node.IsValid())
+				{
+					return;
+				}
+
+				function(node);
+				child += node.GetSize();
+			}
+		}
+
+		/// <summary>
+		/// Finds the first child with a name, skipping over the other children without reading their subtrees.
+		/// </summary>
+		/// <param name="name"> The child name. </param>
+		/// <returns> The child, invalid if it was not found. </returns>
+		BinaryNode FindChild(const std::string_view &name) const;
+
+		/// <summary>
+		/// Builds a metadata tree from this node and its children.
+		/// </summary>
+		/// <param name="metadata"> The metadata to write into. </param>
+		void ToMetadata(Metadata &metadata) const;
+	};
+}
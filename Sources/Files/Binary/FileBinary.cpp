@@ -0,0 +1,253 @@
+#include "FileBinary.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
+#include "Engine/Engine.hpp"
+#include "Files/Files.hpp"
+#include "Helpers/FileSystem.hpp"
+
+namespace acid
+{
+	typedef std::unordered_map<std::string, uint32_t> KeyTable;
+
+	static void WriteVarint(std::vector<char> &data, uint64_t value)
+	{
+		while (value >= 0x80)
+		{
+			data.emplace_back(static_cast<char>((value & 0x7F) | 0x80));
+			value >>= 7;
+		}
+
+		data.emplace_back(static_cast<char>(value));
+	}
+
+	static void WriteString(std::vector<char> &data, const std::string_view &value)
+	{
+		WriteVarint(data, value.size());
+		data.insert(data.end(), value.begin(), value.end());
+	}
+
+	static void CollectKeys(const Metadata &metadata, KeyTable &keys, std::vector<std::string> &order)
+	{
+		auto intern = [&keys, &order](const std::string &key)
+		{
+			if (keys.emplace(key, static_cast<uint32_t>(order.size())).second)
+			{
+				order.emplace_back(key);
+			}
+		};
+
+		intern(metadata.GetName());
+
+		for (auto &[attribute, value] : metadata.GetAttributes())
+		{
+			intern(attribute);
+		}
+
+		for (auto &child : metadata.GetChildren())
+		{
+			CollectKeys(*child, keys, order);
+		}
+	}
+
+	static bool IsInteger(const std::string &value)
+	{
+		// Only text that std::to_string gives back exactly, so the value round trips.
+		std::size_t start = value[0] == '-' ? 1 : 0;
+
+		if (value.size() == start || value.size() - start > 18 || (value[start] == '0' && value.size() > start + 1) || value == "-0")
+		{
+			return false;
+		}
+
+		for (std::size_t i = start; i < value.size(); i++)
+		{
+			if (value[i] < '0' || value[i] > '9')
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	static void WriteValue(std::vector<char> &data, const std::string &value)
+	{
+		if (value.empty())
+		{
+			data.emplace_back(static_cast<char>(BINARY_TYPE_NONE));
+			return;
+		}
+
+		if (value == "true" || value == "false")
+		{
+			data.emplace_back(static_cast<char>(value[0] == 't' ? BINARY_TYPE_TRUE : BINARY_TYPE_FALSE));
+			return;
+		}
+
+		if (IsInteger(value))
+		{
+			auto integer = std::strtoll(value.c_str(), nullptr, 10);
+			data.emplace_back(static_cast<char>(BINARY_TYPE_INTEGER));
+			WriteVarint(data, (static_cast<uint64_t>(integer) << 1) ^ static_cast<uint64_t>(integer >> 63));
+			return;
+		}
+
+		if (value.find('.') != std::string::npos)
+		{
+			char *end = nullptr;
+			auto number = static_cast<float>(std::strtod(value.c_str(), &end));
+
+			if (end == value.c_str() + value.size() && std::to_string(number) == value)
+			{
+				data.emplace_back(static_cast<char>(BINARY_TYPE_FLOAT));
+				data.insert(data.end(), reinterpret_cast<const char *>(&number), reinterpret_cast<const char *>(&number) + sizeof(float));
+				return;
+			}
+		}
+
+		if (value.size() >= 2 && value.front() == '\"' && value.back() == '\"')
+		{
+			data.emplace_back(static_cast<char>(BINARY_TYPE_QUOTED));
+			WriteString(data, std::string_view(value).substr(1, value.size() - 2));
+			return;
+		}
+
+		data.emplace_back(static_cast<char>(BINARY_TYPE_STRING));
+		WriteString(data, value);
+	}
+
+	static void WriteNode(const Metadata &metadata, const KeyTable &keys, std::vector<char> &data)
+	{
+		WriteVarint(data, keys.at(metadata.GetName()));
+		WriteValue(data, metadata.GetValue());
+
+		auto attributes = metadata.GetAttributes();
+		WriteVarint(data, attributes.size());
+
+		for (auto &[attribute, value] : attributes)
+		{
+			WriteVarint(data, keys.at(attribute));
+			WriteString(data, value);
+		}
+
+		WriteVarint(data, metadata.GetChildCount());
+
+		// The size of the children is patched in once they are written.
+		std::size_t sizeOffset = data.size();
+		data.resize(data.size() + sizeof(uint32_t));
+
+		for (auto &child : metadata.GetChildren())
+		{
+			WriteNode(*child, keys, data);
+		}
+
+		auto childrenSize = static_cast<uint32_t>(data.size() - sizeOffset - sizeof(uint32_t));
+		std::memcpy(&data[sizeOffset], &childrenSize, sizeof(uint32_t));
+	}
+
+	FileBinary::FileBinary(const std::string &filename) :
+		m_filename(filename),
+		m_parent(std::make_unique<Metadata>("", "")),
+		m_data(nullptr),
+		m_keys(std::vector<std::string_view>()),
+		m_root(BinaryNode())
+	{
+	}
+
+	void FileBinary::Load()
+	{
+#if defined(ACID_VERBOSE)
+		auto debugStart = Engine::GetTime();
+#endif
+
+		m_parent->ClearChildren();
+
+		if (!Open())
+		{
+			return;
+		}
+
+		m_root.ToMetadata(*m_parent);
+
+#if defined(ACID_VERBOSE)
+		auto debugEnd = Engine::GetTime();
+		Log::Out("Binary '%s' loaded in %ims\n", m_filename.c_str(), (debugEnd - debugStart).AsMilliseconds());
+#endif
+	}
+
+	bool FileBinary::Open()
+	{
+		m_root = BinaryNode();
+		m_keys.clear();
+
+		// Loose files are mapped, so the node views read the file pages directly.
+		m_data = Files::ReadBuffer(m_filename);
+
+		if (m_data == nullptr)
+		{
+			Log::Error("Binary file could not be loaded: '%s'\n", m_filename.c_str());
+			return false;
+		}
+
+		m_root = BinaryNode::ReadDocument(m_data->GetData(), m_data->GetSize(), m_keys);
+
+		if (!m_root.IsValid())
+		{
+			Log::Error("Binary file is not valid metadata: '%s'\n", m_filename.c_str());
+			return false;
+		}
+
+		return true;
+	}
+
+	void FileBinary::Save()
+	{
+#if defined(ACID_VERBOSE)
+		auto debugStart = Engine::GetTime();
+#endif
+
+		std::vector<char> data;
+		Write(*m_parent, data);
+
+		Verify();
+		FileSystem::WriteBinaryFile(m_filename, data);
+
+#if defined(ACID_VERBOSE)
+		auto debugEnd = Engine::GetTime();
+		Log::Out("Binary '%s' saved in %ims\n", m_filename.c_str(), (debugEnd - debugStart).AsMilliseconds());
+#endif
+	}
+
+	void FileBinary::Clear()
+	{
+		m_parent->ClearChildren();
+	}
+
+	void FileBinary::Write(const Metadata &metadata, std::vector<char> &data)
+	{
+		KeyTable keys;
+		std::vector<std::string> order;
+		CollectKeys(metadata, keys, order);
+
+		data.insert(data.end(), std::begin(BinaryNode::MAGIC), std::end(BinaryNode::MAGIC));
+		data.emplace_back(static_cast<char>(BinaryNode::VERSION));
+		WriteVarint(data, order.size());
+
+		for (auto &key : order)
+		{
+			WriteString(data, key);
+		}
+
+		WriteNode(metadata, keys, data);
+	}
+
+	void FileBinary::Verify()
+	{
+		if (!FileSystem::Exists(m_filename))
+		{
+			FileSystem::Create(m_filename);
+		}
+	}
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Files/FileBuffer.hpp"
+#include "Files/IFile.hpp"
+#include "BinaryNode.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// A compact binary metadata file.
+	/// Names and attribute keys are interned into a table, integers are stored as varints, floats and booleans are tagged,
+	/// and each node records the size of its children so readers can skip subtrees they do not need.
+	/// Values keep their text form exactly, so a file converted from JSON or XML converts back unchanged.
+	/// </summary>
+	class ACID_EXPORT FileBinary :
+		public IFile
+	{
+	private:
+		std::string m_filename;
+		std::unique_ptr<Metadata> m_parent;
+		std::shared_ptr<FileBuffer> m_data;
+		std::vector<std::string_view> m_keys;
+		BinaryNode m_root;
+	public:
+		explicit FileBinary(const std::string &filename);
+
+		/// <summary>
+		/// Reads the file and builds the metadata tree.
+		/// </summary>
+		void Load() override;
+
+		/// <summary>
+		/// Reads the file without building the metadata tree, it can then be walked with <seealso cref="#GetRoot()"/>.
+		/// </summary>
+		/// <returns> If the file was read and is valid. </returns>
+		bool Open();
+
+		void Save() override;
+
+		void Clear() override;
+
+		std::string GetFilename() const override { return m_filename; }
+
+		void SetFilename(const std::string &filename) override { m_filename = filename; }
+
+		Metadata *GetParent() const override { return m_parent.get(); }
+
+		Metadata *GetChild(const std::string &name) const { return m_parent->FindChild(name); }
+
+		/// <summary>
+		/// Gets a view of the root node read by the last <seealso cref="#Open()"/> or <seealso cref="#Load()"/>.
+		/// </summary>
+		/// <returns> The root node, invalid if nothing has been read. </returns>
+		const BinaryNode &GetRoot() const { return m_root; }
+
+		/// <summary>
+		/// Encodes a metadata tree into the binary format.
+		/// </summary>
+		/// <param name="metadata"> The tree to encode. </param>
+		/// <param name="data"> The buffer to append to. </param>
+		static void Write(const Metadata &metadata, std::vector<char> &data);
+	private:
+		void Verify();
+	};
+}
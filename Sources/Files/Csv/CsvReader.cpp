@@ -0,0 +1,197 @@
+#include "CsvReader.hpp"
+
+#include <cstring>
+#include "Engine/Log.hpp"
+#include "Maths/Simd.hpp"
+
+namespace acid
+{
+	static bool IsSpace(const char &c)
+	{
+		return c == ' ' || c == '\t';
+	}
+
+	static bool IsLineEnd(const char &c)
+	{
+		return c == '\n' || c == '\r';
+	}
+
+	CsvReader::CsvReader(const std::string_view &csv, const char &delimiter) :
+		m_begin(csv.data()),
+		m_data(csv.data()),
+		m_end(csv.data() + csv.size()),
+		m_delimiter(delimiter),
+		m_fields(std::vector<std::string_view>()),
+		m_escaped(std::vector<bool>())
+	{
+	}
+
+	bool CsvReader::NextRow()
+	{
+		m_fields.clear();
+		m_escaped.clear();
+
+		while (m_data < m_end && IsLineEnd(*m_data))
+		{
+			m_data++;
+		}
+
+		if (m_data == m_end)
+		{
+			return false;
+		}
+
+		while (true)
+		{
+			const char *data = m_data;
+
+			while (data < m_end && IsSpace(*data))
+			{
+				data++;
+			}
+
+			if (data < m_end && *data == '\"')
+			{
+				// Quoted fields end at a quote that is not doubled.
+				const char *fieldStart = data + 1;
+				const char *quote = fieldStart;
+				bool escaped = false;
+
+				while (true)
+				{
+					quote = static_cast<const char *>(std::memchr(quote, '\"', static_cast<std::size_t>(m_end - quote)));
+
+					if (quote == nullptr)
+					{
+						return Error("unterminated quoted field");
+					}
+
+					if (quote + 1 < m_end && quote[1] == '\"')
+					{
+						escaped = true;
+						quote += 2;
+						continue;
+					}
+
+					break;
+				}
+
+				m_fields.emplace_back(fieldStart, static_cast<std::size_t>(quote - fieldStart));
+				m_escaped.emplace_back(escaped);
+				m_data = quote + 1;
+
+				while (m_data < m_end && IsSpace(*m_data))
+				{
+					m_data++;
+				}
+
+				if (m_data < m_end && *m_data != m_delimiter && !IsLineEnd(*m_data))
+				{
+					return Error("expected a delimiter after a quoted field");
+				}
+			}
+			else
+			{
+				const char *fieldEnd = FindFieldEnd(data);
+				m_data = fieldEnd;
+
+				while (fieldEnd > data && IsSpace(*(fieldEnd - 1)))
+				{
+					fieldEnd--;
+				}
+
+				m_fields.emplace_back(data, static_cast<std::size_t>(fieldEnd - data));
+				m_escaped.emplace_back(false);
+			}
+
+			if (m_data == m_end)
+			{
+				return true;
+			}
+
+			if (*m_data != m_delimiter)
+			{
+				// A line break ends the row, "\r\n" is consumed as one.
+				if (*m_data == '\r' && m_data + 1 < m_end && m_data[1] == '\n')
+				{
+					m_data++;
+				}
+
+				m_data++;
+				return true;
+			}
+
+			m_data++;
+
+			// A delimiter at the very end of the text leaves one last empty field.
+			if (m_data == m_end)
+			{
+				m_fields.emplace_back();
+				m_escaped.emplace_back(false);
+				return true;
+			}
+		}
+	}
+
+	std::string CsvReader::GetString(const std::size_t &index) const
+	{
+		return m_escaped[index] ? Unescape(m_fields[index]) : std::string(m_fields[index]);
+	}
+
+	std::string CsvReader::Unescape(const std::string_view &field)
+	{
+		std::string result;
+		result.reserve(field.size());
+
+		for (std::size_t i = 0; i < field.size(); i++)
+		{
+			result += field[i];
+
+			if (field[i] == '\"' && i + 1 < field.size() && field[i + 1] == '\"')
+			{
+				i++;
+			}
+		}
+
+		return result;
+	}
+
+	bool CsvReader::Error(const char *message)
+	{
+		Log::Error("CSV parse error at offset %i: %s\n", static_cast<int32_t>(m_data - m_begin), message);
+		m_fields.clear();
+		m_escaped.clear();
+		return false;
+	}
+
+	const char *CsvReader::FindFieldEnd(const char *data) const
+	{
+#if defined(ACID_SIMD_SSE)
+		// Numeric tables have short fields, but long text fields are worth checking a block at a time.
+		__m128i delimiter = _mm_set1_epi8(m_delimiter);
+		__m128i newline = _mm_set1_epi8('\n');
+		__m128i carriageReturn = _mm_set1_epi8('\r');
+
+		while (m_end - data >= 16)
+		{
+			__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+			auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, delimiter),
+				_mm_or_si128(_mm_cmpeq_epi8(block, newline), _mm_cmpeq_epi8(block, carriageReturn)))));
+
+			if (mask != 0)
+			{
+				return data + CountTrailingZeros(mask);
+			}
+
+			data += 16;
+		}
+#endif
+
+		while (data < m_end && *data != m_delimiter && !IsLineEnd(*data))
+		{
+			data++;
+		}
+
+		return data;
+	}
+}
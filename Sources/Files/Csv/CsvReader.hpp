@@ -0,0 +1,78 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// A streaming CSV tokenizer that reads a row at a time in place, fields are views into the source text.
+	/// Fields may be quoted to hold delimiters, quotes and line breaks, unquoted fields have surrounding spaces removed and blank lines are skipped.
+	/// </summary>
+	class ACID_EXPORT CsvReader
+	{
+	private:
+		const char *m_begin;
+		const char *m_data;
+		const char *m_end;
+		char m_delimiter;
+
+		std::vector<std::string_view> m_fields;
+		std::vector<bool> m_escaped;
+	public:
+		/// <summary>
+		/// Creates a new reader.
+		/// </summary>
+		/// <param name="csv"> The text to read, it is not copied and must outlive the reader. </param>
+		/// <param name="delimiter"> The character between fields. </param>
+		explicit CsvReader(const std::string_view &csv, const char &delimiter = ',');
+
+		/// <summary>
+		/// Reads the next row, the fields of the previous row are replaced.
+		/// </summary>
+		/// <returns> If a row was read, false once the text runs out or a row is malformed. </returns>
+		bool NextRow();
+
+		/// <summary>
+		/// Gets if the text ran out after the last row read, rather than reading stopping at a malformed row.
+		/// </summary>
+		/// <returns> If the whole text was read. </returns>
+		bool IsFinished() const { return m_data == m_end; }
+
+		std::size_t GetFieldCount() const { return m_fields.size(); }
+
+		/// <summary>
+		/// Gets a field of the current row, quoted fields are returned without their quotes.
+		/// </summary>
+		/// <param name="index"> The index of the field. </param>
+		/// <returns> The field, quotes inside quoted fields are still doubled, see <seealso cref="#IsEscaped()"/>. </returns>
+		std::string_view GetField(const std::size_t &index) const { return m_fields[index]; }
+
+		/// <summary>
+		/// Gets if a field of the current row has doubled quotes that <seealso cref="#Unescape()"/> must remove.
+		/// </summary>
+		/// <param name="index"> The index of the field. </param>
+		/// <returns> If the field has escaped quotes. </returns>
+		bool IsEscaped(const std::size_t &index) const { return m_escaped[index]; }
+
+		/// <summary>
+		/// Gets a field of the current row as a string, with any escaped quotes removed.
+		/// </summary>
+		/// <param name="index"> The index of the field. </param>
+		/// <returns> The field text. </returns>
+		std::string GetString(const std::size_t &index) const;
+
+		/// <summary>
+		/// Removes the doubled quotes from the inside of a quoted field.
+		/// </summary>
+		/// <param name="field"> The field text. </param>
+		/// <returns> The unescaped text. </returns>
+		static std::string Unescape(const std::string_view &field);
+	private:
+		bool Error(const char *message);
+
+		const char *FindFieldEnd(const char *data) const;
+	};
+}
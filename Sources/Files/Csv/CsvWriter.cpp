@@ -0,0 +1,95 @@
+#include "CsvWriter.hpp"
+
+namespace acid
+{
+	const std::size_t CsvWriter::BUFFER_SIZE = 64 * 1024;
+
+	CsvWriter::CsvWriter(const std::string &filename, const char &delimiter) :
+		m_stream(std::ofstream(filename, std::ios::binary | std::ios::trunc)),
+		m_delimiter(delimiter),
+		m_buffer(std::string()),
+		m_rowStart(true)
+	{
+		m_buffer.reserve(BUFFER_SIZE + 256);
+	}
+
+	CsvWriter::~CsvWriter()
+	{
+		Flush();
+	}
+
+	void CsvWriter::WriteField(const std::string_view &field)
+	{
+		// An empty first field is quoted, otherwise a row of one empty field would be a blank line that readers skip.
+		bool quote = field.empty() ? m_rowStart : field.front() == ' ' || field.front() == '\t' || field.back() == ' ' || field.back() == '\t';
+		BeginField();
+
+		for (auto c : field)
+		{
+			if (c == m_delimiter || c == '\"' || c == '\n' || c == '\r')
+			{
+				quote = true;
+				break;
+			}
+		}
+
+		if (!quote)
+		{
+			m_buffer.append(field);
+			return;
+		}
+
+		m_buffer += '\"';
+
+		for (auto c : field)
+		{
+			if (c == '\"')
+			{
+				m_buffer += '\"';
+			}
+
+			m_buffer += c;
+		}
+
+		m_buffer += '\"';
+	}
+
+	void CsvWriter::EndRow()
+	{
+		// Rows are never left blank, a blank line would be skipped when read back.
+		if (m_rowStart)
+		{
+			m_buffer += "\"\"";
+		}
+
+		m_buffer += '\n';
+		m_rowStart = true;
+
+		if (m_buffer.size() >= BUFFER_SIZE)
+		{
+			Flush();
+		}
+	}
+
+	bool CsvWriter::Flush()
+	{
+		if (!m_buffer.empty())
+		{
+			m_stream.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+			m_buffer.clear();
+		}
+
+		m_stream.flush();
+		return m_stream.good();
+	}
+
+	void CsvWriter::BeginField()
+	{
+		if (!m_rowStart)
+		{
+			m_buffer += m_delimiter;
+		}
+
+		m_rowStart = false;
+	}
+}
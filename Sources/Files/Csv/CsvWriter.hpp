@@ -0,0 +1,72 @@
+#pragma once
+
+#include <charconv>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// Writes CSV a field at a time through a fixed size buffer, so tables of any size are written without being built in memory first.
+	/// Fields are only quoted when they hold a delimiter, a quote, a line break or surrounding spaces.
+	/// </summary>
+	class ACID_EXPORT CsvWriter
+	{
+	private:
+		static const std::size_t BUFFER_SIZE;
+
+		std::ofstream m_stream;
+		char m_delimiter;
+		std::string m_buffer;
+		bool m_rowStart;
+	public:
+		/// <summary>
+		/// Creates a new writer, replacing the file if it exists.
+		/// </summary>
+		/// <param name="filename"> The real path of the file to write. </param>
+		/// <param name="delimiter"> The character between fields. </param>
+		explicit CsvWriter(const std::string &filename, const char &delimiter = ',');
+
+		~CsvWriter();
+
+		/// <summary>
+		/// Gets if the file was opened and every flush so far succeeded.
+		/// </summary>
+		/// <returns> If the writer is good. </returns>
+		bool IsGood() const { return m_stream.good(); }
+
+		/// <summary>
+		/// Writes a text field to the current row.
+		/// </summary>
+		/// <param name="field"> The field text. </param>
+		void WriteField(const std::string_view &field);
+
+		/// <summary>
+		/// Writes a number to the current row, floating point values are written in their shortest form that reads back exactly.
+		/// </summary>
+		/// <param name="value"> The number. </param>
+		template<typename T>
+		void WriteNumber(const T &value)
+		{
+			BeginField();
+			char text[64];
+			auto result = std::to_chars(text, text + sizeof(text), value);
+			m_buffer.append(text, static_cast<std::size_t>(result.ptr - text));
+		}
+
+		/// <summary>
+		/// Ends the current row.
+		/// </summary>
+		void EndRow();
+
+		/// <summary>
+		/// Writes everything buffered to the file.
+		/// </summary>
+		/// <returns> If the write succeeded. </returns>
+		bool Flush();
+	private:
+		void BeginField();
+	};
+}
@@ -1,15 +1,22 @@
 #include "FileCsv.hpp"
 
+#include <cstring>
 #include "Engine/Engine.hpp"
 #include "Files/Files.hpp"
 #include "Helpers/FileSystem.hpp"
+#include "CsvReader.hpp"
+#include "CsvWriter.hpp"
 
 namespace acid
 {
 	FileCsv::FileCsv(const std::string &filename, const char &delimiter) :
 		m_filename(filename),
 		m_delimiter(delimiter),
-		m_rows(std::vector<RowCsv>())
+		m_buffer(nullptr),
+		m_strings(std::deque<std::string>()),
+		m_cells(std::vector<std::string_view>()),
+		m_rows(std::vector<std::pair<std::size_t, std::size_t>>()),
+		m_edited(std::unordered_map<std::size_t, RowCsv>())
 	{
 	}
 
@@ -19,20 +26,40 @@ namespace acid
 		auto debugStart = Engine::GetTime();
 #endif
 
-		auto fileLoaded = Files::Read(m_filename);
+		auto fileLoaded = Files::ReadBuffer(m_filename);
 
-		if (!fileLoaded)
+		if (fileLoaded == nullptr)
 		{
 			Log::Error("CSV file could not be loaded: '%s'\n", m_filename.c_str());
 			return;
 		}
 
-		auto lines = String::Split(*fileLoaded, "\n", true);
+		Clear();
+		m_buffer = fileLoaded;
 
-		for (auto &line : lines)
+		CsvReader reader = CsvReader(m_buffer->GetView(), m_delimiter);
+
+		while (reader.NextRow())
+		{
+			m_rows.emplace_back(m_cells.size(), reader.GetFieldCount());
+
+			for (std::size_t i = 0; i < reader.GetFieldCount(); i++)
+			{
+				if (reader.IsEscaped(i))
+				{
+					m_strings.emplace_back(CsvReader::Unescape(reader.GetField(i)));
+					m_cells.emplace_back(m_strings.back());
+				}
+				else
+				{
+					m_cells.emplace_back(reader.GetField(i));
+				}
+			}
+		}
+
+		if (!reader.IsFinished())
 		{
-			RowCsv row = RowCsv(String::Split(line, std::string(1, m_delimiter), true));
-			m_rows.emplace_back(row);
+			Log::Error("CSV file could not be fully loaded: '%s'\n", m_filename.c_str());
 		}
 
 #if defined(ACID_VERBOSE)
@@ -47,26 +74,38 @@ namespace acid
 		auto debugStart = Engine::GetTime();
 #endif
 
-		std::stringstream builder;
+		// Opening the writer truncates the file, which may be the one the cells are mapped from.
+		CopyMappedCells();
 
-		for (auto &row : m_rows)
+		Verify();
+		CsvWriter writer = CsvWriter(m_filename, m_delimiter);
+
+		for (std::size_t row = 0; row < m_rows.size(); row++)
 		{
-			for (auto &element : row.GetElements())
+			if (auto edited = FindEdited(row))
+			{
+				for (auto &element : edited->GetElements())
+				{
+					writer.WriteField(element);
+				}
+			}
+			else
 			{
-				builder << element;
+				auto &[first, count] = m_rows[row];
 
-				if (element != row.GetElements().back())
+				for (std::size_t i = first; i < first + count; i++)
 				{
-					builder << m_delimiter;
+					writer.WriteField(m_cells[i]);
 				}
 			}
 
-			builder << "\n";
+			writer.EndRow();
 		}
 
-		Verify();
-		FileSystem::ClearFile(m_filename);
-		FileSystem::WriteTextFile(m_filename, builder.str());
+		if (!writer.Flush())
+		{
+			Log::Error("CSV file could not be saved: '%s'\n", m_filename.c_str());
+		}
 
 #if defined(ACID_VERBOSE)
 		auto debugEnd = Engine::GetTime();
@@ -77,29 +116,158 @@ namespace acid
 	void FileCsv::Clear()
 	{
 		m_rows.clear();
+		m_cells.clear();
+		m_strings.clear();
+		m_edited.clear();
+		m_buffer = nullptr;
 	}
 
 	RowCsv &FileCsv::GetRow(const uint32_t &index)
 	{
-		return m_rows.at(index);
+		auto &[first, count] = m_rows.at(index);
+
+		if (auto it = m_edited.find(index); it != m_edited.end())
+		{
+			return (*it).second;
+		}
+
+		std::vector<std::string> elements;
+		elements.reserve(count);
+
+		for (std::size_t i = first; i < first + count; i++)
+		{
+			elements.emplace_back(m_cells[i]);
+		}
+
+		return (*m_edited.try_emplace(index, elements).first).second;
 	}
 
 	void FileCsv::PushRow(const RowCsv &row)
 	{
-		m_rows.emplace_back(row);
+		AppendRow(row.GetElements());
 	}
 
 	void FileCsv::SetRow(const RowCsv &row, const uint32_t &index)
 	{
-		if (m_rows.size() <= index)
+		while (m_rows.size() <= index)
+		{
+			m_rows.emplace_back(m_cells.size(), 0);
+		}
+
+		// The row owns its text, so replacing it again frees the old text rather than leaving it in the table.
+		if (auto [it, inserted] = m_edited.try_emplace(index, row.GetElements()); !inserted)
+		{
+			(*it).second.SetElements(row.GetElements());
+		}
+	}
+
+	size_t FileCsv::GetCellCount(const uint32_t &row) const
+	{
+		if (auto edited = FindEdited(row))
+		{
+			return edited->GetElements().size();
+		}
+
+		return row < m_rows.size() ? m_rows[row].second : 0;
+	}
+
+	std::string_view FileCsv::GetCell(const uint32_t &row, const uint32_t &column) const
+	{
+		if (auto edited = FindEdited(row))
+		{
+			return column < edited->GetElements().size() ? std::string_view(edited->GetElements()[column]) : std::string_view();
+		}
+
+		if (row >= m_rows.size() || column >= m_rows[row].second)
+		{
+			return std::string_view();
+		}
+
+		return m_cells[m_rows[row].first + column];
+	}
+
+	std::vector<float> FileCsv::GetFloats(const uint32_t &column, const uint32_t &firstRow) const
+	{
+		std::vector<float> result;
+		result.reserve(m_rows.size() > firstRow ? m_rows.size() - firstRow : 0);
+
+		for (auto row = static_cast<std::size_t>(firstRow); row < m_rows.size(); row++)
+		{
+			auto size = result.size();
+
+			if (!String::ParseFloats(GetCell(static_cast<uint32_t>(row), column), result) || result.size() != size + 1)
+			{
+				result.resize(size);
+				result.emplace_back(0.0f);
+			}
+		}
+
+		return result;
+	}
+
+	std::vector<int32_t> FileCsv::GetIntegers(const uint32_t &column, const uint32_t &firstRow) const
+	{
+		std::vector<int32_t> result;
+		result.reserve(m_rows.size() > firstRow ? m_rows.size() - firstRow : 0);
+
+		for (auto row = static_cast<std::size_t>(firstRow); row < m_rows.size(); row++)
+		{
+			auto size = result.size();
+
+			if (!String::ParseIntegers(GetCell(static_cast<uint32_t>(row), column), result) || result.size() != size + 1)
+			{
+				result.resize(size);
+				result.emplace_back(0);
+			}
+		}
+
+		return result;
+	}
+
+	void FileCsv::AppendRow(const std::vector<std::string> &elements)
+	{
+		m_rows.emplace_back(m_cells.size(), elements.size());
+
+		for (auto &element : elements)
+		{
+			m_strings.emplace_back(element);
+			m_cells.emplace_back(m_strings.back());
+		}
+	}
+
+	const RowCsv *FileCsv::FindEdited(const std::size_t &row) const
+	{
+		if (m_edited.empty())
+		{
+			return nullptr;
+		}
+
+		auto it = m_edited.find(row);
+		return it == m_edited.end() ? nullptr : &(*it).second;
+	}
+
+	void FileCsv::CopyMappedCells()
+	{
+		if (m_buffer == nullptr || !m_buffer->IsMapped())
+		{
+			return;
+		}
+
+		auto view = m_buffer->GetView();
+		auto heap = FileBuffer::AcquireHeap(view.size());
+		std::memcpy(heap.data(), view.data(), view.size());
+		auto copy = std::make_shared<FileBuffer>(std::move(heap));
+
+		// Cells in the mapping move to the same place in the copy, unescaped and added cells are not in it.
+		for (auto &cell : m_cells)
 		{
-			for (size_t i = m_rows.size(); i <= index; i++)
+			if (cell.data() >= view.data() && cell.data() <= view.data() + view.size())
 			{
-				m_rows.emplace_back(RowCsv({}));
+				cell = std::string_view(copy->GetData() + (cell.data() - view.data()), cell.size());
 			}
 		}
 
-		m_rows.at(index).SetElements(row.GetElements());
+		m_buffer = copy;
 	}
 
 	void FileCsv::Verify()
@@ -1,18 +1,33 @@
 #pragma once
 
+#include <deque>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include "Files/FileBuffer.hpp"
 #include "Files/IFile.hpp"
 #include "RowCsv.hpp"
 
 namespace acid
 {
+	/// <summary>
+	/// A table loaded from CSV, cells are kept as views into the loaded file rather than a string each.
+	/// Whole columns can be read as numbers with <seealso cref="#GetFloats()"/> and <seealso cref="#GetIntegers()"/>.
+	/// </summary>
 	class ACID_EXPORT FileCsv :
 		public IFile
 	{
 	private:
 		std::string m_filename;
 		char m_delimiter;
-		std::vector<RowCsv> m_rows;
+		std::shared_ptr<FileBuffer> m_buffer;
+		/// Text for cells that are not in the buffer, either unescaped or added after loading. A deque never moves its strings.
+		std::deque<std::string> m_strings;
+		std::vector<std::string_view> m_cells;
+		/// The first cell and the cell count of each row.
+		std::vector<std::pair<std::size_t, std::size_t>> m_rows;
+		/// Rows handed out by <seealso cref="#GetRow()"/>, they own their text and take the place of the row's cells until the table is loaded or cleared.
+		std::unordered_map<std::size_t, RowCsv> m_edited;
 	public:
 		explicit FileCsv(const std::string &filename, const char &delimiter = ',');
 
@@ -34,13 +49,54 @@ namespace acid
 
 		size_t GetRowCount() const { return m_rows.size(); }
 
+		/// <summary>
+		/// Gets a row that can be changed, its cells are copied out of the table the first time it is asked for.
+		/// </summary>
+		/// <param name="index"> The index of the row. </param>
+		/// <returns> The row. </returns>
 		RowCsv &GetRow(const uint32_t &index);
 
 		void PushRow(const RowCsv &row);
 
 		void SetRow(const RowCsv &row, const uint32_t &index);
 
+		/// <summary>
+		/// Gets the number of cells in a row.
+		/// </summary>
+		/// <param name="row"> The index of the row. </param>
+		/// <returns> The cell count, zero past the last row. </returns>
+		size_t GetCellCount(const uint32_t &row) const;
+
+		/// <summary>
+		/// Gets a cell without copying it, the view is valid until the table is loaded, cleared or destroyed, or its row is changed.
+		/// </summary>
+		/// <param name="row"> The index of the row. </param>
+		/// <param name="column"> The index of the cell in the row. </param>
+		/// <returns> The cell text, empty if the row or column does not exist. </returns>
+		std::string_view GetCell(const uint32_t &row, const uint32_t &column) const;
+
+		/// <summary>
+		/// Reads a column as floats, cells that are missing or not a number read as zero.
+		/// </summary>
+		/// <param name="column"> The index of the column. </param>
+		/// <param name="firstRow"> The first row to read, to skip a header. </param>
+		/// <returns> One value for every row from the first. </returns>
+		std::vector<float> GetFloats(const uint32_t &column, const uint32_t &firstRow = 0) const;
+
+		/// <summary>
+		/// Reads a column as integers, cells that are missing or not an integer read as zero.
+		/// </summary>
+		/// <param name="column"> The index of the column. </param>
+		/// <param name="firstRow"> The first row to read, to skip a header. </param>
+		/// <returns> One value for every row from the first. </returns>
+		std::vector<int32_t> GetIntegers(const uint32_t &column, const uint32_t &firstRow = 0) const;
 	private:
+		void AppendRow(const std::vector<std::string> &elements);
+
+		const RowCsv *FindEdited(const std::size_t &row) const;
+
+		void CopyMappedCells();
+
 		void Verify();
 	};
 }
@@ -0,0 +1,182 @@
+#include "FileBuffer.hpp"
+
+#include <algorithm>
+#include <mutex>
+
+#if defined(ACID_BUILD_WINDOWS)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace acid
+{
+	/// Buffers larger than this are freed instead of being kept for reuse.
+	static const std::size_t MAX_POOLED_SIZE = 16 * 1024 * 1024;
+	static const std::size_t MAX_POOLED_BUFFERS = 4;
+
+	static std::mutex POOL_MUTEX;
+	static std::vector<std::vector<char>> POOL;
+
+	FileBuffer::FileBuffer() :
+		m_data(nullptr),
+		m_size(0),
+		m_mapping(nullptr),
+#if defined(ACID_BUILD_WINDOWS)
+		m_mappingHandle(nullptr),
+#endif
+		m_heap(std::vector<char>()),
+		m_parent(nullptr)
+	{
+	}
+
+	FileBuffer::FileBuffer(std::vector<char> &&heap) :
+		FileBuffer()
+	{
+		m_heap = std::move(heap);
+		m_data = m_heap.data();
+		m_size = m_heap.size();
+	}
+
+	FileBuffer::~FileBuffer()
+	{
+		if (m_mapping != nullptr)
+		{
+#if defined(ACID_BUILD_WINDOWS)
+			UnmapViewOfFile(m_mapping);
+			CloseHandle(m_mappingHandle);
+#else
+			munmap(m_mapping, m_size);
+#endif
+			return;
+		}
+
+		if (m_heap.capacity() == 0 || m_heap.capacity() > MAX_POOLED_SIZE)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(POOL_MUTEX);
+
+		if (POOL.size() < MAX_POOLED_BUFFERS)
+		{
+			POOL.emplace_back(std::move(m_heap));
+		}
+	}
+
+	std::shared_ptr<FileBuffer> FileBuffer::Map(const std::string &filename)
+	{
+#if defined(ACID_BUILD_WINDOWS)
+		HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			return nullptr;
+		}
+
+		LARGE_INTEGER size;
+
+		if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+		{
+			CloseHandle(file);
+			return nullptr;
+		}
+
+		HANDLE mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file);
+
+		if (mappingHandle == nullptr)
+		{
+			return nullptr;
+		}
+
+		void *mapping = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+
+		if (mapping == nullptr)
+		{
+			CloseHandle(mappingHandle);
+			return nullptr;
+		}
+
+		auto result = std::shared_ptr<FileBuffer>(new FileBuffer());
+		result->m_mappingHandle = mappingHandle;
+		result->m_size = static_cast<std::size_t>(size.QuadPart);
+#else
+		int file = open(filename.c_str(), O_RDONLY);
+
+		if (file == -1)
+		{
+			return nullptr;
+		}
+
+		struct stat status;
+
+		// Empty files can not be mapped, the caller falls back to a plain read.
+		if (fstat(file, &status) != 0 || status.st_size == 0)
+		{
+			close(file);
+			return nullptr;
+		}
+
+		void *mapping = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+		close(file);
+
+		if (mapping == MAP_FAILED)
+		{
+			return nullptr;
+		}
+
+		auto result = std::shared_ptr<FileBuffer>(new FileBuffer());
+		result->m_size = static_cast<std::size_t>(status.st_size);
+#endif
+
+		result->m_mapping = mapping;
+		result->m_data = static_cast<const char *>(mapping);
+		return result;
+	}
+
+	std::shared_ptr<FileBuffer> FileBuffer::Slice(const std::shared_ptr<FileBuffer> &parent, const std::size_t &offset, const std::size_t &size)
+	{
+		auto result = std::shared_ptr<FileBuffer>(new FileBuffer());
+		result->m_parent = parent;
+		result->m_data = parent->m_data + offset;
+		result->m_size = size;
+		return result;
+	}
+
+	std::vector<char> FileBuffer::AcquireHeap(const std::size_t &size)
+	{
+		std::vector<char> result;
+
+		{
+			std::lock_guard<std::mutex> lock(POOL_MUTEX);
+
+			// The smallest pooled buffer that fits, or the largest one to grow if none do.
+			auto best = POOL.end();
+
+			for (auto it = POOL.begin(); it != POOL.end(); ++it)
+			{
+				bool fits = (*it).capacity() >= size;
+				bool bestFits = best != POOL.end() && (*best).capacity() >= size;
+
+				if (best == POOL.end() || (fits && (!bestFits || (*it).capacity() < (*best).capacity())) ||
+					(!fits && !bestFits && (*it).capacity() > (*best).capacity()))
+				{
+					best = it;
+				}
+			}
+
+			if (best != POOL.end())
+			{
+				result = std::move(*best);
+				POOL.erase(best);
+			}
+		}
+
+		result.resize(size);
+		return result;
+	}
+}
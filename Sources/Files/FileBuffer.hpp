@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// The read only bytes of a file, either mapped straight from disk or read once into a pooled buffer.
+	/// Buffers are handed around by shared pointer, the mapping is closed or the memory returned to the pool when the last reference goes.
+	/// </summary>
+	class ACID_EXPORT FileBuffer
+	{
+	private:
+		const char *m_data;
+		std::size_t m_size;
+		void *m_mapping;
+#if defined(ACID_BUILD_WINDOWS)
+		void *m_mappingHandle;
+#endif
+		std::vector<char> m_heap;
+		std::shared_ptr<FileBuffer> m_parent;
+	public:
+		/// <summary>
+		/// Creates a buffer over memory read from a file.
+		/// </summary>
+		/// <param name="heap"> The bytes, best taken from <seealso cref="#AcquireHeap()"/> so they can be reused. </param>
+		explicit FileBuffer(std::vector<char> &&heap);
+
+		~FileBuffer();
+
+		FileBuffer(const FileBuffer&) = delete;
+
+		FileBuffer& operator=(const FileBuffer&) = delete;
+
+		/// <summary>
+		/// Maps a file on disk into memory, the pages are only read as they are touched.
+		/// </summary>
+		/// <param name="filename"> The real path of the file. </param>
+		/// <returns> The mapped file, or nullptr if it could not be mapped. </returns>
+		static std::shared_ptr<FileBuffer> Map(const std::string &filename);
+
+		/// <summary>
+		/// Creates a buffer over part of another buffer without copying, the other buffer is kept alive while the slice is.
+		/// </summary>
+		/// <param name="parent"> The buffer to slice, usually a mapped archive. </param>
+		/// <param name="offset"> The first byte of the slice. </param>
+		/// <param name="size"> The number of bytes in the slice. </param>
+		/// <returns> The slice. </returns>
+		static std::shared_ptr<FileBuffer> Slice(const std::shared_ptr<FileBuffer> &parent, const std::size_t &offset, const std::size_t &size);
+
+		/// <summary>
+		/// Takes a buffer from the pool of buffers released by earlier reads, or allocates one.
+		/// </summary>
+		/// <param name="size"> The number of bytes needed. </param>
+		/// <returns> A buffer holding size bytes. </returns>
+		static std::vector<char> AcquireHeap(const std::size_t &size);
+
+		const char *GetData() const { return m_data; }
+
+		std::size_t GetSize() const { return m_size; }
+
+		std::string_view GetView() const { return std::string_view(m_data, m_size); }
+
+		/// <summary>
+		/// Gets if the bytes are mapped from disk rather than read into memory.
+		/// </summary>
+		/// <returns> If the buffer is a mapping. </returns>
+		bool IsMapped() const { return m_mapping != nullptr || (m_parent != nullptr && m_parent->IsMapped()); }
+	private:
+		FileBuffer();
+	};
+}
@@ -5,17 +5,61 @@
 #include <fstream>
 #include <physfs.h>
 #include "Helpers/FileSystem.hpp"
+#include "Helpers/String.hpp"
+#include "Pack/FilePack.hpp"
 
 namespace acid
 {
-	Files::Files()
+	/// Packs are searched before the PhysFS paths, in the order they were added.
+	static std::mutex PACKS_MUTEX;
+	static std::vector<std::shared_ptr<FilePack>> PACKS;
+
+	static bool IsPack(const std::string &path)
 	{
+		return String::Lowercase(FileSystem::FileSuffix(path)) == ".pack";
 	}
 
-//	Files::~Files()
-//	{
-//		PHYSFS_deinit();
-//	}
+	static std::shared_ptr<FileBuffer> ReadPacked(const std::string &path)
+	{
+		// Decompressing can take a while, so it happens on a copy of the list without holding the lock. The copy keeps removed packs mapped until their reads finish.
+		std::vector<std::shared_ptr<FilePack>> packs;
+
+		{
+			std::lock_guard<std::mutex> lock(PACKS_MUTEX);
+			packs = PACKS;
+		}
+
+		for (auto &pack : packs)
+		{
+			if (auto buffer = pack->Read(path))
+			{
+				return buffer;
+			}
+		}
+
+		return nullptr;
+	}
+
+	Files::Files() :
+		m_worker(std::thread()),
+		m_requests(std::priority_queue<Request>()),
+		m_requestCount(0),
+		m_destroying(false)
+	{
+		m_worker = std::thread(&Files::RequestLoop, this);
+	}
+
+	Files::~Files()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_requestMutex);
+			m_destroying = true;
+		}
+
+		m_condition.notify_one();
+		m_worker.join();
+	//	PHYSFS_deinit();
+	}
 
 	void Files::Update()
 	{
@@ -28,6 +72,19 @@ namespace acid
 
 	void Files::AddSearchPath(const std::string &path)
 	{
+		if (IsPack(path))
+		{
+			auto pack = std::make_shared<FilePack>(path);
+
+			if (pack->IsValid())
+			{
+				std::lock_guard<std::mutex> lock(PACKS_MUTEX);
+				PACKS.emplace_back(std::move(pack));
+			}
+
+			return;
+		}
+
 		if (PHYSFS_mount(path.c_str(), nullptr, true) == 0)
 		{
 			Log::Error("File System error while adding a path or zip(%s): %s\n", path.c_str(), PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
@@ -36,6 +93,16 @@ namespace acid
 
 	void Files::RemoveSearchPath(const std::string &path)
 	{
+		if (IsPack(path))
+		{
+			std::lock_guard<std::mutex> lock(PACKS_MUTEX);
+			PACKS.erase(std::remove_if(PACKS.begin(), PACKS.end(), [&path](const std::shared_ptr<FilePack> &pack)
+			{
+				return pack->GetFilename() == path;
+			}), PACKS.end());
+			return;
+		}
+
 		if (PHYSFS_unmount(path.c_str()) == 0)
 		{
 			Log::Error("File System error while removing a path: %s\n", path.c_str(), PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
@@ -44,6 +111,11 @@ namespace acid
 
 	std::optional<std::string> Files::Read(const std::string &path)
 	{
+		if (auto packed = ReadPacked(path))
+		{
+			return std::string(packed->GetView());
+		}
+
 		PHYSFS_file *fs_file = PHYSFS_openRead(path.c_str());
 
 		if (fs_file == nullptr)
@@ -52,15 +124,102 @@ namespace acid
 			return {};
 		}
 
+		// Read straight into the string, rather than into a vector that is then copied.
 		PHYSFS_sint64 size = PHYSFS_fileLength(fs_file);
-		std::vector<uint8_t> data(size);
-		PHYSFS_readBytes(fs_file, data.data(), (PHYSFS_uint64)size);
+		std::string data(static_cast<std::size_t>(std::max(size, static_cast<PHYSFS_sint64>(0))), '\0');
+		PHYSFS_readBytes(fs_file, &data[0], static_cast<PHYSFS_uint64>(data.size()));
 
 		if (PHYSFS_close(fs_file) == 0)
 		{
 			Log::Error("Error while closing file %s: %s\n", path.c_str(), PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
 		}
 
-		return std::string(data.begin(), data.end());
+		return data;
+	}
+
+	std::shared_ptr<FileBuffer> Files::ReadBuffer(const std::string &path)
+	{
+		if (auto packed = ReadPacked(path))
+		{
+			return packed;
+		}
+
+		const char *realDirectory = PHYSFS_getRealDir(path.c_str());
+
+		// Files found in a mounted folder rather than an archive can be mapped from disk directly.
+		if (realDirectory != nullptr && FileSystem::IsDirectory(realDirectory))
+		{
+			if (auto mapped = FileBuffer::Map(std::string(realDirectory) + "/" + path))
+			{
+				return mapped;
+			}
+		}
+
+		PHYSFS_file *fs_file = PHYSFS_openRead(path.c_str());
+
+		if (fs_file == nullptr)
+		{
+			Log::Error("Error while opening file to load %s: %s\n", path.c_str(), PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
+			return nullptr;
+		}
+
+		PHYSFS_sint64 size = PHYSFS_fileLength(fs_file);
+		auto data = FileBuffer::AcquireHeap(static_cast<std::size_t>(std::max(size, static_cast<PHYSFS_sint64>(0))));
+		PHYSFS_sint64 read = PHYSFS_readBytes(fs_file, data.data(), static_cast<PHYSFS_uint64>(data.size()));
+
+		if (PHYSFS_close(fs_file) == 0)
+		{
+			Log::Error("Error while closing file %s: %s\n", path.c_str(), PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
+		}
+
+		data.resize(static_cast<std::size_t>(std::max(read, static_cast<PHYSFS_sint64>(0))));
+		return std::make_shared<FileBuffer>(std::move(data));
+	}
+
+	std::future<std::shared_ptr<FileBuffer>> Files::ReadAsync(const std::string &path, const int32_t &priority)
+	{
+		auto promise = std::make_shared<std::promise<std::shared_ptr<FileBuffer>>>();
+		auto future = promise->get_future();
+
+		{
+			std::lock_guard<std::mutex> lock(m_requestMutex);
+			m_requests.push(Request{path, priority, m_requestCount++, promise});
+		}
+
+		m_condition.notify_one();
+		return future;
+	}
+
+	void Files::RequestLoop()
+	{
+		while (true)
+		{
+			Request request;
+
+			{
+				std::unique_lock<std::mutex> lock(m_requestMutex);
+				m_condition.wait(lock, [this]
+				{
+					return !m_requests.empty() || m_destroying;
+				});
+
+				if (m_destroying)
+				{
+					break;
+				}
+
+				request = m_requests.top();
+				m_requests.pop();
+			}
+
+			request.m_promise->set_value(ReadBuffer(request.m_path));
+		}
+
+		// Requests still waiting are answered so nothing blocks on them forever.
+		while (!m_requests.empty())
+		{
+			m_requests.top().m_promise->set_value(nullptr);
+			m_requests.pop();
+		}
 	}
 }
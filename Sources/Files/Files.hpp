@@ -1,9 +1,15 @@
 #pragma once
 
+#include <condition_variable>
+#include <future>
 #include <vector>
 #include <iostream>
+#include <mutex>
 #include <optional>
+#include <queue>
+#include <thread>
 #include "Engine/Engine.hpp"
+#include "FileBuffer.hpp"
 
 namespace acid
 {
@@ -13,6 +19,27 @@ namespace acid
 	class ACID_EXPORT Files :
 		public IModule
 	{
+	private:
+		struct Request
+		{
+			std::string m_path;
+			int32_t m_priority;
+			uint64_t m_order;
+			std::shared_ptr<std::promise<std::shared_ptr<FileBuffer>>> m_promise;
+
+			bool operator<(const Request &other) const
+			{
+				// Higher priorities first, then in the order requested.
+				return m_priority != other.m_priority ? m_priority < other.m_priority : m_order > other.m_order;
+			}
+		};
+
+		std::thread m_worker;
+		std::priority_queue<Request> m_requests;
+		std::mutex m_requestMutex;
+		std::condition_variable m_condition;
+		uint64_t m_requestCount;
+		bool m_destroying;
 	public:
 		/// <summary>
 		/// Gets this engine instance.
@@ -22,6 +49,8 @@ namespace acid
 
 		Files();
 
+		~Files();
+
 		void Update() override;
 
 		/// <summary>
@@ -32,6 +61,7 @@ namespace acid
 
 		/// <summary>
 		/// Adds an file search path, ensure <seealso cref="#SetBaseDirectory()"/> is called once before.
+		/// Paths ending in ".pack" are opened as a <seealso cref="FilePack"/> and searched before every other path.
 		/// </summary>
 		/// <param name="path"> The path to add. </param>
 		static void AddSearchPath(const std::string &path);
@@ -48,5 +78,22 @@ namespace acid
 		/// <param name="path"> The path to read. </param>
 		/// <returns> The data read from the file. </returns>
 		static std::optional<std::string> Read(const std::string &path);
+
+		/// <summary>
+		/// Reads a file without copying it, loose files are memory mapped and files in archives are read once into a pooled buffer.
+		/// </summary>
+		/// <param name="path"> The path to read. </param>
+		/// <returns> The file bytes, or nullptr if the file could not be read. </returns>
+		static std::shared_ptr<FileBuffer> ReadBuffer(const std::string &path);
+
+		/// <summary>
+		/// Queues a file to be read by <seealso cref="#ReadBuffer()"/> on the file thread, so loading does not stall the caller.
+		/// </summary>
+		/// <param name="path"> The path to read. </param>
+		/// <param name="priority"> Requests with higher priorities are read first. </param>
+		/// <returns> The future file bytes, nullptr if the file could not be read. </returns>
+		std::future<std::shared_ptr<FileBuffer>> ReadAsync(const std::string &path, const int32_t &priority = 0);
+	private:
+		void RequestLoop();
 	};
 }
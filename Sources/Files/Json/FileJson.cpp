@@ -2,8 +2,8 @@
 
 #include "Engine/Engine.hpp"
 #include "Files/Files.hpp"
-#include "Helpers/String.hpp"
 #include "Helpers/FileSystem.hpp"
+#include "JsonParser.hpp"
 
 namespace acid
 {
@@ -21,7 +21,7 @@ namespace acid
 
 		m_parent->ClearChildren();
 
-		auto fileLoaded = Files::Read(m_filename);
+		auto fileLoaded = Files::ReadBuffer(m_filename);
 
 		if (!fileLoaded)
 		{
@@ -29,60 +29,9 @@ namespace acid
 			return;
 		}
 
-		JsonSection *currentSection = nullptr;
-		std::stringstream summation;
-
-		for (char &c : *fileLoaded)
-		{
-			if (c == '{' || c == '[')
-			{
-				if (currentSection == nullptr)
-				{
-					currentSection = new JsonSection(nullptr, "", "");
-					continue;
-				}
-
-				std::string name;
-
-				if (!summation.str().empty())
-				{
-					auto contentSplit = String::Split(summation.str(), "\"");
-
-					if (static_cast<int32_t>(contentSplit.size()) - 2 >= 0)
-					{
-						name = contentSplit.at(contentSplit.size() - 2);
-					}
-				}
-
-				currentSection->SetContent(currentSection->GetContent() + summation.str());
-				summation.str(std::string());
-
-				auto section = new JsonSection(currentSection, name, "");
-				currentSection->AddChild(section);
-				currentSection = section;
-			}
-			else if (c == '}' || c == ']')
-			{
-				currentSection->SetContent(currentSection->GetContent() + summation.str());
-				summation.str(std::string());
-
-				if (currentSection->GetParent() != nullptr)
-				{
-					currentSection = currentSection->GetParent();
-				}
-			}
-			else if (c == '\n')
-			{
-			}
-			else
-			{
-				summation << c;
-			}
-		}
-
-		if (currentSection != nullptr)
+		if (!JsonParser::Parse(fileLoaded->GetView(), *m_parent))
 		{
-			JsonSection::Convert(*currentSection, m_parent.get(), true);
+			Log::Error("JSON file could not be parsed: '%s'\n", m_filename.c_str());
 		}
 
 #if defined(ACID_VERBOSE)
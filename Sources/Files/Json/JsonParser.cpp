@@ -0,0 +1,312 @@
+#include "JsonParser.hpp"
+
+#include <vector>
+#include "Engine/Log.hpp"
+#include "Maths/Simd.hpp"
+
+namespace acid
+{
+	class MetadataJsonHandler :
+		public IJsonHandler
+	{
+	private:
+		Metadata *m_root;
+		std::vector<Metadata *> m_stack;
+	public:
+		explicit MetadataJsonHandler(Metadata *root) :
+			m_root(root),
+			m_stack(std::vector<Metadata *>())
+		{
+		}
+
+		void OnObjectStart(const std::string_view &key) override
+		{
+			Push(key);
+		}
+
+		void OnObjectEnd() override
+		{
+			m_stack.pop_back();
+		}
+
+		void OnArrayStart(const std::string_view &key) override
+		{
+			Push(key);
+		}
+
+		void OnArrayEnd() override
+		{
+			m_stack.pop_back();
+		}
+
+		void OnValue(const std::string_view &key, const std::string_view &value) override
+		{
+			auto child = m_stack.back()->AddChild(new Metadata());
+			child->SetName(std::string(key));
+			child->SetValue(std::string(value));
+		}
+	private:
+		void Push(const std::string_view &key)
+		{
+			if (m_stack.empty())
+			{
+				m_stack.emplace_back(m_root);
+				return;
+			}
+
+			auto child = m_stack.back()->AddChild(new Metadata());
+			child->SetName(std::string(key));
+			m_stack.emplace_back(child);
+		}
+	};
+
+	static bool IsWhitespace(const char &c)
+	{
+		return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+	}
+
+	static const char *SkipWhitespace(const char *data, const char *end)
+	{
+#if defined(ACID_SIMD_SSE)
+		// Indentation in pretty printed files comes in long runs, so check a block at a time once the run is long enough.
+		while (end - data >= 16 && IsWhitespace(*data))
+		{
+			__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+			__m128i whitespace = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(block, _mm_set1_epi8('\t'))),
+				_mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(block, _mm_set1_epi8('\r'))));
+			auto mask = static_cast<uint32_t>(~_mm_movemask_epi8(whitespace)) & 0xFFFF;
+
+			if (mask != 0)
+			{
+				return data + CountTrailingZeros(mask);
+			}
+
+			data += 16;
+		}
+#endif
+
+		while (data < end && IsWhitespace(*data))
+		{
+			data++;
+		}
+
+		return data;
+	}
+
+	/// Finds the closing quote of a string, data is the first character after the opening quote.
+	static const char *FindStringEnd(const char *data, const char *end)
+	{
+		while (data < end)
+		{
+#if defined(ACID_SIMD_SSE)
+			if (end - data >= 16)
+			{
+				__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+				auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('\"')),
+					_mm_cmpeq_epi8(block, _mm_set1_epi8('\\')))));
+
+				if (mask == 0)
+				{
+					data += 16;
+					continue;
+				}
+
+				data += CountTrailingZeros(mask);
+			}
+#endif
+
+			if (*data == '\"')
+			{
+				return data;
+			}
+
+			if (*data == '\\')
+			{
+				// Skips the escaped character, which may be a quote.
+				data++;
+			}
+
+			data++;
+		}
+
+		return nullptr;
+	}
+
+	/// Finds the end of a number or literal, any delimiter ends it.
+	static const char *FindScalarEnd(const char *data, const char *end)
+	{
+		while (data < end && *data != ',' && *data != '}' && *data != ']' && *data != ':' && !IsWhitespace(*data))
+		{
+			data++;
+		}
+
+		return data;
+	}
+
+	bool JsonParser::Parse(const std::string_view &json, IJsonHandler &handler)
+	{
+		const char *begin = json.data();
+		const char *end = begin + json.size();
+		const char *data = SkipWhitespace(begin, end);
+
+		// Each open container, true for objects and false for arrays.
+		std::vector<bool> stack;
+		std::string_view key;
+		// A value was just read, so only a comma or the close of its container may follow.
+		bool valueSeen = false;
+		// A comma was just read, so a value has to follow.
+		bool commaSeen = false;
+
+		auto error = [&begin, &data](const char *message)
+		{
+			Log::Error("JSON parse error at offset %i: %s\n", static_cast<int32_t>(data - begin), message);
+			return false;
+		};
+
+		if (data == end || (*data != '{' && *data != '['))
+		{
+			return error("expected an object or array");
+		}
+
+		do
+		{
+			data = SkipWhitespace(data, end);
+
+			if (data == end)
+			{
+				return error("unexpected end of text");
+			}
+
+			char c = *data;
+
+			if (!stack.empty())
+			{
+				if (c == ',')
+				{
+					if (!valueSeen)
+					{
+						return error("expected a value before the comma");
+					}
+
+					valueSeen = false;
+					commaSeen = true;
+					data++;
+					continue;
+				}
+
+				if (c == (stack.back() ? '}' : ']'))
+				{
+					if (commaSeen)
+					{
+						return error("expected a value after the comma");
+					}
+
+					if (stack.back())
+					{
+						handler.OnObjectEnd();
+					}
+					else
+					{
+						handler.OnArrayEnd();
+					}
+
+					// The closed container is itself a value of its parent.
+					stack.pop_back();
+					valueSeen = true;
+					data++;
+					continue;
+				}
+
+				if (valueSeen)
+				{
+					return error(stack.back() ? "expected a comma or the end of the object" : "expected a comma or the end of the array");
+				}
+
+				key = std::string_view();
+
+				if (stack.back())
+				{
+					// Members of an object are a quoted key, a colon, then the value.
+					if (c != '\"')
+					{
+						return error("expected a key");
+					}
+
+					const char *keyEnd = FindStringEnd(data + 1, end);
+
+					if (keyEnd == nullptr)
+					{
+						return error("unterminated key");
+					}
+
+					key = std::string_view(data + 1, static_cast<std::size_t>(keyEnd - data - 1));
+					data = SkipWhitespace(keyEnd + 1, end);
+
+					if (data == end || *data != ':')
+					{
+						return error("expected a colon");
+					}
+
+					data = SkipWhitespace(data + 1, end);
+
+					if (data == end)
+					{
+						return error("unexpected end of text");
+					}
+
+					c = *data;
+				}
+			}
+
+			commaSeen = false;
+
+			if (c == '{')
+			{
+				handler.OnObjectStart(key);
+				stack.emplace_back(true);
+				data++;
+			}
+			else if (c == '[')
+			{
+				handler.OnArrayStart(key);
+				stack.emplace_back(false);
+				data++;
+			}
+			else if (c == '\"')
+			{
+				const char *stringEnd = FindStringEnd(data + 1, end);
+
+				if (stringEnd == nullptr)
+				{
+					return error("unterminated string");
+				}
+
+				handler.OnValue(key, std::string_view(data, static_cast<std::size_t>(stringEnd + 1 - data)));
+				data = stringEnd + 1;
+				valueSeen = true;
+			}
+			else
+			{
+				const char *scalarEnd = FindScalarEnd(data, end);
+
+				if (scalarEnd == data)
+				{
+					return error("expected a value");
+				}
+
+				handler.OnValue(key, std::string_view(data, static_cast<std::size_t>(scalarEnd - data)));
+				data = scalarEnd;
+				valueSeen = true;
+			}
+		}
+		while (!stack.empty());
+
+		return true;
+	}
+
+	bool JsonParser::Parse(const std::string_view &json, Metadata &parent)
+	{
+		MetadataJsonHandler handler = MetadataJsonHandler(&parent);
+		return Parse(json, handler);
+	}
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string_view>
+#include "Serialized/Metadata.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// Receives the events of a streaming JSON parse.
+	/// Keys and values point into the parsed text, they are empty for array elements, and string values keep their quotes.
+	/// </summary>
+	class ACID_EXPORT IJsonHandler
+	{
+	public:
+		virtual void OnObjectStart(const std::string_view &key) = 0;
+
+		virtual void OnObjectEnd() = 0;
+
+		virtual void OnArrayStart(const std::string_view &key) = 0;
+
+		virtual void OnArrayEnd() = 0;
+
+		virtual void OnValue(const std::string_view &key, const std::string_view &value) = 0;
+	};
+
+	/// <summary>
+	/// A single pass JSON parser that tokenizes the text in place.
+	/// String bodies and indentation are skipped 16 bytes at a time where SIMD is available.
+	/// </summary>
+	class ACID_EXPORT JsonParser
+	{
+	public:
+		/// <summary>
+		/// Parses JSON text, passing each token to a handler as it is found.
+		/// </summary>
+		/// <param name="json"> The text to parse, it is not copied. </param>
+		/// <param name="handler"> The handler to send events to. </param>
+		/// <returns> If the text was valid, the handler may have been sent events before an error was found. </returns>
+		static bool Parse(const std::string_view &json, IJsonHandler &handler);
+
+		/// <summary>
+		/// Parses JSON text into a metadata tree, the outermost object or array becomes the parent itself.
+		/// </summary>
+		/// <param name="json"> The text to parse. </param>
+		/// <param name="parent"> The metadata to fill. </param>
+		/// <returns> If the text was valid. </returns>
+		static bool Parse(const std::string_view &json, Metadata &parent);
+	};
+}
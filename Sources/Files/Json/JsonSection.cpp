@@ -1,6 +1,6 @@
 #include "JsonSection.hpp"
 
-#include "Helpers/String.hpp"
+#include <sstream>
 
 namespace acid
 {
@@ -36,7 +36,19 @@ namespace acid
 
 		builder << indents.str();
 
-		if (source.GetName().empty())
+		if (source.GetName().empty() && !source.GetValue().empty())
+		{
+			// An element of an array.
+			builder << source.GetValue();
+
+			if (!end)
+			{
+				builder << ", ";
+			}
+
+			builder << "\n";
+		}
+		else if (source.GetName().empty())
 		{
 			builder << openBrace << "\n";
 		}
@@ -75,38 +87,4 @@ namespace acid
 			}
 		}
 	}
-
-	Metadata *JsonSection::Convert(const JsonSection &source, Metadata *parent, const bool &isTopSection)
-	{
-		auto thisValue = parent;
-
-		if (!isTopSection)
-		{
-			thisValue = new Metadata(source.m_name, "");
-			parent->AddChild(thisValue);
-		}
-
-		auto contentSplit = String::Split(source.m_content, ",", true);
-
-		for (auto &data : contentSplit)
-		{
-			auto dataSplit = String::Split(data, ":", true);
-
-			if (dataSplit.size() != 2 || dataSplit.at(0).empty() || dataSplit.at(1).empty())
-			{
-				continue;
-			}
-
-			std::string name = dataSplit.at(0).substr(1, dataSplit.at(0).size() - 2);
-			auto newChild = new Metadata(name, dataSplit.at(1));
-			thisValue->AddChild(newChild);
-		}
-
-		for (auto &child : source.m_children)
-		{
-			Convert(*child, thisValue, false);
-		}
-
-		return thisValue;
-	}
 }
@@ -38,7 +38,5 @@ namespace acid
 		void SetContent(const std::string &content) { m_content = content; }
 
 		static void AppendData(const Metadata &source, std::stringstream &builder, const int32_t &indentation, const bool &end = false);
-
-		static Metadata *Convert(const JsonSection &source, Metadata *parent, const bool &isTopSection = true);
 	};
 }
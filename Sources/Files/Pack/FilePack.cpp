@@ -0,0 +1,389 @@
+#include "FilePack.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <vector>
+#include "Engine/Log.hpp"
+#include "Helpers/FileSystem.hpp"
+#include "Helpers/String.hpp"
+#include "Lz4.hpp"
+
+namespace acid
+{
+	const uint32_t FilePack::VERSION = 1;
+	const uint32_t FilePack::BLOCK_SIZE = 64 * 1024;
+
+	static const char MAGIC[4] = {'A', 'C', 'P', 'K'};
+	/// File data starts on page boundaries, so a slice of the mapping is as good as a mapping of the file alone.
+	static const uint64_t ALIGNMENT = 4096;
+	/// Set in a block size when the block did not compress and is stored as is.
+	static const uint32_t RAW_BLOCK = 0x80000000;
+
+	static bool IsSeparator(const char &c)
+	{
+		return c == '/' || c == '\\';
+	}
+
+	static std::string_view TrimPath(std::string_view path)
+	{
+		while (!path.empty() && IsSeparator(path.front()))
+		{
+			path.remove_prefix(1);
+		}
+
+		return path;
+	}
+
+	static bool PathEquals(const std::string_view &a, const std::string_view &b)
+	{
+		if (a.size() != b.size())
+		{
+			return false;
+		}
+
+		for (std::size_t i = 0; i < a.size(); i++)
+		{
+			if (a[i] != b[i] && !(IsSeparator(a[i]) && IsSeparator(b[i])))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	static uint64_t Align(const uint64_t &offset, const uint64_t &alignment)
+	{
+		return (offset + alignment - 1) & ~(alignment - 1);
+	}
+
+	static void Pad(std::ofstream &stream, const uint64_t &alignment)
+	{
+		auto position = static_cast<uint64_t>(stream.tellp());
+		static const char zeros[ALIGNMENT] = {};
+		stream.write(zeros, static_cast<std::streamsize>(Align(position, alignment) - position));
+	}
+
+	FilePack::FilePack(const std::string &filename) :
+		m_filename(filename),
+		m_mapping(FileBuffer::Map(filename)),
+		m_header(nullptr),
+		m_table(nullptr),
+		m_names(nullptr)
+	{
+		if (m_mapping == nullptr)
+		{
+			Log::Error("Could not map pack: '%s'\n", filename.c_str());
+			return;
+		}
+
+		auto size = static_cast<uint64_t>(m_mapping->GetSize());
+		auto header = reinterpret_cast<const Header *>(m_mapping->GetData());
+
+		if (size < sizeof(Header) || std::memcmp(header->m_magic, MAGIC, sizeof(MAGIC)) != 0 || header->m_version != VERSION)
+		{
+			Log::Error("Pack is not a version %i pack: '%s'\n", VERSION, filename.c_str());
+			return;
+		}
+
+		// The table is a power of two so probing can wrap with a mask, and has room for an empty slot so misses end early.
+		bool tableFits = header->m_tableOffset % alignof(Entry) == 0 && header->m_tableOffset <= size &&
+			header->m_tableSize <= (size - header->m_tableOffset) / sizeof(Entry);
+		bool namesFit = header->m_namesOffset <= size && header->m_namesSize <= size - header->m_namesOffset;
+
+		if (!tableFits || !namesFit || header->m_tableSize == 0 || (header->m_tableSize & (header->m_tableSize - 1)) != 0 ||
+			header->m_fileCount >= header->m_tableSize)
+		{
+			Log::Error("Pack has a corrupt table of contents: '%s'\n", filename.c_str());
+			return;
+		}
+
+		m_header = header;
+		m_table = reinterpret_cast<const Entry *>(m_mapping->GetData() + header->m_tableOffset);
+		m_names = m_mapping->GetData() + header->m_namesOffset;
+	}
+
+	std::shared_ptr<FileBuffer> FilePack::Read(const std::string_view &path) const
+	{
+		auto entry = Find(path);
+
+		if (entry == nullptr)
+		{
+			return nullptr;
+		}
+
+		auto size = static_cast<uint64_t>(m_mapping->GetSize());
+
+		if (entry->m_offset > size || entry->m_storedSize > size - entry->m_offset)
+		{
+			Log::Error("Pack entry '%.*s' is out of bounds: '%s'\n", static_cast<int32_t>(path.size()), path.data(), m_filename.c_str());
+			return nullptr;
+		}
+
+		if (entry->m_compression == PACK_COMPRESSION_NONE)
+		{
+			// Only the stored size was bounds checked, so the slice must not claim any more.
+			if (entry->m_size != entry->m_storedSize)
+			{
+				Log::Error("Pack entry '%.*s' has a corrupt size: '%s'\n", static_cast<int32_t>(path.size()), path.data(), m_filename.c_str());
+				return nullptr;
+			}
+
+			return FileBuffer::Slice(m_mapping, static_cast<std::size_t>(entry->m_offset), static_cast<std::size_t>(entry->m_size));
+		}
+
+		// Compressed files start with a block count and the stored size of every block.
+		const char *stored = m_mapping->GetData() + entry->m_offset;
+		uint64_t blockCount = (entry->m_size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+		uint32_t writtenCount;
+
+		if (entry->m_storedSize < sizeof(uint32_t) * (blockCount + 1) ||
+			(std::memcpy(&writtenCount, stored, sizeof(uint32_t)), writtenCount != blockCount))
+		{
+			Log::Error("Pack entry '%.*s' has a corrupt block table: '%s'\n", static_cast<int32_t>(path.size()), path.data(), m_filename.c_str());
+			return nullptr;
+		}
+
+		auto data = FileBuffer::AcquireHeap(static_cast<std::size_t>(entry->m_size));
+		uint64_t read = sizeof(uint32_t) * (blockCount + 1);
+		uint64_t written = 0;
+
+		for (uint64_t i = 0; i < blockCount; i++)
+		{
+			uint32_t blockSize;
+			std::memcpy(&blockSize, stored + sizeof(uint32_t) * (i + 1), sizeof(uint32_t));
+			bool raw = (blockSize & RAW_BLOCK) != 0;
+			blockSize &= ~RAW_BLOCK;
+			auto decompressedSize = static_cast<std::size_t>(std::min<uint64_t>(BLOCK_SIZE, entry->m_size - written));
+
+			bool valid = blockSize <= entry->m_storedSize - read;
+
+			if (valid && raw)
+			{
+				valid = blockSize == decompressedSize;
+
+				if (valid)
+				{
+					std::memcpy(data.data() + written, stored + read, blockSize);
+				}
+			}
+			else if (valid)
+			{
+				valid = Lz4::Decompress(stored + read, blockSize, data.data() + written, decompressedSize);
+			}
+
+			if (!valid)
+			{
+				Log::Error("Pack entry '%.*s' has a corrupt block: '%s'\n", static_cast<int32_t>(path.size()), path.data(), m_filename.c_str());
+				return nullptr;
+			}
+
+			read += blockSize;
+			written += decompressedSize;
+		}
+
+		return std::make_shared<FileBuffer>(std::move(data));
+	}
+
+	bool FilePack::Write(const std::string &filename, const std::string &directory, const bool &compress)
+	{
+		if (!FileSystem::IsDirectory(directory))
+		{
+			Log::Error("Can not pack '%s', it is not a directory\n", directory.c_str());
+			return false;
+		}
+
+		auto files = FileSystem::FilesInPath(directory);
+		std::sort(files.begin(), files.end());
+
+		std::ofstream stream(filename, std::ios::binary | std::ios::trunc);
+
+		if (!stream)
+		{
+			Log::Error("Could not open pack for writing: '%s'\n", filename.c_str());
+			return false;
+		}
+
+		Header header = {};
+		std::memcpy(header.m_magic, MAGIC, sizeof(MAGIC));
+		header.m_version = VERSION;
+		header.m_blockSize = BLOCK_SIZE;
+		stream.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+
+		std::vector<Entry> entries;
+		std::string names;
+		std::vector<char> compressed;
+		std::vector<uint32_t> blockSizes;
+
+		for (auto &file : files)
+		{
+			std::string name = String::ReplaceAll(file.substr(directory.size()), "\\", "/");
+			name = std::string(TrimPath(name));
+
+			// Packs are never nested, which also skips the pack being written when it is inside the directory.
+			if (name.empty() || String::Lowercase(FileSystem::FileSuffix(name)) == ".pack")
+			{
+				continue;
+			}
+
+			auto data = FileSystem::ReadBinaryFile(file);
+
+			if (!data)
+			{
+				Log::Error("Could not read '%s' while packing\n", file.c_str());
+				return false;
+			}
+
+			Pad(stream, ALIGNMENT);
+
+			Entry entry = {};
+			entry.m_hash = Hash(name);
+			entry.m_offset = static_cast<uint64_t>(stream.tellp());
+			entry.m_size = data->size();
+			entry.m_storedSize = data->size();
+			entry.m_nameOffset = static_cast<uint32_t>(names.size());
+			entry.m_nameLength = static_cast<uint32_t>(name.size());
+			entry.m_compression = PACK_COMPRESSION_NONE;
+			names += name;
+
+			if (compress && !data->empty())
+			{
+				std::size_t blockCount = (data->size() + BLOCK_SIZE - 1) / BLOCK_SIZE;
+				blockSizes.clear();
+				compressed.clear();
+
+				for (std::size_t i = 0; i < blockCount; i++)
+				{
+					std::size_t offset = i * BLOCK_SIZE;
+					std::size_t size = std::min<std::size_t>(BLOCK_SIZE, data->size() - offset);
+					std::size_t start = compressed.size();
+					compressed.resize(start + Lz4::CompressBound(size));
+					std::size_t blockSize = Lz4::Compress(data->data() + offset, size, compressed.data() + start);
+
+					// Blocks that grow are kept as they are, so a pack is never much larger than its files.
+					if (blockSize >= size)
+					{
+						std::memcpy(compressed.data() + start, data->data() + offset, size);
+						blockSize = size;
+						blockSizes.emplace_back(static_cast<uint32_t>(size) | RAW_BLOCK);
+					}
+					else
+					{
+						blockSizes.emplace_back(static_cast<uint32_t>(blockSize));
+					}
+
+					compressed.resize(start + blockSize);
+				}
+
+				auto storedSize = sizeof(uint32_t) * (blockCount + 1) + compressed.size();
+
+				if (storedSize <= data->size() - data->size() / 8)
+				{
+					auto count = static_cast<uint32_t>(blockCount);
+					stream.write(reinterpret_cast<const char *>(&count), sizeof(uint32_t));
+					stream.write(reinterpret_cast<const char *>(blockSizes.data()), static_cast<std::streamsize>(sizeof(uint32_t) * blockSizes.size()));
+					stream.write(compressed.data(), static_cast<std::streamsize>(compressed.size()));
+					entry.m_storedSize = storedSize;
+					entry.m_compression = PACK_COMPRESSION_LZ4;
+				}
+			}
+
+			if (entry.m_compression == PACK_COMPRESSION_NONE)
+			{
+				stream.write(data->data(), static_cast<std::streamsize>(data->size()));
+			}
+
+			entries.emplace_back(entry);
+		}
+
+		// At most half full, so lookups that miss stop after a few probes.
+		uint32_t tableSize = 1;
+
+		while (tableSize < entries.size() * 2 + 1)
+		{
+			tableSize <<= 1;
+		}
+
+		std::vector<Entry> table(tableSize, Entry{});
+
+		for (auto &entry : entries)
+		{
+			auto slot = static_cast<uint32_t>(entry.m_hash) & (tableSize - 1);
+
+			while (table[slot].m_nameLength != 0)
+			{
+				slot = (slot + 1) & (tableSize - 1);
+			}
+
+			table[slot] = entry;
+		}
+
+		header.m_namesOffset = static_cast<uint64_t>(stream.tellp());
+		header.m_namesSize = names.size();
+		stream.write(names.data(), static_cast<std::streamsize>(names.size()));
+		Pad(stream, alignof(Entry));
+
+		header.m_fileCount = static_cast<uint32_t>(entries.size());
+		header.m_tableSize = tableSize;
+		header.m_tableOffset = static_cast<uint64_t>(stream.tellp());
+		stream.write(reinterpret_cast<const char *>(table.data()), static_cast<std::streamsize>(sizeof(Entry) * table.size()));
+
+		stream.seekp(0);
+		stream.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+		stream.close();
+
+		if (!stream)
+		{
+			Log::Error("Could not write pack: '%s'\n", filename.c_str());
+			return false;
+		}
+
+		return true;
+	}
+
+	uint64_t FilePack::Hash(const std::string_view &path)
+	{
+		uint64_t hash = 14695981039346656037ull;
+
+		for (auto c : TrimPath(path))
+		{
+			hash ^= static_cast<uint8_t>(IsSeparator(c) ? '/' : c);
+			hash *= 1099511628211ull;
+		}
+
+		return hash;
+	}
+
+	const FilePack::Entry *FilePack::Find(const std::string_view &path) const
+	{
+		if (m_table == nullptr)
+		{
+			return nullptr;
+		}
+
+		std::string_view name = TrimPath(path);
+		uint64_t hash = Hash(name);
+		uint32_t mask = m_header->m_tableSize - 1;
+
+		auto slot = static_cast<uint32_t>(hash) & mask;
+
+		// Empty slots have no name and end a miss, a corrupt table may have none so probing also stops after every slot.
+		for (uint32_t probe = 0; probe < m_header->m_tableSize && m_table[slot].m_nameLength != 0; probe++, slot = (slot + 1) & mask)
+		{
+			auto &entry = m_table[slot];
+
+			if (entry.m_hash != hash || static_cast<uint64_t>(entry.m_nameOffset) + entry.m_nameLength > m_header->m_namesSize)
+			{
+				continue;
+			}
+
+			if (PathEquals(name, std::string_view(m_names + entry.m_nameOffset, entry.m_nameLength)))
+			{
+				return &entry;
+			}
+		}
+
+		return nullptr;
+	}
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include "Files/FileBuffer.hpp"
+
+namespace acid
+{
+	enum PackCompression
+	{
+		PACK_COMPRESSION_NONE = 0,
+		PACK_COMPRESSION_LZ4 = 1
+	};
+
+	/// <summary>
+	/// A read only archive of many files, opened with a single mapping and searched through a hashed table of contents.
+	/// Stored files are handed out as slices of the mapping, compressed files are split into blocks that decompress into pooled buffers.
+	/// The layout is a header, the file data aligned to pages, the names, then the table.
+	/// Numbers are in the byte order of the host that packed them (little endian on every supported target), as the header and table are read in place from the mapping.
+	/// A pack opened on a host of the other byte order fails the version check instead of being misread.
+	/// </summary>
+	class ACID_EXPORT FilePack
+	{
+	public:
+		static const uint32_t VERSION;
+		static const uint32_t BLOCK_SIZE;
+
+		struct Header
+		{
+			char m_magic[4];
+			uint32_t m_version;
+			uint32_t m_fileCount;
+			uint32_t m_tableSize;
+			uint64_t m_tableOffset;
+			uint64_t m_namesOffset;
+			uint64_t m_namesSize;
+			uint32_t m_blockSize;
+			uint32_t m_reserved;
+		};
+
+		struct Entry
+		{
+			uint64_t m_hash;
+			uint64_t m_offset;
+			uint64_t m_size;
+			uint64_t m_storedSize;
+			uint32_t m_nameOffset;
+			uint32_t m_nameLength;
+			uint32_t m_compression;
+			uint32_t m_reserved;
+		};
+	private:
+		std::string m_filename;
+		std::shared_ptr<FileBuffer> m_mapping;
+		const Header *m_header;
+		const Entry *m_table;
+		const char *m_names;
+	public:
+		/// <summary>
+		/// Opens a pack, check <seealso cref="#IsValid()"/> before reading from it.
+		/// </summary>
+		/// <param name="filename"> The real path of the pack. </param>
+		explicit FilePack(const std::string &filename);
+
+		/// <summary>
+		/// Gets if the pack was mapped and its header and table are well formed.
+		/// </summary>
+		/// <returns> If the pack can be read. </returns>
+		bool IsValid() const { return m_table != nullptr; }
+
+		/// <summary>
+		/// Gets if a file is in the pack.
+		/// </summary>
+		/// <param name="path"> The path of the file, relative to the packed directory. </param>
+		/// <returns> If the file was found. </returns>
+		bool Contains(const std::string_view &path) const { return Find(path) != nullptr; }
+
+		/// <summary>
+		/// Reads a file from the pack.
+		/// </summary>
+		/// <param name="path"> The path of the file, relative to the packed directory. </param>
+		/// <returns> The file, or nullptr if it is not in the pack or its data is corrupt. </returns>
+		std::shared_ptr<FileBuffer> Read(const std::string_view &path) const;
+
+		/// <summary>
+		/// Writes every file under a directory into a new pack.
+		/// </summary>
+		/// <param name="filename"> The pack to write. </param>
+		/// <param name="directory"> The directory to pack, paths in the pack are relative to it. </param>
+		/// <param name="compress"> If files are compressed, those that do not get at least an eighth smaller are stored anyway. </param>
+		/// <returns> If the pack was written. </returns>
+		static bool Write(const std::string &filename, const std::string &directory, const bool &compress = true);
+
+		/// <summary>
+		/// Hashes a path the way the table of contents does, separators are unified and leading separators ignored.
+		/// </summary>
+		/// <param name="path"> The path to hash. </param>
+		/// <returns> The 64 bit FNV-1a hash. </returns>
+		static uint64_t Hash(const std::string_view &path);
+
+		const std::string &GetFilename() const { return m_filename; }
+
+		uint32_t GetFileCount() const { return m_header != nullptr ? m_header->m_fileCount : 0; }
+	private:
+		const Entry *Find(const std::string_view &path) const;
+	};
+}
@@ -0,0 +1,224 @@
+#include "Lz4.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace acid
+{
+	static const std::size_t MIN_MATCH = 4;
+	/// The format requires the last 5 bytes to be literals and the last match to start at least 12 bytes from the end.
+	static const std::size_t LAST_LITERALS = 5;
+	static const std::size_t MATCH_FIND_LIMIT = 12;
+	static const std::size_t MAX_OFFSET = 65535;
+	static const uint32_t HASH_BITS = 12;
+
+	static uint32_t Read32(const uint8_t *data)
+	{
+		uint32_t value;
+		std::memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	static uint32_t Hash(const uint32_t &sequence)
+	{
+		return (sequence * 2654435761u) >> (32 - HASH_BITS);
+	}
+
+	static uint8_t *WriteLength(uint8_t *output, std::size_t length)
+	{
+		while (length >= 255)
+		{
+			*output++ = 255;
+			length -= 255;
+		}
+
+		*output++ = static_cast<uint8_t>(length);
+		return output;
+	}
+
+	static uint8_t *WriteSequence(uint8_t *output, const uint8_t *literals, const std::size_t &literalLength, const std::size_t &offset, const std::size_t &matchLength)
+	{
+		uint8_t *token = output++;
+		*token = static_cast<uint8_t>(std::min<std::size_t>(literalLength, 15) << 4);
+
+		if (literalLength >= 15)
+		{
+			output = WriteLength(output, literalLength - 15);
+		}
+
+		if (literalLength != 0)
+		{
+			std::memcpy(output, literals, literalLength);
+			output += literalLength;
+		}
+
+		// The last sequence is only literals.
+		if (matchLength == 0)
+		{
+			return output;
+		}
+
+		*output++ = static_cast<uint8_t>(offset & 0xFF);
+		*output++ = static_cast<uint8_t>(offset >> 8);
+
+		std::size_t length = matchLength - MIN_MATCH;
+		*token |= static_cast<uint8_t>(std::min<std::size_t>(length, 15));
+
+		if (length >= 15)
+		{
+			output = WriteLength(output, length - 15);
+		}
+
+		return output;
+	}
+
+	std::size_t Lz4::CompressBound(const std::size_t &size)
+	{
+		return size + size / 255 + 16;
+	}
+
+	std::size_t Lz4::Compress(const char *source, const std::size_t &size, char *destination)
+	{
+		auto input = reinterpret_cast<const uint8_t *>(source);
+		auto output = reinterpret_cast<uint8_t *>(destination);
+		std::size_t anchor = 0;
+
+		if (size > MATCH_FIND_LIMIT)
+		{
+			// Positions are stored plus one, so zero means empty.
+			std::vector<uint32_t> table(1 << HASH_BITS, 0);
+			std::size_t position = 0;
+
+			while (position < size - MATCH_FIND_LIMIT)
+			{
+				uint32_t sequence = Read32(input + position);
+				uint32_t &entry = table[Hash(sequence)];
+				std::size_t candidate = entry;
+				entry = static_cast<uint32_t>(position + 1);
+
+				if (candidate == 0 || position - (candidate - 1) > MAX_OFFSET || Read32(input + candidate - 1) != sequence)
+				{
+					position++;
+					continue;
+				}
+
+				std::size_t reference = candidate - 1;
+				std::size_t length = MIN_MATCH;
+
+				while (position + length < size - LAST_LITERALS && input[reference + length] == input[position + length])
+				{
+					length++;
+				}
+
+				output = WriteSequence(output, input + anchor, position - anchor, position - reference, length);
+				position += length;
+				anchor = position;
+			}
+		}
+
+		output = WriteSequence(output, input + anchor, size - anchor, 0, 0);
+		return static_cast<std::size_t>(output - reinterpret_cast<uint8_t *>(destination));
+	}
+
+	bool Lz4::Decompress(const char *source, const std::size_t &size, char *destination, const std::size_t &decompressedSize)
+	{
+		auto input = reinterpret_cast<const uint8_t *>(source);
+		auto inputEnd = input + size;
+		auto output = reinterpret_cast<uint8_t *>(destination);
+		auto outputBegin = output;
+		auto outputEnd = output + decompressedSize;
+
+		auto readLength = [&input, &inputEnd](std::size_t &length)
+		{
+			uint8_t byte;
+
+			do
+			{
+				if (input >= inputEnd)
+				{
+					return false;
+				}
+
+				byte = *input++;
+				length += byte;
+			}
+			while (byte == 255);
+
+			return true;
+		};
+
+		while (input < inputEnd)
+		{
+			uint8_t token = *input++;
+			std::size_t literalLength = token >> 4;
+
+			if (literalLength == 15 && !readLength(literalLength))
+			{
+				return false;
+			}
+
+			if (literalLength > static_cast<std::size_t>(inputEnd - input) || literalLength > static_cast<std::size_t>(outputEnd - output))
+			{
+				return false;
+			}
+
+			if (literalLength != 0)
+			{
+				std::memcpy(output, input, literalLength);
+				input += literalLength;
+				output += literalLength;
+			}
+
+			if (input == inputEnd)
+			{
+				break;
+			}
+
+			if (inputEnd - input < 2)
+			{
+				return false;
+			}
+
+			std::size_t offset = input[0] | (input[1] << 8);
+			input += 2;
+
+			if (offset == 0 || offset > static_cast<std::size_t>(output - outputBegin))
+			{
+				return false;
+			}
+
+			std::size_t matchLength = token & 15;
+
+			if (matchLength == 15 && !readLength(matchLength))
+			{
+				return false;
+			}
+
+			matchLength += MIN_MATCH;
+
+			if (matchLength > static_cast<std::size_t>(outputEnd - output))
+			{
+				return false;
+			}
+
+			const uint8_t *match = output - offset;
+
+			if (offset >= matchLength)
+			{
+				std::memcpy(output, match, matchLength);
+				output += matchLength;
+			}
+			else
+			{
+				// Overlapping matches repeat the last offset bytes, so they are copied forwards one at a time.
+				for (std::size_t i = 0; i < matchLength; i++)
+				{
+					*output++ = *match++;
+				}
+			}
+		}
+
+		return output == outputEnd;
+	}
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// Compresses and decompresses single blocks in the LZ4 block format, fast enough to decompress faster than most disks read.
+	/// </summary>
+	class ACID_EXPORT Lz4
+	{
+	public:
+		/// <summary>
+		/// Gets the largest size a block of data can compress to.
+		/// </summary>
+		/// <param name="size"> The uncompressed size. </param>
+		/// <returns> The worst case compressed size. </returns>
+		static std::size_t CompressBound(const std::size_t &size);
+
+		/// <summary>
+		/// Compresses a block of data.
+		/// </summary>
+		/// <param name="source"> The data to compress. </param>
+		/// <param name="size"> The size of the data. </param>
+		/// <param name="destination"> Where to write the block, it must hold <seealso cref="#CompressBound()"/> bytes. </param>
+		/// <returns> The compressed size. </returns>
+		static std::size_t Compress(const char *source, const std::size_t &size, char *destination);
+
+		/// <summary>
+		/// Decompresses a block of data, every read and write is bounds checked so corrupt blocks fail rather than overrun.
+		/// </summary>
+		/// <param name="source"> The compressed block. </param>
+		/// <param name="size"> The size of the compressed block. </param>
+		/// <param name="destination"> Where to write the data. </param>
+		/// <param name="decompressedSize"> The exact size of the data once decompressed. </param>
+		/// <returns> If the block was valid and decompressed to exactly decompressedSize bytes. </returns>
+		static bool Decompress(const char *source, const std::size_t &size, char *destination, const std::size_t &decompressedSize);
+	};
+}
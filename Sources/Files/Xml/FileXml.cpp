@@ -4,6 +4,7 @@
 #include "Files/Files.hpp"
 #include "Helpers/FileSystem.hpp"
 #include "XmlNode.hpp"
+#include "XmlReader.hpp"
 
 namespace acid
 {
@@ -21,7 +22,7 @@ namespace acid
 
 		m_parent->ClearChildren();
 
-		auto fileLoaded = Files::Read(m_filename);
+		auto fileLoaded = Files::ReadBuffer(m_filename);
 
 		if (!fileLoaded)
 		{
@@ -29,65 +30,9 @@ namespace acid
 			return;
 		}
 
-		XmlNode *currentSection = nullptr;
-		std::stringstream summation;
-		bool end = false;
-
-		for (auto it = fileLoaded->begin(); it != fileLoaded->end(); ++it)
-		{
-			if (*it == '<')
-			{
-				if (*(it + 1) == '?') // Prolog.
-				{
-					currentSection = new XmlNode(nullptr, "", "");
-					continue;
-				}
-
-				if (*(it + 1) == '/') // End tag.
-				{
-					currentSection->SetContent(currentSection->GetContent() + summation.str());
-					end = true;
-				}
-				else // Start tag.
-				{
-					auto section = new XmlNode(currentSection, "", "");
-					currentSection->AddChild(section);
-					currentSection = section;
-				}
-
-				summation.str(std::string());
-			}
-			else if (*it == '>')
-			{
-				if (!end)
-				{
-					currentSection->SetAttributes(currentSection->GetAttributes() + summation.str());
-				}
-
-				summation.str(std::string());
-
-				if (end || *(it - 1) == '/') // End tag.
-				{
-					end = false;
-
-					if (currentSection->GetParent() != nullptr)
-					{
-						currentSection = currentSection->GetParent();
-					}
-				}
-			}
-			else if (*it == '\n')
-			{
-			}
-			else
-			{
-				summation << *it;
-			}
-		}
-
-		if (currentSection != nullptr)
+		if (!XmlReader::Parse(fileLoaded->GetView(), *m_parent))
 		{
-			XmlNode::Convert(*currentSection, m_parent.get(), true);
+			Log::Error("XML file could not be parsed: '%s'\n", m_filename.c_str());
 		}
 
 #if defined(ACID_VERBOSE)
@@ -69,84 +69,4 @@ namespace acid
 
 		builder << "</" << name << ">\n";
 	}
-
-	Metadata *XmlNode::Convert(const XmlNode &source, Metadata *parent, const bool &isTopSection)
-	{
-		auto thisValue = parent;
-
-		int32_t firstSpace = String::FindCharPos(source.m_attributes, ' ');
-		std::string name = String::Substring(source.m_attributes, 0, firstSpace);
-		name = String::Trim(name);
-		std::string attributes = String::Substring(source.m_attributes, firstSpace + 1, static_cast<int32_t>(source.m_attributes.size()));
-		attributes = String::Trim(attributes);
-
-		if (attributes[attributes.size() - 1] == '/' || attributes[attributes.size() - 1] == '?')
-		{
-			attributes.pop_back();
-		}
-
-		attributes = String::Trim(attributes);
-
-		std::map<std::string, std::string> parseAttributes = {};
-
-		if (!attributes.empty())
-		{
-			std::string currentKey;
-			std::string summation;
-
-			for (char &c : attributes)
-			{
-				switch (c)
-				{
-				case '"':
-				{
-					if (currentKey.empty())
-					{
-						currentKey = summation;
-						summation.clear();
-						continue;
-					}
-
-					parseAttributes.emplace(String::Trim(currentKey), String::Trim(summation));
-					currentKey.clear();
-					summation.clear();
-					break;
-				}
-				case '=':
-				{
-					if (!currentKey.empty())
-					{
-						summation += c;
-					}
-
-					break;
-				}
-				default:
-				{
-					summation += c;
-					break;
-				}
-				}
-			}
-		}
-
-		if (!isTopSection)
-		{
-			thisValue = new Metadata(name, source.m_content, parseAttributes);
-			parent->AddChild(thisValue);
-		}
-		else
-		{
-			parent->SetName(name);
-			parent->SetValue(source.m_content);
-			parent->SetAttributes(parseAttributes);
-		}
-
-		for (auto &child : source.m_children)
-		{
-			Convert(*child, thisValue, false);
-		}
-
-		return thisValue;
-	}
 }
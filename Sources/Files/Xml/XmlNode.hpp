@@ -38,7 +38,5 @@ namespace acid
 		void SetContent(const std::string &content) { m_content = content; }
 
 		static void AppendData(const Metadata &source, std::stringstream &builder, const int32_t &indentation);
-
-		static Metadata *Convert(const XmlNode &source, Metadata *parent, const bool &isTopSection);
 	};
 }
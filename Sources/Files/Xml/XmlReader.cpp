@@ -0,0 +1,350 @@
+#include "XmlReader.hpp"
+
+#include <cstring>
+#include "Engine/Log.hpp"
+
+namespace acid
+{
+	class MetadataXmlHandler :
+		public IXmlHandler
+	{
+	private:
+		std::vector<Metadata *> m_stack;
+	public:
+		explicit MetadataXmlHandler(Metadata *root) :
+			m_stack(std::vector<Metadata *>{root})
+		{
+		}
+
+		void OnDeclaration(const std::string_view &name, const XmlAttributes &attributes) override
+		{
+			if (m_stack.size() == 1)
+			{
+				m_stack.back()->SetName("?" + std::string(name));
+				SetAttributes(m_stack.back(), attributes);
+			}
+		}
+
+		void OnElementStart(const std::string_view &name, const XmlAttributes &attributes) override
+		{
+			auto child = m_stack.back()->AddChild(new Metadata());
+			child->SetName(std::string(name));
+			SetAttributes(child, attributes);
+			m_stack.emplace_back(child);
+		}
+
+		void OnElementEnd(const std::string_view &name) override
+		{
+			m_stack.pop_back();
+		}
+
+		void OnText(const std::string_view &text) override
+		{
+			if (m_stack.size() == 1)
+			{
+				return;
+			}
+
+			auto element = m_stack.back();
+
+			if (element->GetValue().empty())
+			{
+				element->SetValue(std::string(text));
+			}
+			else
+			{
+				element->SetValue(element->GetValue() + " " + std::string(text));
+			}
+		}
+	private:
+		static void SetAttributes(Metadata *metadata, const XmlAttributes &attributes)
+		{
+			std::map<std::string, std::string> map;
+
+			for (auto &[attribute, value] : attributes)
+			{
+				map.emplace(attribute, value);
+			}
+
+			metadata->SetAttributes(map);
+		}
+	};
+
+	static bool IsSpace(const char &c)
+	{
+		return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+	}
+
+	static const char *SkipSpace(const char *data, const char *end)
+	{
+		while (data < end && IsSpace(*data))
+		{
+			data++;
+		}
+
+		return data;
+	}
+
+	static const char *FindName(const char *data, const char *end)
+	{
+		while (data < end && !IsSpace(*data) && *data != '>' && *data != '/' && *data != '=' && *data != '?')
+		{
+			data++;
+		}
+
+		return data;
+	}
+
+	static const char *Find(const char *data, const char *end, const char *token)
+	{
+		std::string_view rest = std::string_view(data, static_cast<std::size_t>(end - data));
+		auto position = rest.find(token);
+		return position == std::string_view::npos ? nullptr : data + position;
+	}
+
+	static std::string_view Trim(const char *begin, const char *end)
+	{
+		while (begin < end && IsSpace(*begin))
+		{
+			begin++;
+		}
+
+		while (end > begin && IsSpace(*(end - 1)))
+		{
+			end--;
+		}
+
+		return std::string_view(begin, static_cast<std::size_t>(end - begin));
+	}
+
+	XmlReader::XmlReader(const std::string_view &xml) :
+		m_begin(xml.data()),
+		m_data(xml.data()),
+		m_end(xml.data() + xml.size()),
+		m_pendingEnd(false),
+		m_name(std::string_view()),
+		m_text(std::string_view()),
+		m_attributes(XmlAttributes())
+	{
+	}
+
+	XmlToken XmlReader::Next()
+	{
+		if (m_pendingEnd)
+		{
+			m_pendingEnd = false;
+			return XML_TOKEN_ELEMENT_END;
+		}
+
+		while (m_data < m_end)
+		{
+			if (*m_data != '<')
+			{
+				// Text runs to the next tag, memchr finds it a vector at a time on common C libraries.
+				auto next = static_cast<const char *>(std::memchr(m_data, '<', static_cast<std::size_t>(m_end - m_data)));
+				const char *textEnd = next != nullptr ? next : m_end;
+				m_text = Trim(m_data, textEnd);
+				m_data = textEnd;
+
+				if (!m_text.empty())
+				{
+					return XML_TOKEN_TEXT;
+				}
+
+				continue;
+			}
+
+			if (m_end - m_data >= 4 && std::memcmp(m_data, "<!--", 4) == 0)
+			{
+				auto commentEnd = Find(m_data + 4, m_end, "-->");
+
+				if (commentEnd == nullptr)
+				{
+					return Error("unterminated comment");
+				}
+
+				m_data = commentEnd + 3;
+				continue;
+			}
+
+			if (m_end - m_data >= 9 && std::memcmp(m_data, "<![CDATA[", 9) == 0)
+			{
+				auto dataEnd = Find(m_data + 9, m_end, "]]>");
+
+				if (dataEnd == nullptr)
+				{
+					return Error("unterminated CDATA section");
+				}
+
+				m_text = std::string_view(m_data + 9, static_cast<std::size_t>(dataEnd - m_data - 9));
+				m_data = dataEnd + 3;
+				return XML_TOKEN_TEXT;
+			}
+
+			if (m_end - m_data >= 2 && m_data[1] == '!')
+			{
+				auto declarationEnd = static_cast<const char *>(std::memchr(m_data, '>', static_cast<std::size_t>(m_end - m_data)));
+
+				if (declarationEnd == nullptr)
+				{
+					return Error("unterminated declaration");
+				}
+
+				m_data = declarationEnd + 1;
+				continue;
+			}
+
+			if (m_end - m_data >= 2 && m_data[1] == '/')
+			{
+				auto tagEnd = static_cast<const char *>(std::memchr(m_data, '>', static_cast<std::size_t>(m_end - m_data)));
+
+				if (tagEnd == nullptr)
+				{
+					return Error("unterminated end tag");
+				}
+
+				m_name = Trim(m_data + 2, tagEnd);
+				m_data = tagEnd + 1;
+				return XML_TOKEN_ELEMENT_END;
+			}
+
+			return ReadTag();
+		}
+
+		return XML_TOKEN_END;
+	}
+
+	XmlToken XmlReader::ReadTag()
+	{
+		bool declaration = m_end - m_data >= 2 && m_data[1] == '?';
+		const char *data = m_data + (declaration ? 2 : 1);
+		const char *nameEnd = FindName(data, m_end);
+
+		if (nameEnd == data)
+		{
+			return Error("expected an element name");
+		}
+
+		m_name = std::string_view(data, static_cast<std::size_t>(nameEnd - data));
+		m_attributes.clear();
+		data = nameEnd;
+
+		while (true)
+		{
+			data = SkipSpace(data, m_end);
+
+			if (data == m_end)
+			{
+				return Error("unterminated tag");
+			}
+
+			if (*data == '>' && !declaration)
+			{
+				m_data = data + 1;
+				return XML_TOKEN_ELEMENT_START;
+			}
+
+			if ((*data == '/' || *data == '?') && m_end - data >= 2 && data[1] == '>')
+			{
+				m_data = data + 2;
+
+				if (declaration)
+				{
+					return XML_TOKEN_DECLARATION;
+				}
+
+				m_pendingEnd = *data == '/';
+				return XML_TOKEN_ELEMENT_START;
+			}
+
+			// An attribute, a name, an equals sign and a quoted value.
+			const char *attributeEnd = FindName(data, m_end);
+
+			if (attributeEnd == data)
+			{
+				return Error("expected an attribute");
+			}
+
+			std::string_view attribute = std::string_view(data, static_cast<std::size_t>(attributeEnd - data));
+			data = SkipSpace(attributeEnd, m_end);
+
+			if (data == m_end || *data != '=')
+			{
+				return Error("expected '=' after an attribute");
+			}
+
+			data = SkipSpace(data + 1, m_end);
+
+			if (data == m_end || (*data != '\"' && *data != '\''))
+			{
+				return Error("expected a quoted attribute value");
+			}
+
+			auto valueEnd = static_cast<const char *>(std::memchr(data + 1, *data, static_cast<std::size_t>(m_end - data - 1)));
+
+			if (valueEnd == nullptr)
+			{
+				return Error("unterminated attribute value");
+			}
+
+			m_attributes.emplace_back(attribute, std::string_view(data + 1, static_cast<std::size_t>(valueEnd - data - 1)));
+			data = valueEnd + 1;
+		}
+	}
+
+	XmlToken XmlReader::Error(const char *message)
+	{
+		Log::Error("XML parse error at offset %i: %s\n", static_cast<int32_t>(m_data - m_begin), message);
+		m_data = m_end;
+		return XML_TOKEN_ERROR;
+	}
+
+	bool XmlReader::Parse(const std::string_view &xml, IXmlHandler &handler)
+	{
+		XmlReader reader = XmlReader(xml);
+		std::vector<std::string_view> open;
+
+		while (true)
+		{
+			switch (reader.Next())
+			{
+			case XML_TOKEN_END:
+				if (!open.empty())
+				{
+					Log::Error("XML parse error: '%.*s' is never closed\n", static_cast<int32_t>(open.back().size()), open.back().data());
+					return false;
+				}
+
+				return true;
+			case XML_TOKEN_ERROR:
+				return false;
+			case XML_TOKEN_DECLARATION:
+				handler.OnDeclaration(reader.GetName(), reader.GetAttributes());
+				break;
+			case XML_TOKEN_ELEMENT_START:
+				open.emplace_back(reader.GetName());
+				handler.OnElementStart(reader.GetName(), reader.GetAttributes());
+				break;
+			case XML_TOKEN_ELEMENT_END:
+				if (open.empty() || open.back() != reader.GetName())
+				{
+					Log::Error("XML parse error: unexpected end tag '%.*s'\n", static_cast<int32_t>(reader.GetName().size()), reader.GetName().data());
+					return false;
+				}
+
+				open.pop_back();
+				handler.OnElementEnd(reader.GetName());
+				break;
+			case XML_TOKEN_TEXT:
+				handler.OnText(reader.GetText());
+				break;
+			}
+		}
+	}
+
+	bool XmlReader::Parse(const std::string_view &xml, Metadata &parent)
+	{
+		MetadataXmlHandler handler = MetadataXmlHandler(&parent);
+		return Parse(xml, handler);
+	}
+}
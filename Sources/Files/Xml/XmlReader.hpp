@@ -0,0 +1,104 @@
+#pragma once
+
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "Serialized/Metadata.hpp"
+
+namespace acid
+{
+	enum XmlToken
+	{
+		XML_TOKEN_END = 0,
+		XML_TOKEN_ERROR = 1,
+		XML_TOKEN_DECLARATION = 2,
+		XML_TOKEN_ELEMENT_START = 3,
+		XML_TOKEN_ELEMENT_END = 4,
+		XML_TOKEN_TEXT = 5
+	};
+
+	typedef std::vector<std::pair<std::string_view, std::string_view>> XmlAttributes;
+
+	/// <summary>
+	/// Receives the events of a streaming XML parse, names and text point into the parsed text.
+	/// </summary>
+	class ACID_EXPORT IXmlHandler
+	{
+	public:
+		virtual void OnDeclaration(const std::string_view &name, const XmlAttributes &attributes) = 0;
+
+		virtual void OnElementStart(const std::string_view &name, const XmlAttributes &attributes) = 0;
+
+		virtual void OnElementEnd(const std::string_view &name) = 0;
+
+		virtual void OnText(const std::string_view &text) = 0;
+	};
+
+	/// <summary>
+	/// A pull parser that reads XML in place, one token per call to <seealso cref="#Next()"/>.
+	/// Names, attribute values and text are views into the source text, entities are left as written.
+	/// Comments and doctypes are skipped, CDATA sections are returned as text and self closing elements give a start and an end.
+	/// </summary>
+	class ACID_EXPORT XmlReader
+	{
+	private:
+		const char *m_begin;
+		const char *m_data;
+		const char *m_end;
+		bool m_pendingEnd;
+
+		std::string_view m_name;
+		std::string_view m_text;
+		XmlAttributes m_attributes;
+	public:
+		/// <summary>
+		/// Creates a new reader.
+		/// </summary>
+		/// <param name="xml"> The text to read, it is not copied and must outlive the reader. </param>
+		explicit XmlReader(const std::string_view &xml);
+
+		/// <summary>
+		/// Reads the next token, whitespace between elements is skipped.
+		/// </summary>
+		/// <returns> The token read, <seealso cref="XML_TOKEN_END"/> once the text runs out. </returns>
+		XmlToken Next();
+
+		/// <summary>
+		/// Gets the name of the current declaration or element.
+		/// </summary>
+		/// <returns> The name. </returns>
+		std::string_view GetName() const { return m_name; }
+
+		/// <summary>
+		/// Gets the current text, with surrounding whitespace removed.
+		/// </summary>
+		/// <returns> The text. </returns>
+		std::string_view GetText() const { return m_text; }
+
+		/// <summary>
+		/// Gets the attributes of the current declaration or start element.
+		/// </summary>
+		/// <returns> The attributes, in the order written. </returns>
+		const XmlAttributes &GetAttributes() const { return m_attributes; }
+
+		/// <summary>
+		/// Parses XML text, passing each token to a handler as it is found.
+		/// </summary>
+		/// <param name="xml"> The text to parse. </param>
+		/// <param name="handler"> The handler to send events to. </param>
+		/// <returns> If the text was valid. </returns>
+		static bool Parse(const std::string_view &xml, IXmlHandler &handler);
+
+		/// <summary>
+		/// Parses XML text into a metadata tree, the declaration becomes the parent and the elements its children.
+		/// </summary>
+		/// <param name="xml"> The text to parse. </param>
+		/// <param name="parent"> The metadata to fill. </param>
+		/// <returns> If the text was valid. </returns>
+		static bool Parse(const std::string_view &xml, Metadata &parent);
+	private:
+		XmlToken Error(const char *message);
+
+		XmlToken ReadTag();
+	};
+}
@@ -25,16 +25,8 @@ namespace acid
 			return nullptr;
 		}
 
-		auto resource = Resources::Get()->Get(filename);
-
-		if (resource != nullptr)
-		{
-			return std::dynamic_pointer_cast<FontMetafile>(resource);
-		}
-
-		auto result = std::make_shared<FontMetafile>(filename);
-		Resources::Get()->Add(std::dynamic_pointer_cast<IResource>(result));
-		return result;
+		// Goes through the loader so threads asking for the same file at once share one load.
+		return Resources::Get()->Wait(Resources::Get()->Load<FontMetafile>(filename));
 	}
 
 	FontMetafile::FontMetafile(const std::string &filename) :
@@ -38,9 +38,13 @@ namespace acid
 
 	FontType::FontType(const std::string &filename, const std::string &fontStyle) :
 		m_name(ToFilename(filename, fontStyle)),
-		m_texture(Texture::Resource(filename + "/" + fontStyle + ".png")),
-		m_metadata(FontMetafile::Resource(filename + "/" + fontStyle + ".fnt"))
+		m_texture(nullptr),
+		m_metadata(nullptr)
 	{
+		// The texture is decoded on a worker while the metafile is parsed on this thread.
+		auto texture = Resources::Get()->Load<Texture>(filename + "/" + fontStyle + ".png");
+		m_metadata = FontMetafile::Resource(filename + "/" + fontStyle + ".fnt");
+		m_texture = Resources::Get()->Wait(texture);
 	}
 
 	std::string FontType::ToFilename(const std::string &filename, const std::string &fontStyle)
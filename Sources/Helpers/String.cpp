@@ -1,9 +1,129 @@
 #include "String.hpp"
 
 #include <algorithm>
+#include <cstdlib>
 
 namespace acid
 {
+	static const double POWERS_OF_TEN[] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+
+	static bool IsSpace(const char &c)
+	{
+		return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+	}
+
+	static bool IsDigit(const char &c)
+	{
+		return c >= '0' && c <= '9';
+	}
+
+	/// Parses one number, the common short decimal case is exact in doubles and needs no library call.
+	static bool ParseNumber(const char *&data, const char *end, double &value)
+	{
+		const char *start = data;
+		bool negative = false;
+
+		if (data < end && (*data == '-' || *data == '+'))
+		{
+			negative = *data == '-';
+			data++;
+		}
+
+		uint64_t mantissa = 0;
+		int32_t digits = 0;
+		int32_t exponent = 0;
+
+		while (data < end && IsDigit(*data))
+		{
+			if (digits < 19)
+			{
+				mantissa = mantissa * 10 + static_cast<uint64_t>(*data - '0');
+				digits += mantissa != 0;
+			}
+			else
+			{
+				exponent++;
+			}
+
+			data++;
+		}
+
+		bool hasDigits = data != start + negative;
+
+		if (data < end && *data == '.')
+		{
+			data++;
+			const char *fraction = data;
+
+			while (data < end && IsDigit(*data))
+			{
+				if (digits < 19)
+				{
+					mantissa = mantissa * 10 + static_cast<uint64_t>(*data - '0');
+					digits += mantissa != 0;
+					exponent--;
+				}
+
+				data++;
+			}
+
+			hasDigits = hasDigits || data != fraction;
+		}
+
+		if (!hasDigits)
+		{
+			return false;
+		}
+
+		if (data < end && (*data == 'e' || *data == 'E'))
+		{
+			const char *exponentStart = data++;
+			bool exponentNegative = false;
+
+			if (data < end && (*data == '-' || *data == '+'))
+			{
+				exponentNegative = *data == '-';
+				data++;
+			}
+
+			if (data == end || !IsDigit(*data))
+			{
+				data = exponentStart;
+			}
+			else
+			{
+				int32_t explicitExponent = 0;
+
+				while (data < end && IsDigit(*data))
+				{
+					explicitExponent = std::min(explicitExponent * 10 + (*data - '0'), 100000);
+					data++;
+				}
+
+				exponent += exponentNegative ? -explicitExponent : explicitExponent;
+			}
+		}
+
+		if (mantissa < (1ull << 53) && exponent >= -22 && exponent <= 22)
+		{
+			value = static_cast<double>(mantissa);
+			value = exponent < 0 ? value / POWERS_OF_TEN[-exponent] : value * POWERS_OF_TEN[exponent];
+			value = negative ? -value : value;
+			return true;
+		}
+
+		// Long or extreme numbers are rare enough to leave to the C library, which needs a terminated copy.
+		char buffer[64];
+		auto length = std::min(static_cast<std::size_t>(data - start), sizeof(buffer) - 1);
+		std::memcpy(buffer, start, length);
+		buffer[length] = '\0';
+		value = std::strtod(buffer, nullptr);
+		return true;
+	}
+
 	std::vector<std::string> String::Split(const std::string &str, const std::string &sep, const bool &trim)
 	{
 		char *copy = (char *) malloc(strlen(str.c_str()) + 1);
@@ -158,4 +278,78 @@ namespace acid
 		std::transform(result.begin(), result.end(), result.begin(), ::toupper);
 		return result;
 	}
+
+	bool String::ParseFloats(const std::string_view &str, std::vector<float> &result)
+	{
+		const char *data = str.data();
+		const char *end = data + str.size();
+
+		while (true)
+		{
+			while (data < end && IsSpace(*data))
+			{
+				data++;
+			}
+
+			if (data == end)
+			{
+				return true;
+			}
+
+			double value;
+
+			if (!ParseNumber(data, end, value) || (data < end && !IsSpace(*data)))
+			{
+				return false;
+			}
+
+			result.emplace_back(static_cast<float>(value));
+		}
+	}
+
+	bool String::ParseIntegers(const std::string_view &str, std::vector<int32_t> &result)
+	{
+		const char *data = str.data();
+		const char *end = data + str.size();
+
+		while (true)
+		{
+			while (data < end && IsSpace(*data))
+			{
+				data++;
+			}
+
+			if (data == end)
+			{
+				return true;
+			}
+
+			bool negative = *data == '-';
+
+			if (*data == '-' || *data == '+')
+			{
+				data++;
+			}
+
+			if (data == end || !IsDigit(*data))
+			{
+				return false;
+			}
+
+			int64_t value = 0;
+
+			while (data < end && IsDigit(*data))
+			{
+				value = std::min(value * 10 + (*data - '0'), static_cast<int64_t>(INT32_MAX) + 1);
+				data++;
+			}
+
+			if (data < end && !IsSpace(*data))
+			{
+				return false;
+			}
+
+			result.emplace_back(static_cast<int32_t>(negative ? -value : value));
+		}
+	}
 }
@@ -4,6 +4,7 @@
 #include <locale>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <typeinfo>
 #include <vector>
 #include "Engine/Exports.hpp"
@@ -121,6 +122,22 @@ namespace acid
 		/// <returns> The uppercased string. </returns>
 		static std::string Uppercase(const std::string &str);
 
+		/// <summary>
+		/// Parses a whitespace separated list of floats, such as a COLLADA float_array, without splitting it into strings.
+		/// </summary>
+		/// <param name="str"> The list. </param>
+		/// <param name="result"> The vector to append the values to. </param>
+		/// <returns> If every entry was a number. </returns>
+		static bool ParseFloats(const std::string_view &str, std::vector<float> &result);
+
+		/// <summary>
+		/// Parses a whitespace separated list of integers without splitting it into strings.
+		/// </summary>
+		/// <param name="str"> The list. </param>
+		/// <param name="result"> The vector to append the values to. </param>
+		/// <returns> If every entry was an integer. </returns>
+		static bool ParseIntegers(const std::string_view &str, std::vector<int32_t> &result);
+
 		/// <summary>
 		/// Converts a tyoe to a string.
 		/// </summary>
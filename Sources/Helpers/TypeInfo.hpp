@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	using TypeId = uint64_t;
+
+	/// <summary>
+	/// A helper for compile time type identifiers. Ids are hashed from the type name,
+	/// so they match between the engine library and the application without RTTI.
+	/// </summary>
+	class ACID_EXPORT TypeInfo
+	{
+	public:
+		/// <summary>
+		/// Gets the compile time id of a type.
+		/// </summary>
+		/// <param name="T"> The type to get the id of. </param>
+		/// <returns> The types id. </returns>
+		template<typename T>
+		static constexpr TypeId GetTypeId()
+		{
+			return Id<T>;
+		}
+	private:
+		template<typename T>
+		static constexpr TypeId HashName()
+		{
+#if defined(ACID_BUILD_MSVC)
+			return Hash(__FUNCSIG__);
+#else
+			return Hash(__PRETTY_FUNCTION__);
+#endif
+		}
+
+		static constexpr TypeId Hash(const char *str)
+		{
+			// FNV-1a.
+			TypeId hash = 14695981039346656037ull;
+
+			while (*str != '\0')
+			{
+				hash ^= static_cast<uint8_t>(*str++);
+				hash *= 1099511628211ull;
+			}
+
+			return hash;
+		}
+
+		/// <summary>
+		/// The id of each type, a constant so the name is hashed once by the compiler rather than on every lookup.
+		/// </summary>
+		template<typename T>
+		static constexpr TypeId Id = HashName<T>();
+	};
+}
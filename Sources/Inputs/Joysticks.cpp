@@ -17,6 +17,12 @@ namespace acid
 
 	void Joysticks::Update()
 	{
+		// GLFW is never initialized for a headless display.
+		if (Display::Get()->IsHeadless())
+		{
+			return;
+		}
+
 		for (auto &joystick : m_connected)
 		{
 			if (glfwJoystickPresent(joystick.m_port))
@@ -29,7 +29,12 @@ namespace acid
 			m_keyboardKeys[i] = false;
 		}
 
-		// Sets the keyboards callbacks.
+		// Sets the keyboards callbacks, a headless display has no window to take input from.
+		if (Display::Get()->IsHeadless())
+		{
+			return;
+		}
+
 		glfwSetKeyCallback(Display::Get()->GetWindow(), CallbackKey);
 		glfwSetCharCallback(Display::Get()->GetWindow(), CallbackChar);
 	}
@@ -48,7 +48,12 @@ namespace acid
 			m_mouseButtons[i] = false;
 		}
 
-		// Sets the mouses callbacks.
+		// Sets the mouses callbacks, a headless display has no window to take input from.
+		if (Display::Get()->IsHeadless())
+		{
+			return;
+		}
+
 		glfwSetScrollCallback(Display::Get()->GetWindow(), CallbackScroll);
 		glfwSetMouseButtonCallback(Display::Get()->GetWindow(), CallbackMouseButton);
 		glfwSetCursorPosCallback(Display::Get()->GetWindow(), CallbackCursorPos);
@@ -88,6 +93,11 @@ namespace acid
 	{
 		m_mousePath = filename;
 
+		if (Display::Get()->IsHeadless())
+		{
+			return;
+		}
+
 		uint32_t width = 0;
 		uint32_t height = 0;
 		uint32_t components = 0;
@@ -110,7 +120,7 @@ namespace acid
 
 	void Mouse::SetCursorHidden(const bool &disabled)
 	{
-		if (m_cursorDisabled != disabled)
+		if (m_cursorDisabled != disabled && !Display::Get()->IsHeadless())
 		{
 			glfwSetInputMode(Display::Get()->GetWindow(), GLFW_CURSOR, (disabled ? GLFW_CURSOR_DISABLED : GLFW_CURSOR_NORMAL));
 
@@ -137,6 +147,12 @@ namespace acid
 	{
 		m_mousePositionX = cursorX;
 		m_mousePositionY = cursorY;
+
+		if (Display::Get()->IsHeadless())
+		{
+			return;
+		}
+
 		glfwSetCursorPos(Display::Get()->GetWindow(), cursorX * Display::Get()->GetWidth(), cursorY * Display::Get()->GetHeight());
 	}
 }
@@ -36,10 +36,15 @@ namespace acid
 		{
 			return false;
 		}
-		else if (m_renderStage != renderStage)
+		else if (m_renderStage.load(std::memory_order_acquire) != renderStage)
 		{
-			m_renderStage = renderStage;
-			m_pipeline = std::make_unique<Pipeline>(m_graphicsStage, m_pipelineCreate);
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			if (m_renderStage.load(std::memory_order_relaxed) != renderStage)
+			{
+				m_pipeline = std::make_unique<Pipeline>(m_graphicsStage, m_pipelineCreate);
+				m_renderStage.store(renderStage, std::memory_order_release);
+			}
 		}
 
 		m_pipeline->BindPipeline(commandBuffer);
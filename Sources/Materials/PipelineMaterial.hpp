@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <mutex>
 #include "Models/Model.hpp"
 #include "Renderer/Pipelines/Pipeline.hpp"
 #include "Renderer/RenderStage.hpp"
@@ -17,8 +19,10 @@ namespace acid
 		std::string m_filename;
 		GraphicsStage m_graphicsStage;
 		PipelineCreate m_pipelineCreate;
-		RenderStage *m_renderStage;
+		/// Materials are bound from every job recording meshes, the pipeline is only rebuilt under the mutex.
+		std::atomic<RenderStage *> m_renderStage;
 		std::unique_ptr<Pipeline> m_pipeline;
+		std::mutex m_mutex;
 	public:
 		/// <summary>
 		/// Will find an existing pipeline with the same stage and create info, or create a new pipeline.
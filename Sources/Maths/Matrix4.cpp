@@ -13,87 +13,6 @@ namespace acid
 	const Matrix4 Matrix4::IDENTITY = Matrix4(new float[16]{1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f});
 	const Matrix4 Matrix4::ZERO = Matrix4(0.0f);
 
-	Matrix4::Matrix4(const float &diagonal)
-	{
-		memset(m_rows, 0, 4 * sizeof(Vector4));
-		m_rows[0][0] = diagonal;
-		m_rows[1][1] = diagonal;
-		m_rows[2][2] = diagonal;
-		m_rows[3][3] = diagonal;
-	}
-
-	Matrix4::Matrix4(const Matrix4 &source)
-	{
-		memcpy(m_rows, source.m_rows, 4 * sizeof(Vector4));
-	}
-
-	Matrix4::Matrix4(const float *source)
-	{
-		memcpy(m_rows, source, 4 * 4 * sizeof(float));
-	}
-
-	Matrix4::Matrix4(const Vector4 *source)
-	{
-		memcpy(m_rows, source, 4 * sizeof(Vector4));
-	}
-
-	Matrix4 Matrix4::Add(const Matrix4 &other) const
-	{
-		Matrix4 result = Matrix4();
-
-		for (int32_t row = 0; row < 4; row++)
-		{
-			for (int32_t col = 0; col < 4; col++)
-			{
-				result[row][col] = m_rows[row][col] + other[row][col];
-			}
-		}
-
-		return result;
-	}
-
-	Matrix4 Matrix4::Subtract(const Matrix4 &other) const
-	{
-		Matrix4 result = Matrix4();
-
-		for (int32_t row = 0; row < 4; row++)
-		{
-			for (int32_t col = 0; col < 4; col++)
-			{
-				result[row][col] = m_rows[row][col] - other[row][col];
-			}
-		}
-
-		return result;
-	}
-
-	Matrix4 Matrix4::Multiply(const Matrix4 &other) const
-	{
-		Matrix4 result = Matrix4();
-
-		for (int32_t row = 0; row < 4; row++)
-		{
-			for (int32_t col = 0; col < 4; col++)
-			{
-				result[row][col] = m_rows[0][col] * other[row][0] + m_rows[1][col] * other[row][1] + m_rows[2][col] * other[row][2] + m_rows[3][col] * other[row][3];
-			}
-		}
-
-		return result;
-	}
-
-	Vector4 Matrix4::Multiply(const Vector4 &other) const
-	{
-		Vector4 result = Vector4();
-
-		for (int32_t row = 0; row < 4; row++)
-		{
-			result[row] = m_rows[0][row] * other.m_x + m_rows[1][row] * other.m_y + m_rows[2][row] * other.m_z + m_rows[3][row] * other.m_w;
-		}
-
-		return result;
-	}
-
 	Matrix4 Matrix4::Divide(const Matrix4 &other) const
 	{
 		Matrix4 result = Matrix4();
@@ -109,18 +28,6 @@ namespace acid
 		return result;
 	}
 
-	Vector4 Matrix4::Transform(const Vector4 &other) const
-	{
-		Vector4 result = Vector4();
-
-		for (int32_t row = 0; row < 4; row++)
-		{
-			result[row] = m_rows[0][row] * other.m_x + m_rows[1][row] * other.m_y + m_rows[2][row] * other.m_z + m_rows[3][row] * other.m_w;
-		}
-
-		return result;
-	}
-
 	Matrix4 Matrix4::Translate(const Vector2 &other) const
 	{
 		Matrix4 result = Matrix4(*this);
@@ -211,59 +118,45 @@ namespace acid
 		return result;
 	}
 
-	Matrix4 Matrix4::Negate() const
-	{
-		Matrix4 result = Matrix4();
-
-		for (int32_t row = 0; row < 4; row++)
-		{
-			for (int32_t col = 0; col < 4; col++)
-			{
-				result[row][col] = -m_rows[row][col];
-			}
-		}
-
-		return result;
-	}
-
 	Matrix4 Matrix4::Invert() const
 	{
-		Matrix4 result = Matrix4(*this);
-
-		float det = Determinant();
+		// Expands the cofactors from 2x2 sub-determinants shared between them, rather than taking sixteen 3x3 determinants.
+		const float *m = m_linear;
+		float s0 = m[0] * m[5] - m[4] * m[1];
+		float s1 = m[0] * m[6] - m[4] * m[2];
+		float s2 = m[0] * m[7] - m[4] * m[3];
+		float s3 = m[1] * m[6] - m[5] * m[2];
+		float s4 = m[1] * m[7] - m[5] * m[3];
+		float s5 = m[2] * m[7] - m[6] * m[3];
+		float c5 = m[10] * m[15] - m[14] * m[11];
+		float c4 = m[9] * m[15] - m[13] * m[11];
+		float c3 = m[9] * m[14] - m[13] * m[10];
+		float c2 = m[8] * m[15] - m[12] * m[11];
+		float c1 = m[8] * m[14] - m[12] * m[10];
+		float c0 = m[8] * m[13] - m[12] * m[9];
+
+		float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
 		assert(det != 0.0f && "Determinant cannot be zero!");
+		float invDet = 1.0f / det;
 
-		for (int32_t j = 0; j < 4; j++)
-		{
-			for (int32_t i = 0; i < 4; i++)
-			{
-				// Get minor of element [j][i] - not [i][j], this is where the transpose happens.
-				Matrix3 minorSubmatrix = GetSubmatrix(j, i);
-				float minor = minorSubmatrix.Determinant();
-
-				// Multiply by (−1)^{i+j}.
-				float factor = ((i + j) % 2 == 1) ? -1.0f : 1.0f;
-				float cofactor = minor * factor;
-
-				result[i][j] = cofactor / det;
-			}
-		}
-
-		return result;
-	}
-
-	Matrix4 Matrix4::Transpose() const
-	{
 		Matrix4 result = Matrix4();
-
-		for (int32_t row = 0; row < 4; row++)
-		{
-			for (int32_t col = 0; col < 4; col++)
-			{
-				result[row][col] = m_rows[col][row];
-			}
-		}
-
+		float *r = result.m_linear;
+		r[0] = (m[5] * c5 - m[6] * c4 + m[7] * c3) * invDet;
+		r[1] = (-m[1] * c5 + m[2] * c4 - m[3] * c3) * invDet;
+		r[2] = (m[13] * s5 - m[14] * s4 + m[15] * s3) * invDet;
+		r[3] = (-m[9] * s5 + m[10] * s4 - m[11] * s3) * invDet;
+		r[4] = (-m[4] * c5 + m[6] * c2 - m[7] * c1) * invDet;
+		r[5] = (m[0] * c5 - m[2] * c2 + m[3] * c1) * invDet;
+		r[6] = (-m[12] * s5 + m[14] * s2 - m[15] * s1) * invDet;
+		r[7] = (m[8] * s5 - m[10] * s2 + m[11] * s1) * invDet;
+		r[8] = (m[4] * c4 - m[5] * c2 + m[7] * c0) * invDet;
+		r[9] = (-m[0] * c4 + m[1] * c2 - m[3] * c0) * invDet;
+		r[10] = (m[12] * s4 - m[13] * s2 + m[15] * s0) * invDet;
+		r[11] = (-m[8] * s4 + m[9] * s2 - m[11] * s0) * invDet;
+		r[12] = (-m[4] * c3 + m[5] * c1 - m[6] * c0) * invDet;
+		r[13] = (m[0] * c3 - m[1] * c1 + m[2] * c0) * invDet;
+		r[14] = (-m[12] * s3 + m[13] * s1 - m[14] * s0) * invDet;
+		r[15] = (m[8] * s3 - m[9] * s1 + m[10] * s0) * invDet;
 		return result;
 	}
 
@@ -481,133 +374,6 @@ namespace acid
 		metadata.SetChild<Vector4>("m3", m_rows[3]);
 	}
 
-	bool Matrix4::operator==(const Matrix4 &other) const
-	{
-		return m_rows[0] == other[0] && m_rows[1] == other[1] && m_rows[2] == other[2] && m_rows[3] == other[3];
-	}
-
-	bool Matrix4::operator!=(const Matrix4 &other) const
-	{
-		return !(*this == other);
-	}
-
-	Matrix4 Matrix4::operator-() const
-	{
-		return Negate();
-	}
-
-	const Vector4 &Matrix4::operator[](const uint32_t &index) const
-	{
-		assert(index < 4);
-		return m_rows[index];
-	}
-
-	Vector4 &Matrix4::operator[](const uint32_t &index)
-	{
-		assert(index < 4);
-		return m_rows[index];
-	}
-
-	Matrix4 operator+(const Matrix4 &left, const Matrix4 &right)
-	{
-		return left.Add(right);
-	}
-
-	Matrix4 operator-(const Matrix4 &left, const Matrix4 &right)
-	{
-		return left.Subtract(right);
-	}
-
-	Matrix4 operator*(const Matrix4 &left, const Matrix4 &right)
-	{
-		return left.Multiply(right);
-	}
-
-	Matrix4 operator/(const Matrix4 &left, const Matrix4 &right)
-	{
-		return left.Divide(right);
-	}
-
-	Matrix4 operator*(const Vector4 &left, const Matrix4 &right)
-	{
-		return right.Scale(left);
-	}
-
-	Matrix4 operator/(const Vector4 &left, const Matrix4 &right)
-	{
-		return right.Scale(1.0f / left);
-	}
-
-	Matrix4 operator*(const Matrix4 &left, const Vector4 &right)
-	{
-		return left.Scale(right);
-	}
-
-	Matrix4 operator/(const Matrix4 &left, const Vector4 &right)
-	{
-		return left.Scale(1.0f / right);
-	}
-
-	Matrix4 operator*(const float &left, const Matrix4 &right)
-	{
-		return right.Scale(Vector4(left, left, left, left));
-	}
-
-	Matrix4 operator/(const float &left, const Matrix4 &right)
-	{
-		return right.Scale(1.0f / Vector4(left, left, left, left));
-	}
-
-	Matrix4 operator*(const Matrix4 &left, const float &right)
-	{
-		return left.Scale(Vector4(right, right, right, right));
-	}
-
-	Matrix4 operator/(const Matrix4 &left, const float &right)
-	{
-		return left.Scale(1.0f / Vector4(right, right, right, right));
-	}
-
-	Matrix4 &Matrix4::operator+=(const Matrix4 &other)
-	{
-		return *this = Add(other);
-	}
-
-	Matrix4 &Matrix4::operator-=(const Matrix4 &other)
-	{
-		return *this = Subtract(other);
-	}
-
-	Matrix4 &Matrix4::operator*=(const Matrix4 &other)
-	{
-		return *this = Multiply(other);
-	}
-
-	Matrix4 &Matrix4::operator/=(const Matrix4 &other)
-	{
-		return *this = Divide(other);
-	}
-
-	Matrix4 &Matrix4::operator*=(const Vector4 &other)
-	{
-		return *this = Scale(other);
-	}
-
-	Matrix4 &Matrix4::operator/=(const Vector4 &other)
-	{
-		return *this = Scale(1.0f / other);
-	}
-
-	Matrix4 &Matrix4::operator*=(const float &other)
-	{
-		return *this = Scale(Vector4(other, other, other, other));
-	}
-
-	Matrix4 &Matrix4::operator/=(const float &other)
-	{
-		return *this = Scale(1.0f / Vector4(other, other, other, other));
-	}
-
 	std::ostream &operator<<(std::ostream &stream, const Matrix4 &matrix)
 	{
 		stream << matrix.ToString();
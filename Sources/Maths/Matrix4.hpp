@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cassert>
+#include <cstring>
 #include <ostream>
 #include <string>
+#include "Simd.hpp"
 #include "Vector3.hpp"
 #include "Vector4.hpp"
 
@@ -105,6 +108,14 @@ namespace acid
 		/// <returns> The resultant vector. </returns>
 		Vector4 Transform(const Vector4 &other) const;
 
+		/// <summary>
+		/// Transforms an array of vectors by this matrix, the matrix rows are only loaded once for the whole batch.
+		/// </summary>
+		/// <param name="source"> The vectors to transform. </param>
+		/// <param name="destination"> The transformed vectors, may be the same array as the source. </param>
+		/// <param name="count"> The number of vectors. </param>
+		void Transform(const Vector4 *source, Vector4 *destination, const uint32_t &count) const;
+
 		/// <summary>
 		/// Translates this matrix by a vector.
 		/// </summary>
@@ -260,29 +271,29 @@ namespace acid
 
 		Vector4 &operator[](const uint32_t &index);
 
-		ACID_EXPORT friend Matrix4 operator+(const Matrix4 &left, const Matrix4 &right);
+		friend Matrix4 operator+(const Matrix4 &left, const Matrix4 &right) { return left.Add(right); }
 
-		ACID_EXPORT friend Matrix4 operator-(const Matrix4 &left, const Matrix4 &right);
+		friend Matrix4 operator-(const Matrix4 &left, const Matrix4 &right) { return left.Subtract(right); }
 
-		ACID_EXPORT friend Matrix4 operator*(const Matrix4 &left, const Matrix4 &right);
+		friend Matrix4 operator*(const Matrix4 &left, const Matrix4 &right) { return left.Multiply(right); }
 
-		ACID_EXPORT friend Matrix4 operator/(const Matrix4 &left, const Matrix4 &right);
+		friend Matrix4 operator/(const Matrix4 &left, const Matrix4 &right) { return left.Divide(right); }
 
-		ACID_EXPORT friend Matrix4 operator*(const Vector4 &left, const Matrix4 &right);
+		friend Matrix4 operator*(const Vector4 &left, const Matrix4 &right) { return right.Scale(left); }
 
-		ACID_EXPORT friend Matrix4 operator/(const Vector4 &left, const Matrix4 &right);
+		friend Matrix4 operator/(const Vector4 &left, const Matrix4 &right) { return right.Scale(1.0f / left); }
 
-		ACID_EXPORT friend Matrix4 operator*(const Matrix4 &left, const Vector4 &right);
+		friend Matrix4 operator*(const Matrix4 &left, const Vector4 &right) { return left.Scale(right); }
 
-		ACID_EXPORT friend Matrix4 operator/(const Matrix4 &left, const Vector4 &right);
+		friend Matrix4 operator/(const Matrix4 &left, const Vector4 &right) { return left.Scale(1.0f / right); }
 
-		ACID_EXPORT friend Matrix4 operator*(const float &left, const Matrix4 &right);
+		friend Matrix4 operator*(const float &left, const Matrix4 &right) { return right.Scale(Vector4(left, left, left, left)); }
 
-		ACID_EXPORT friend Matrix4 operator/(const float &left, const Matrix4 &right);
+		friend Matrix4 operator/(const float &left, const Matrix4 &right) { return right.Scale(1.0f / Vector4(left, left, left, left)); }
 
-		ACID_EXPORT friend Matrix4 operator*(const Matrix4 &left, const float &right);
+		friend Matrix4 operator*(const Matrix4 &left, const float &right) { return left.Scale(Vector4(right, right, right, right)); }
 
-		ACID_EXPORT friend Matrix4 operator/(const Matrix4 &left, const float &right);
+		friend Matrix4 operator/(const Matrix4 &left, const float &right) { return left.Scale(1.0f / Vector4(right, right, right, right)); }
 
 		Matrix4 &operator+=(const Matrix4 &other);
 
@@ -308,4 +319,235 @@ namespace acid
 
 		std::string ToString() const;
 	};
+
+	inline Matrix4::Matrix4(const float &diagonal)
+	{
+		memset(m_linear, 0, 16 * sizeof(float));
+		m_rows[0][0] = diagonal;
+		m_rows[1][1] = diagonal;
+		m_rows[2][2] = diagonal;
+		m_rows[3][3] = diagonal;
+	}
+
+	inline Matrix4::Matrix4(const Matrix4 &source)
+	{
+		memcpy(m_linear, source.m_linear, 16 * sizeof(float));
+	}
+
+	inline Matrix4::Matrix4(const float *source)
+	{
+		memcpy(m_linear, source, 16 * sizeof(float));
+	}
+
+	inline Matrix4::Matrix4(const Vector4 *source)
+	{
+		memcpy(m_linear, source[0].m_elements, 16 * sizeof(float));
+	}
+
+	inline Matrix4 Matrix4::Add(const Matrix4 &other) const
+	{
+		Matrix4 result = Matrix4();
+
+		for (int32_t row = 0; row < 4; row++)
+		{
+			for (int32_t col = 0; col < 4; col++)
+			{
+				result[row][col] = m_rows[row][col] + other[row][col];
+			}
+		}
+
+		return result;
+	}
+
+	inline Matrix4 Matrix4::Subtract(const Matrix4 &other) const
+	{
+		Matrix4 result = Matrix4();
+
+		for (int32_t row = 0; row < 4; row++)
+		{
+			for (int32_t col = 0; col < 4; col++)
+			{
+				result[row][col] = m_rows[row][col] - other[row][col];
+			}
+		}
+
+		return result;
+	}
+
+	inline Matrix4 Matrix4::Multiply(const Matrix4 &other) const
+	{
+		Matrix4 result = Matrix4();
+
+		// Each row of the result is this matrix's rows weighted by the matching row of the other matrix.
+		for (int32_t row = 0; row < 4; row++)
+		{
+			result.m_rows[row] = Transform(other.m_rows[row]);
+		}
+
+		return result;
+	}
+
+	inline Vector4 Matrix4::Multiply(const Vector4 &other) const
+	{
+		return Transform(other);
+	}
+
+	inline Vector4 Matrix4::Transform(const Vector4 &other) const
+	{
+		Vector4 result = Vector4();
+#if defined(ACID_SIMD_SSE)
+		__m128 sum = _mm_mul_ps(_mm_loadu_ps(m_rows[0].m_elements), _mm_set1_ps(other.m_x));
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(m_rows[1].m_elements), _mm_set1_ps(other.m_y)));
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(m_rows[2].m_elements), _mm_set1_ps(other.m_z)));
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(m_rows[3].m_elements), _mm_set1_ps(other.m_w)));
+		_mm_storeu_ps(result.m_elements, sum);
+#elif defined(ACID_SIMD_NEON)
+		float32x4_t sum = vmulq_n_f32(vld1q_f32(m_rows[0].m_elements), other.m_x);
+		sum = vmlaq_n_f32(sum, vld1q_f32(m_rows[1].m_elements), other.m_y);
+		sum = vmlaq_n_f32(sum, vld1q_f32(m_rows[2].m_elements), other.m_z);
+		sum = vmlaq_n_f32(sum, vld1q_f32(m_rows[3].m_elements), other.m_w);
+		vst1q_f32(result.m_elements, sum);
+#else
+		for (int32_t row = 0; row < 4; row++)
+		{
+			result[row] = m_rows[0][row] * other.m_x + m_rows[1][row] * other.m_y + m_rows[2][row] * other.m_z + m_rows[3][row] * other.m_w;
+		}
+#endif
+		return result;
+	}
+
+	inline void Matrix4::Transform(const Vector4 *source, Vector4 *destination, const uint32_t &count) const
+	{
+#if defined(ACID_SIMD_SSE)
+		__m128 row0 = _mm_loadu_ps(m_rows[0].m_elements);
+		__m128 row1 = _mm_loadu_ps(m_rows[1].m_elements);
+		__m128 row2 = _mm_loadu_ps(m_rows[2].m_elements);
+		__m128 row3 = _mm_loadu_ps(m_rows[3].m_elements);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			__m128 sum = _mm_mul_ps(row0, _mm_set1_ps(source[i].m_x));
+			sum = _mm_add_ps(sum, _mm_mul_ps(row1, _mm_set1_ps(source[i].m_y)));
+			sum = _mm_add_ps(sum, _mm_mul_ps(row2, _mm_set1_ps(source[i].m_z)));
+			sum = _mm_add_ps(sum, _mm_mul_ps(row3, _mm_set1_ps(source[i].m_w)));
+			_mm_storeu_ps(destination[i].m_elements, sum);
+		}
+#elif defined(ACID_SIMD_NEON)
+		float32x4_t row0 = vld1q_f32(m_rows[0].m_elements);
+		float32x4_t row1 = vld1q_f32(m_rows[1].m_elements);
+		float32x4_t row2 = vld1q_f32(m_rows[2].m_elements);
+		float32x4_t row3 = vld1q_f32(m_rows[3].m_elements);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			float32x4_t sum = vmulq_n_f32(row0, source[i].m_x);
+			sum = vmlaq_n_f32(sum, row1, source[i].m_y);
+			sum = vmlaq_n_f32(sum, row2, source[i].m_z);
+			sum = vmlaq_n_f32(sum, row3, source[i].m_w);
+			vst1q_f32(destination[i].m_elements, sum);
+		}
+#else
+		for (uint32_t i = 0; i < count; i++)
+		{
+			destination[i] = Transform(source[i]);
+		}
+#endif
+	}
+
+	inline Matrix4 Matrix4::Negate() const
+	{
+		Matrix4 result = Matrix4();
+
+		for (int32_t row = 0; row < 4; row++)
+		{
+			for (int32_t col = 0; col < 4; col++)
+			{
+				result[row][col] = -m_rows[row][col];
+			}
+		}
+
+		return result;
+	}
+
+	inline Matrix4 Matrix4::Transpose() const
+	{
+		Matrix4 result = Matrix4();
+
+		for (int32_t row = 0; row < 4; row++)
+		{
+			for (int32_t col = 0; col < 4; col++)
+			{
+				result[row][col] = m_rows[col][row];
+			}
+		}
+
+		return result;
+	}
+
+	inline bool Matrix4::operator==(const Matrix4 &other) const
+	{
+		return m_rows[0] == other[0] && m_rows[1] == other[1] && m_rows[2] == other[2] && m_rows[3] == other[3];
+	}
+
+	inline bool Matrix4::operator!=(const Matrix4 &other) const
+	{
+		return !(*this == other);
+	}
+
+	inline Matrix4 Matrix4::operator-() const
+	{
+		return Negate();
+	}
+
+	inline const Vector4 &Matrix4::operator[](const uint32_t &index) const
+	{
+		assert(index < 4);
+		return m_rows[index];
+	}
+
+	inline Vector4 &Matrix4::operator[](const uint32_t &index)
+	{
+		assert(index < 4);
+		return m_rows[index];
+	}
+
+	inline Matrix4 &Matrix4::operator+=(const Matrix4 &other)
+	{
+		return *this = Add(other);
+	}
+
+	inline Matrix4 &Matrix4::operator-=(const Matrix4 &other)
+	{
+		return *this = Subtract(other);
+	}
+
+	inline Matrix4 &Matrix4::operator*=(const Matrix4 &other)
+	{
+		return *this = Multiply(other);
+	}
+
+	inline Matrix4 &Matrix4::operator/=(const Matrix4 &other)
+	{
+		return *this = Divide(other);
+	}
+
+	inline Matrix4 &Matrix4::operator*=(const Vector4 &other)
+	{
+		return *this = Scale(other);
+	}
+
+	inline Matrix4 &Matrix4::operator/=(const Vector4 &other)
+	{
+		return *this = Scale(1.0f / other);
+	}
+
+	inline Matrix4 &Matrix4::operator*=(const float &other)
+	{
+		return *this = Scale(Vector4(other, other, other, other));
+	}
+
+	inline Matrix4 &Matrix4::operator/=(const float &other)
+	{
+		return *this = Scale(1.0f / Vector4(other, other, other, other));
+	}
 }
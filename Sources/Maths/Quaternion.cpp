@@ -13,22 +13,6 @@ namespace acid
 	const Quaternion Quaternion::POSITIVE_INFINITY = Quaternion(+std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity());
 	const Quaternion Quaternion::NEGATIVE_INFINITY = Quaternion(-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity());
 
-	Quaternion::Quaternion() :
-		m_x(0.0f),
-		m_y(0.0f),
-		m_z(0.0f),
-		m_w(1.0f)
-	{
-	}
-
-	Quaternion::Quaternion(const float &x, const float &y, const float &z, const float &w) :
-		m_x(x),
-		m_y(y),
-		m_z(z),
-		m_w(w)
-	{
-	}
-
 	Quaternion::Quaternion(const float &pitch, const float &yaw, const float &roll)
 	{
 		float halfPitch = pitch * DEG_TO_RAD * 0.5f;
@@ -56,14 +40,6 @@ namespace acid
 	{
 	}
 
-	Quaternion::Quaternion(const Quaternion &source) :
-		m_x(source.m_x),
-		m_y(source.m_y),
-		m_z(source.m_z),
-		m_w(source.m_w)
-	{
-	}
-
 	Quaternion::Quaternion(const Matrix4 &source)
 	{
 		float diagonal = source[0][0] + source[1][1] + source[2][2];
@@ -118,36 +94,6 @@ namespace acid
 		*this = rotation;
 	}
 
-	Quaternion Quaternion::Add(const Quaternion &other) const
-	{
-		return Quaternion(m_x + other.m_x, m_y + other.m_y, m_z + other.m_z, m_w + other.m_w);
-	}
-
-	Quaternion Quaternion::Subtract(const Quaternion &other) const
-	{
-		return Quaternion(m_x - other.m_x, m_y - other.m_y, m_z - other.m_z, m_w - other.m_w);
-	}
-
-	Quaternion Quaternion::Multiply(const Quaternion &other) const
-	{
-		return Quaternion(m_x * other.m_w + m_w * other.m_x + m_y * other.m_z - m_z * other.m_y,
-			m_y * other.m_w + m_w * other.m_y + m_z * other.m_x - m_x * other.m_z,
-			m_z * other.m_w + m_w * other.m_z + m_x * other.m_y - m_y * other.m_x,
-			m_w * other.m_w - m_x * other.m_x - m_y * other.m_y - m_z * other.m_z);
-	}
-
-	Vector3 Quaternion::Multiply(const Vector3 &other) const
-	{
-		//	Matrix4 rotation = left.ToRotationMatrix();
-		//	return right * rotation;
-
-		Vector3 q = Vector3(m_x, m_y, m_z);
-		Vector3 cross1 = q.Cross(other);
-		Vector3 cross2 = q.Cross(cross1);
-
-		return other + 2.0f * (cross1 * m_w + cross2);
-	}
-
 	Quaternion Quaternion::MultiplyInverse(const Quaternion &other) const
 	{
 		float n = other.LengthSquared();
@@ -159,79 +105,6 @@ namespace acid
 			(m_w * other.m_w + m_x * other.m_x + m_y * other.m_y + m_z * other.m_z) * n);
 	}
 
-	float Quaternion::Dot(const Quaternion &other) const
-	{
-		return m_w * other.m_w + m_x * other.m_x + m_y * other.m_y + m_z * other.m_z;
-	}
-
-	Quaternion Quaternion::Slerp(const Quaternion &other, const float &progression)
-	{
-		// Favor accuracy for native code builds.
-		float cosAngle = Dot(other);
-		float sign = 1.0f;
-
-		// Enable shortest path rotation.
-		if (cosAngle < 0.0f)
-		{
-			cosAngle = -cosAngle;
-			sign = -1.0f;
-		}
-
-		float angle = acosf(cosAngle);
-		float sinAngle = sinf(angle);
-		float t1, t2;
-
-		if (sinAngle > 0.001f)
-		{
-			float invSinAngle = 1.0f / sinAngle;
-			t1 = std::sin((1.0f - progression) * angle) * invSinAngle;
-			t2 = std::sin(progression * angle) * invSinAngle;
-		}
-		else
-		{
-			t1 = 1.0f - progression;
-			t2 = progression;
-		}
-
-		return *this * t1 + (other * sign) * t2;
-	}
-
-	Quaternion Quaternion::Scale(const float &scalar) const
-	{
-		return Quaternion(m_x * scalar, m_y * scalar, m_z * scalar, m_w * scalar);
-	}
-
-	Quaternion Quaternion::Negate() const
-	{
-		return Quaternion(-m_x, -m_y, -m_z, -m_w);
-	}
-
-	Quaternion Quaternion::Normalize() const
-	{
-		float l = Length();
-		return Quaternion(m_x / l, m_y / l, m_z / l, m_w / l);
-	}
-
-	float Quaternion::LengthSquared() const
-	{
-		return m_x * m_x + m_y * m_y + m_z * m_z + m_w * m_w;
-	}
-
-	float Quaternion::Length() const
-	{
-		return std::sqrt(LengthSquared());
-	}
-
-	float Quaternion::MaxComponent() const
-	{
-		return std::max(m_x, std::max(m_y, std::max(m_z, m_w)));
-	}
-
-	float Quaternion::MinComponent() const
-	{
-		return std::min(m_x, std::min(m_y, std::min(m_z, m_w)));
-	}
-
 	Matrix4 Quaternion::ToMatrix() const
 	{
 		float xSquared = m_x * m_x;
@@ -345,108 +218,6 @@ namespace acid
 		metadata.SetChild<float>("w", m_w);
 	}
 
-	bool Quaternion::operator==(const Quaternion &other) const
-	{
-		return m_x == other.m_x && m_y == other.m_x && m_z == other.m_z && m_w == other.m_w;
-	}
-
-	bool Quaternion::operator!=(const Quaternion &other) const
-	{
-		return !(*this == other);
-	}
-
-	bool Quaternion::operator<(const Quaternion &other) const
-	{
-		return m_x < other.m_x && m_y < other.m_y && m_z < other.m_z && m_w < other.m_w;
-	}
-
-	bool Quaternion::operator<=(const Quaternion &other) const
-	{
-		return m_x <= other.m_x && m_y <= other.m_y && m_z <= other.m_z && m_w <= other.m_w;
-	}
-
-	bool Quaternion::operator>(const Quaternion &other) const
-	{
-		return m_x > other.m_x && m_y > other.m_y && m_z > other.m_z && m_w > other.m_w;
-	}
-
-	bool Quaternion::operator>=(const Quaternion &other) const
-	{
-		return m_x >= other.m_x && m_y >= other.m_y && m_z >= other.m_z && m_w >= other.m_w;
-	}
-
-	bool Quaternion::operator==(const float &value) const
-	{
-		return m_x == value && m_y == value && m_z == value && m_w == value;
-	}
-
-	bool Quaternion::operator!=(const float &value) const
-	{
-		return !(*this == value);
-	}
-
-	Quaternion Quaternion::operator-() const
-	{
-		return Negate();
-	}
-
-	const float &Quaternion::operator[](const uint32_t &index) const
-	{
-		assert(index < 4);
-		return m_elements[index];
-	}
-
-	float &Quaternion::operator[](const uint32_t &index)
-	{
-		assert(index < 4);
-		return m_elements[index];
-	}
-
-	Quaternion operator+(const Quaternion &left, const Quaternion &right)
-	{
-		return left.Add(right);
-	}
-
-	Quaternion operator-(const Quaternion &left, const Quaternion &right)
-	{
-		return left.Subtract(right);
-	}
-
-	Quaternion operator*(const Quaternion &left, const Quaternion &right)
-	{
-		return left.Multiply(right);
-	}
-
-	Vector3 operator*(const Vector3 &left, const Quaternion &right)
-	{
-		return right.Multiply(left);
-	}
-
-	Vector3 operator*(const Quaternion &left, const Vector3 &right)
-	{
-		return left.Multiply(right);
-	}
-
-	Quaternion operator*(const float &left, const Quaternion &right)
-	{
-		return right.Scale(left);
-	}
-
-	Quaternion operator*(const Quaternion &left, const float &right)
-	{
-		return left.Scale(right);
-	}
-
-	Quaternion &Quaternion::operator*=(const Quaternion &other)
-	{
-		return *this = Multiply(other);
-	}
-
-	Quaternion &Quaternion::operator*=(const float &other)
-	{
-		return *this = Scale(other);
-	}
-
 	std::ostream &operator<<(std::ostream &stream, const Quaternion &quaternion)
 	{
 		stream << quaternion.ToString();
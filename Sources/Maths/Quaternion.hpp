@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <cassert>
+#include <cmath>
 #include <ostream>
 #include <string>
 #include "Matrix4.hpp"
@@ -41,7 +44,7 @@ namespace acid
 		/// <summary>
 		/// Constructor for Quaternion.
 		/// </summary>
-		Quaternion();
+		constexpr Quaternion();
 
 		/// <summary>
 		/// Constructor for Quaternion.
@@ -50,7 +53,7 @@ namespace acid
 		/// <param name="y"> Start y. </param>
 		/// <param name="z"> Start z. </param>
 		/// <param name="w"> Start w. </param>
-		Quaternion(const float &x, const float &y, const float &z, const float &w);
+		constexpr Quaternion(const float &x, const float &y, const float &z, const float &w);
 
 		/// <summary>
 		/// Constructor for Quaternion.
@@ -71,7 +74,7 @@ namespace acid
 		/// Constructor for Quaternion.
 		/// </summary>
 		/// <param name="source"> Creates this vector out of a existing one. </param>
-		Quaternion(const Quaternion &source);
+		constexpr Quaternion(const Quaternion &source);
 
 		/// <summary>
 		/// Constructor for Quaternion.
@@ -135,7 +138,7 @@ namespace acid
 		/// <param name="other"> The other quaternion. </param>
 		/// <param name="progression"> The progression. </param>
 		/// <returns> Left slerp right. </returns>
-		Quaternion Slerp(const Quaternion &other, const float &progression);
+		Quaternion Slerp(const Quaternion &other, const float &progression) const;
 
 		/// <summary>
 		/// Scales this quaternion by a scalar.
@@ -241,19 +244,19 @@ namespace acid
 
 		float &operator[](const uint32_t &index);
 
-		ACID_EXPORT friend Quaternion operator+(const Quaternion &left, const Quaternion &right);
+		friend Quaternion operator+(const Quaternion &left, const Quaternion &right) { return left.Add(right); }
 
-		ACID_EXPORT friend Quaternion operator-(const Quaternion &left, const Quaternion &right);
+		friend Quaternion operator-(const Quaternion &left, const Quaternion &right) { return left.Subtract(right); }
 
-		ACID_EXPORT friend Quaternion operator*(const Quaternion &left, const Quaternion &right);
+		friend Quaternion operator*(const Quaternion &left, const Quaternion &right) { return left.Multiply(right); }
 
-		ACID_EXPORT friend Vector3 operator*(const Vector3 &right, const Quaternion &left);
+		friend Vector3 operator*(const Vector3 &left, const Quaternion &right) { return right.Multiply(left); }
 
-		ACID_EXPORT friend Vector3 operator*(const Quaternion &left, const Vector3 &right);
+		friend Vector3 operator*(const Quaternion &left, const Vector3 &right) { return left.Multiply(right); }
 
-		ACID_EXPORT friend Quaternion operator*(const float &left, const Quaternion &right);
+		friend Quaternion operator*(const float &left, const Quaternion &right) { return right.Scale(left); }
 
-		ACID_EXPORT friend Quaternion operator*(const Quaternion &left, const float &right);
+		friend Quaternion operator*(const Quaternion &left, const float &right) { return left.Scale(right); }
 
 		Quaternion &operator*=(const Quaternion &other);
 
@@ -267,4 +270,198 @@ namespace acid
 
 		std::string ToString() const;
 	};
+
+	constexpr Quaternion::Quaternion() :
+		m_x(0.0f),
+		m_y(0.0f),
+		m_z(0.0f),
+		m_w(1.0f)
+	{
+	}
+
+	constexpr Quaternion::Quaternion(const float &x, const float &y, const float &z, const float &w) :
+		m_x(x),
+		m_y(y),
+		m_z(z),
+		m_w(w)
+	{
+	}
+
+	constexpr Quaternion::Quaternion(const Quaternion &source) :
+		m_x(source.m_x),
+		m_y(source.m_y),
+		m_z(source.m_z),
+		m_w(source.m_w)
+	{
+	}
+
+	inline Quaternion Quaternion::Add(const Quaternion &other) const
+	{
+		return Quaternion(m_x + other.m_x, m_y + other.m_y, m_z + other.m_z, m_w + other.m_w);
+	}
+
+	inline Quaternion Quaternion::Subtract(const Quaternion &other) const
+	{
+		return Quaternion(m_x - other.m_x, m_y - other.m_y, m_z - other.m_z, m_w - other.m_w);
+	}
+
+	inline Quaternion Quaternion::Multiply(const Quaternion &other) const
+	{
+		return Quaternion(m_x * other.m_w + m_w * other.m_x + m_y * other.m_z - m_z * other.m_y,
+			m_y * other.m_w + m_w * other.m_y + m_z * other.m_x - m_x * other.m_z,
+			m_z * other.m_w + m_w * other.m_z + m_x * other.m_y - m_y * other.m_x,
+			m_w * other.m_w - m_x * other.m_x - m_y * other.m_y - m_z * other.m_z);
+	}
+
+	inline Vector3 Quaternion::Multiply(const Vector3 &other) const
+	{
+		//	Matrix4 rotation = left.ToRotationMatrix();
+		//	return right * rotation;
+
+		Vector3 q = Vector3(m_x, m_y, m_z);
+		Vector3 cross1 = q.Cross(other);
+		Vector3 cross2 = q.Cross(cross1);
+
+		return other + 2.0f * (cross1 * m_w + cross2);
+	}
+
+	inline float Quaternion::Dot(const Quaternion &other) const
+	{
+		return m_w * other.m_w + m_x * other.m_x + m_y * other.m_y + m_z * other.m_z;
+	}
+
+	inline Quaternion Quaternion::Slerp(const Quaternion &other, const float &progression) const
+	{
+		float cosAngle = Dot(other);
+		float sign = 1.0f;
+
+		// Enable shortest path rotation.
+		if (cosAngle < 0.0f)
+		{
+			cosAngle = -cosAngle;
+			sign = -1.0f;
+		}
+
+		// The sine of the angle comes from the cosine, so only the two blend weights need a sin.
+		float sinAngle = std::sqrt(1.0f - cosAngle * cosAngle);
+		float t1, t2;
+
+		if (sinAngle > 0.001f)
+		{
+			float angle = std::atan2(sinAngle, cosAngle);
+			float invSinAngle = 1.0f / sinAngle;
+			t1 = std::sin((1.0f - progression) * angle) * invSinAngle;
+			t2 = std::sin(progression * angle) * invSinAngle;
+		}
+		else
+		{
+			t1 = 1.0f - progression;
+			t2 = progression;
+		}
+
+		return Quaternion(t1 * m_x + sign * t2 * other.m_x, t1 * m_y + sign * t2 * other.m_y, t1 * m_z + sign * t2 * other.m_z, t1 * m_w + sign * t2 * other.m_w);
+	}
+
+	inline Quaternion Quaternion::Scale(const float &scalar) const
+	{
+		return Quaternion(m_x * scalar, m_y * scalar, m_z * scalar, m_w * scalar);
+	}
+
+	inline Quaternion Quaternion::Negate() const
+	{
+		return Quaternion(-m_x, -m_y, -m_z, -m_w);
+	}
+
+	inline Quaternion Quaternion::Normalize() const
+	{
+		float l = Length();
+		return Quaternion(m_x / l, m_y / l, m_z / l, m_w / l);
+	}
+
+	inline float Quaternion::LengthSquared() const
+	{
+		return m_x * m_x + m_y * m_y + m_z * m_z + m_w * m_w;
+	}
+
+	inline float Quaternion::Length() const
+	{
+		return std::sqrt(LengthSquared());
+	}
+
+	inline float Quaternion::MaxComponent() const
+	{
+		return std::max(m_x, std::max(m_y, std::max(m_z, m_w)));
+	}
+
+	inline float Quaternion::MinComponent() const
+	{
+		return std::min(m_x, std::min(m_y, std::min(m_z, m_w)));
+	}
+
+	inline bool Quaternion::operator==(const Quaternion &other) const
+	{
+		return m_x == other.m_x && m_y == other.m_y && m_z == other.m_z && m_w == other.m_w;
+	}
+
+	inline bool Quaternion::operator!=(const Quaternion &other) const
+	{
+		return !(*this == other);
+	}
+
+	inline bool Quaternion::operator<(const Quaternion &other) const
+	{
+		return m_x < other.m_x && m_y < other.m_y && m_z < other.m_z && m_w < other.m_w;
+	}
+
+	inline bool Quaternion::operator<=(const Quaternion &other) const
+	{
+		return m_x <= other.m_x && m_y <= other.m_y && m_z <= other.m_z && m_w <= other.m_w;
+	}
+
+	inline bool Quaternion::operator>(const Quaternion &other) const
+	{
+		return m_x > other.m_x && m_y > other.m_y && m_z > other.m_z && m_w > other.m_w;
+	}
+
+	inline bool Quaternion::operator>=(const Quaternion &other) const
+	{
+		return m_x >= other.m_x && m_y >= other.m_y && m_z >= other.m_z && m_w >= other.m_w;
+	}
+
+	inline bool Quaternion::operator==(const float &value) const
+	{
+		return m_x == value && m_y == value && m_z == value && m_w == value;
+	}
+
+	inline bool Quaternion::operator!=(const float &value) const
+	{
+		return !(*this == value);
+	}
+
+	inline Quaternion Quaternion::operator-() const
+	{
+		return Negate();
+	}
+
+	inline const float &Quaternion::operator[](const uint32_t &index) const
+	{
+		assert(index < 4);
+		return m_elements[index];
+	}
+
+	inline float &Quaternion::operator[](const uint32_t &index)
+	{
+		assert(index < 4);
+		return m_elements[index];
+	}
+
+	inline Quaternion &Quaternion::operator*=(const Quaternion &other)
+	{
+		return *this = Multiply(other);
+	}
+
+	inline Quaternion &Quaternion::operator*=(const float &other)
+	{
+		return *this = Scale(other);
+	}
 }
@@ -0,0 +1,38 @@
+#pragma once
+
+// Selects the widest vector instruction set the compiler was allowed to use, maths hot paths check these before falling back to scalar code.
+#if defined(__AVX__)
+#include <immintrin.h>
+#define ACID_SIMD_AVX
+#define ACID_SIMD_SSE
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ACID_SIMD_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define ACID_SIMD_NEON
+#endif
+
+#include <cstdint>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace acid
+{
+	/// <summary>
+	/// Gets the index of the lowest set bit, used to find the first match in a vector compare mask.
+	/// </summary>
+	/// <param name="mask"> The mask, must not be zero. </param>
+	/// <returns> The index of the lowest set bit. </returns>
+	inline uint32_t CountTrailingZeros(const uint32_t &mask)
+	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, mask);
+		return static_cast<uint32_t>(index);
+#else
+		return static_cast<uint32_t>(__builtin_ctz(mask));
+#endif
+	}
+}
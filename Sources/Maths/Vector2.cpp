@@ -189,7 +189,7 @@ namespace acid
 
 	bool Vector2::operator==(const Vector2 &other) const
 	{
-		return m_x == other.m_x && m_y == other.m_x;
+		return m_x == other.m_x && m_y == other.m_y;
 	}
 
 	bool Vector2::operator!=(const Vector2 &other) const
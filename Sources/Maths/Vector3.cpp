@@ -22,20 +22,6 @@ namespace acid
 	const Vector3 Vector3::POSITIVE_INFINITY = Vector3(+std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity());
 	const Vector3 Vector3::NEGATIVE_INFINITY = Vector3(-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity());
 
-	Vector3::Vector3() :
-		m_x(0.0f),
-		m_y(0.0f),
-		m_z(0.0f)
-	{
-	}
-
-	Vector3::Vector3(const float &x, const float &y, const float &z) :
-		m_x(x),
-		m_y(y),
-		m_z(z)
-	{
-	}
-
 	Vector3::Vector3(const Vector2 &source, const float &z) :
 		m_x(source.m_x),
 		m_y(source.m_y),
@@ -43,13 +29,6 @@ namespace acid
 	{
 	}
 
-	Vector3::Vector3(const Vector3 &source) :
-		m_x(source.m_x),
-		m_y(source.m_y),
-		m_z(source.m_z)
-	{
-	}
-
 	Vector3::Vector3(const Vector4 &source) :
 		m_x(source.m_x),
 		m_y(source.m_y),
@@ -64,26 +43,6 @@ namespace acid
 	{
 	}
 
-	Vector3 Vector3::Add(const Vector3 &other) const
-	{
-		return Vector3(m_x + other.m_x, m_y + other.m_y, m_z + other.m_z);
-	}
-
-	Vector3 Vector3::Subtract(const Vector3 &other) const
-	{
-		return Vector3(m_x - other.m_x, m_y - other.m_y, m_z - other.m_z);
-	}
-
-	Vector3 Vector3::Multiply(const Vector3 &other) const
-	{
-		return Vector3(m_x * other.m_x, m_y * other.m_y, m_z * other.m_z);
-	}
-
-	Vector3 Vector3::Divide(const Vector3 &other) const
-	{
-		return Vector3(m_x / other.m_x, m_y / other.m_y, m_z / other.m_z);
-	}
-
 	float Vector3::Angle(const Vector3 &other) const
 	{
 		float dls = Dot(other) / (Length() * other.Length());
@@ -100,21 +59,6 @@ namespace acid
 		return std::acos(dls);
 	}
 
-	float Vector3::Dot(const Vector3 &other) const
-	{
-		return m_x * other.m_x + m_y * other.m_y;
-	}
-
-	Vector3 Vector3::Cross(const Vector3 &other) const
-	{
-		return Vector3(m_y * other.m_z - m_z * other.m_y, other.m_x * m_z - other.m_z * m_x, m_x * other.m_y - m_y * other.m_x);
-	}
-
-	Vector3 Vector3::Scale(const float &scalar) const
-	{
-		return Vector3(m_x * scalar, m_y * scalar, m_z * scalar);
-	}
-
 	Vector3 Vector3::Rotate(const Vector3 &rotation) const
 	{
 		Matrix4 matrix = Matrix4::TransformationMatrix(Vector3::ZERO, rotation, Vector3::ONE);
@@ -123,55 +67,11 @@ namespace acid
 		return Vector3(direction4.m_x, direction4.m_y, direction4.m_z);
 	}
 
-	Vector3 Vector3::Negate() const
-	{
-		return Vector3(-m_x, -m_y, -m_z);
-	}
-
-	Vector3 Vector3::Normalize() const
-	{
-		float l = Length();
-		return Vector3(m_x / l, m_y / l, m_z / l);
-	}
-
-	float Vector3::LengthSquared() const
-	{
-		return m_x * m_x + m_y * m_y + m_z * m_z;
-	}
-
-	float Vector3::Length() const
-	{
-		return std::sqrt(LengthSquared());
-	}
-
-	float Vector3::MaxComponent() const
-	{
-		return std::max(m_x, std::max(m_y, m_z));
-	}
-
-	float Vector3::MinComponent() const
-	{
-		return std::min(m_x, std::min(m_y, m_z));
-	}
-
 	Quaternion Vector3::ToQuaternion() const
 	{
 		return Quaternion(m_x, m_y, m_z);
 	}
 
-	float Vector3::DistanceSquared(const Vector3 &other) const
-	{
-		float dx = m_x - other.m_x;
-		float dy = m_y - other.m_y;
-		float dz = m_z - other.m_z;
-		return dx * dx + dy * dy + dz * dz;
-	}
-
-	float Vector3::Distance(const Vector3 &other) const
-	{
-		return std::sqrt(DistanceSquared(other));
-	}
-
 	Vector3 Vector3::DistanceVector(const Vector3 &other) const
 	{
 		float dx = m_x - other.m_x;
@@ -227,16 +127,6 @@ namespace acid
 		return l1 * p1.m_y + l2 * p2.m_y + l3 * p3.m_y;
 	}
 
-	Vector3 Vector3::MinVector(const Vector3 &a, const Vector3 &b)
-	{
-		return Vector3(std::min(a.m_x, b.m_x), std::min(a.m_y, b.m_y), std::min(a.m_z, b.m_z));
-	}
-
-	Vector3 Vector3::MaxVector(const Vector3 &a, const Vector3 &b)
-	{
-		return Vector3(std::max(a.m_x, b.m_x), std::max(a.m_y, b.m_y), std::max(a.m_z, b.m_z));
-	}
-
 	Vector3 Vector3::RandomUnitVector()
 	{
 		float theta = Maths::Random(0.0f, 1.0f) * 2.0f * PI;
@@ -318,163 +208,6 @@ namespace acid
 		metadata.SetChild<float>("z", m_z);
 	}
 
-	bool Vector3::operator==(const Vector3 &other) const
-	{
-		return m_x == other.m_x && m_y == other.m_x && m_z == other.m_z;
-	}
-
-	bool Vector3::operator!=(const Vector3 &other) const
-	{
-		return !(*this == other);
-	}
-
-	bool Vector3::operator<(const Vector3 &other) const
-	{
-		return m_x < other.m_x && m_y < other.m_y && m_z < other.m_z;
-	}
-
-	bool Vector3::operator<=(const Vector3 &other) const
-	{
-		return m_x <= other.m_x && m_y <= other.m_y && m_z <= other.m_z;
-	}
-
-	bool Vector3::operator>(const Vector3 &other) const
-	{
-		return m_x > other.m_x && m_y > other.m_y && m_z > other.m_z;
-	}
-
-	bool Vector3::operator>=(const Vector3 &other) const
-	{
-		return m_x >= other.m_x && m_y >= other.m_y && m_z >= other.m_z;
-	}
-
-	bool Vector3::operator==(const float &value) const
-	{
-		return m_x == value && m_y == value && m_z == value;
-	}
-
-	bool Vector3::operator!=(const float &value) const
-	{
-		return !(*this == value);
-	}
-
-	Vector3 Vector3::operator-() const
-	{
-		return Negate();
-	}
-
-	const float &Vector3::operator[](const uint32_t &index) const
-	{
-		assert(index < 3);
-		return m_elements[index];
-	}
-
-	float &Vector3::operator[](const uint32_t &index)
-	{
-		assert(index < 3);
-		return m_elements[index];
-	}
-
-	Vector3 operator+(const Vector3 &left, const Vector3 &right)
-	{
-		return left.Add(right);
-	}
-
-	Vector3 operator-(const Vector3 &left, const Vector3 &right)
-	{
-		return left.Subtract(right);
-	}
-
-	Vector3 operator*(const Vector3 &left, const Vector3 &right)
-	{
-		return left.Multiply(right);
-	}
-
-	Vector3 operator/(const Vector3 &left, const Vector3 &right)
-	{
-		return left.Divide(right);
-	}
-
-	Vector3 operator+(const float &left, const Vector3 &right)
-	{
-		return Vector3(left, left, left).Add(right);
-	}
-
-	Vector3 operator-(const float &left, const Vector3 &right)
-	{
-		return Vector3(left, left, left).Subtract(right);
-	}
-
-	Vector3 operator*(const float &left, const Vector3 &right)
-	{
-		return Vector3(left, left, left).Multiply(right);
-	}
-
-	Vector3 operator/(const float &left, const Vector3 &right)
-	{
-		return Vector3(left, left, left).Divide(right);
-	}
-
-	Vector3 operator+(const Vector3 &left, const float &right)
-	{
-		return left.Add(Vector3(right, right, right));
-	}
-
-	Vector3 operator-(const Vector3 &left, const float &right)
-	{
-		return left.Subtract(Vector3(right, right, right));
-	}
-
-	Vector3 operator*(const Vector3 &left, const float &right)
-	{
-		return left.Multiply(Vector3(right, right, right));
-	}
-
-	Vector3 operator/(const Vector3 &left, const float &right)
-	{
-		return left.Divide(Vector3(right, right, right));
-	}
-
-	Vector3 &Vector3::operator+=(const Vector3 &other)
-	{
-		return *this = Add(other);
-	}
-
-	Vector3 &Vector3::operator-=(const Vector3 &other)
-	{
-		return *this = Subtract(other);
-	}
-
-	Vector3 &Vector3::operator*=(const Vector3 &other)
-	{
-		return *this = Multiply(other);
-	}
-
-	Vector3 &Vector3::operator/=(const Vector3 &other)
-	{
-		return *this = Divide(other);
-	}
-
-	Vector3 &Vector3::operator+=(const float &other)
-	{
-		return *this = Add(Vector3(other, other, other));
-	}
-
-	Vector3 &Vector3::operator-=(const float &other)
-	{
-		return *this = Subtract(Vector3(other, other, other));
-	}
-
-	Vector3 &Vector3::operator*=(const float &other)
-	{
-		return *this = Multiply(Vector3(other, other, other));
-	}
-
-	Vector3 &Vector3::operator/=(const float &other)
-	{
-		return *this = Divide(Vector3(other, other, other));
-	}
-
 	std::ostream &operator<<(std::ostream &stream, const Vector3 &vector)
 	{
 		stream << vector.ToString();
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <cassert>
+#include <cmath>
 #include <ostream>
 #include <string>
 #include "Engine/Exports.hpp"
@@ -51,7 +54,7 @@ namespace acid
 		/// <summary>
 		/// Constructor for Vector3.
 		/// </summary>
-		Vector3();
+		constexpr Vector3();
 
 		/// <summary>
 		/// Constructor for Vector3.
@@ -59,7 +62,7 @@ namespace acid
 		/// <param name="x"> Start x. </param>
 		/// <param name="y"> Start y. </param>
 		/// <param name="z"> Start z. </param>
-		Vector3(const float &x, const float &y, const float &z);
+		constexpr Vector3(const float &x, const float &y, const float &z);
 
 		/// <summary>
 		/// Constructor for Vector3.
@@ -72,7 +75,7 @@ namespace acid
 		/// Constructor for Vector3.
 		/// </summary>
 		/// <param name="source"> Creates this vector out of a existing one. </param>
-		Vector3(const Vector3 &source);
+		constexpr Vector3(const Vector3 &source);
 
 		/// <summary>
 		/// Constructor for Vector3.
@@ -324,29 +327,29 @@ namespace acid
 
 		float &operator[](const uint32_t &index);
 
-		ACID_EXPORT friend Vector3 operator+(const Vector3 &left, const Vector3 &right);
+		friend Vector3 operator+(const Vector3 &left, const Vector3 &right) { return left.Add(right); }
 
-		ACID_EXPORT friend Vector3 operator-(const Vector3 &left, const Vector3 &right);
+		friend Vector3 operator-(const Vector3 &left, const Vector3 &right) { return left.Subtract(right); }
 
-		ACID_EXPORT friend Vector3 operator*(const Vector3 &left, const Vector3 &right);
+		friend Vector3 operator*(const Vector3 &left, const Vector3 &right) { return left.Multiply(right); }
 
-		ACID_EXPORT friend Vector3 operator/(const Vector3 &left, const Vector3 &right);
+		friend Vector3 operator/(const Vector3 &left, const Vector3 &right) { return left.Divide(right); }
 
-		ACID_EXPORT friend Vector3 operator+(const float &left, const Vector3 &right);
+		friend Vector3 operator+(const float &left, const Vector3 &right) { return Vector3(left, left, left).Add(right); }
 
-		ACID_EXPORT friend Vector3 operator-(const float &left, const Vector3 &right);
+		friend Vector3 operator-(const float &left, const Vector3 &right) { return Vector3(left, left, left).Subtract(right); }
 
-		ACID_EXPORT friend Vector3 operator*(const float &left, const Vector3 &right);
+		friend Vector3 operator*(const float &left, const Vector3 &right) { return Vector3(left, left, left).Multiply(right); }
 
-		ACID_EXPORT friend Vector3 operator/(const float &left, const Vector3 &right);
+		friend Vector3 operator/(const float &left, const Vector3 &right) { return Vector3(left, left, left).Divide(right); }
 
-		ACID_EXPORT friend Vector3 operator+(const Vector3 &left, const float &right);
+		friend Vector3 operator+(const Vector3 &left, const float &right) { return left.Add(Vector3(right, right, right)); }
 
-		ACID_EXPORT friend Vector3 operator-(const Vector3 &left, const float &right);
+		friend Vector3 operator-(const Vector3 &left, const float &right) { return left.Subtract(Vector3(right, right, right)); }
 
-		ACID_EXPORT friend Vector3 operator*(const Vector3 &left, const float &right);
+		friend Vector3 operator*(const Vector3 &left, const float &right) { return left.Multiply(Vector3(right, right, right)); }
 
-		ACID_EXPORT friend Vector3 operator/(const Vector3 &left, const float &right);
+		friend Vector3 operator/(const Vector3 &left, const float &right) { return left.Divide(Vector3(right, right, right)); }
 
 		Vector3 &operator+=(const Vector3 &other);
 
@@ -372,4 +375,211 @@ namespace acid
 
 		std::string ToString() const;
 	};
+
+	constexpr Vector3::Vector3() :
+		m_x(0.0f),
+		m_y(0.0f),
+		m_z(0.0f)
+	{
+	}
+
+	constexpr Vector3::Vector3(const float &x, const float &y, const float &z) :
+		m_x(x),
+		m_y(y),
+		m_z(z)
+	{
+	}
+
+	constexpr Vector3::Vector3(const Vector3 &source) :
+		m_x(source.m_x),
+		m_y(source.m_y),
+		m_z(source.m_z)
+	{
+	}
+
+	inline Vector3 Vector3::Add(const Vector3 &other) const
+	{
+		return Vector3(m_x + other.m_x, m_y + other.m_y, m_z + other.m_z);
+	}
+
+	inline Vector3 Vector3::Subtract(const Vector3 &other) const
+	{
+		return Vector3(m_x - other.m_x, m_y - other.m_y, m_z - other.m_z);
+	}
+
+	inline Vector3 Vector3::Multiply(const Vector3 &other) const
+	{
+		return Vector3(m_x * other.m_x, m_y * other.m_y, m_z * other.m_z);
+	}
+
+	inline Vector3 Vector3::Divide(const Vector3 &other) const
+	{
+		return Vector3(m_x / other.m_x, m_y / other.m_y, m_z / other.m_z);
+	}
+
+	inline float Vector3::Dot(const Vector3 &other) const
+	{
+		return m_x * other.m_x + m_y * other.m_y + m_z * other.m_z;
+	}
+
+	inline Vector3 Vector3::Cross(const Vector3 &other) const
+	{
+		return Vector3(m_y * other.m_z - m_z * other.m_y, other.m_x * m_z - other.m_z * m_x, m_x * other.m_y - m_y * other.m_x);
+	}
+
+	inline Vector3 Vector3::Scale(const float &scalar) const
+	{
+		return Vector3(m_x * scalar, m_y * scalar, m_z * scalar);
+	}
+
+	inline Vector3 Vector3::Negate() const
+	{
+		return Vector3(-m_x, -m_y, -m_z);
+	}
+
+	inline Vector3 Vector3::Normalize() const
+	{
+		float l = Length();
+		return Vector3(m_x / l, m_y / l, m_z / l);
+	}
+
+	inline float Vector3::LengthSquared() const
+	{
+		return m_x * m_x + m_y * m_y + m_z * m_z;
+	}
+
+	inline float Vector3::Length() const
+	{
+		return std::sqrt(LengthSquared());
+	}
+
+	inline float Vector3::MaxComponent() const
+	{
+		return std::max(m_x, std::max(m_y, m_z));
+	}
+
+	inline float Vector3::MinComponent() const
+	{
+		return std::min(m_x, std::min(m_y, m_z));
+	}
+
+	inline float Vector3::DistanceSquared(const Vector3 &other) const
+	{
+		float dx = m_x - other.m_x;
+		float dy = m_y - other.m_y;
+		float dz = m_z - other.m_z;
+		return dx * dx + dy * dy + dz * dz;
+	}
+
+	inline float Vector3::Distance(const Vector3 &other) const
+	{
+		return std::sqrt(DistanceSquared(other));
+	}
+
+	inline Vector3 Vector3::MinVector(const Vector3 &a, const Vector3 &b)
+	{
+		return Vector3(std::min(a.m_x, b.m_x), std::min(a.m_y, b.m_y), std::min(a.m_z, b.m_z));
+	}
+
+	inline Vector3 Vector3::MaxVector(const Vector3 &a, const Vector3 &b)
+	{
+		return Vector3(std::max(a.m_x, b.m_x), std::max(a.m_y, b.m_y), std::max(a.m_z, b.m_z));
+	}
+
+	inline bool Vector3::operator==(const Vector3 &other) const
+	{
+		return m_x == other.m_x && m_y == other.m_y && m_z == other.m_z;
+	}
+
+	inline bool Vector3::operator!=(const Vector3 &other) const
+	{
+		return !(*this == other);
+	}
+
+	inline bool Vector3::operator<(const Vector3 &other) const
+	{
+		return m_x < other.m_x && m_y < other.m_y && m_z < other.m_z;
+	}
+
+	inline bool Vector3::operator<=(const Vector3 &other) const
+	{
+		return m_x <= other.m_x && m_y <= other.m_y && m_z <= other.m_z;
+	}
+
+	inline bool Vector3::operator>(const Vector3 &other) const
+	{
+		return m_x > other.m_x && m_y > other.m_y && m_z > other.m_z;
+	}
+
+	inline bool Vector3::operator>=(const Vector3 &other) const
+	{
+		return m_x >= other.m_x && m_y >= other.m_y && m_z >= other.m_z;
+	}
+
+	inline bool Vector3::operator==(const float &value) const
+	{
+		return m_x == value && m_y == value && m_z == value;
+	}
+
+	inline bool Vector3::operator!=(const float &value) const
+	{
+		return !(*this == value);
+	}
+
+	inline Vector3 Vector3::operator-() const
+	{
+		return Negate();
+	}
+
+	inline const float &Vector3::operator[](const uint32_t &index) const
+	{
+		assert(index < 3);
+		return m_elements[index];
+	}
+
+	inline float &Vector3::operator[](const uint32_t &index)
+	{
+		assert(index < 3);
+		return m_elements[index];
+	}
+
+	inline Vector3 &Vector3::operator+=(const Vector3 &other)
+	{
+		return *this = Add(other);
+	}
+
+	inline Vector3 &Vector3::operator-=(const Vector3 &other)
+	{
+		return *this = Subtract(other);
+	}
+
+	inline Vector3 &Vector3::operator*=(const Vector3 &other)
+	{
+		return *this = Multiply(other);
+	}
+
+	inline Vector3 &Vector3::operator/=(const Vector3 &other)
+	{
+		return *this = Divide(other);
+	}
+
+	inline Vector3 &Vector3::operator+=(const float &other)
+	{
+		return *this = Add(Vector3(other, other, other));
+	}
+
+	inline Vector3 &Vector3::operator-=(const float &other)
+	{
+		return *this = Subtract(Vector3(other, other, other));
+	}
+
+	inline Vector3 &Vector3::operator*=(const float &other)
+	{
+		return *this = Multiply(Vector3(other, other, other));
+	}
+
+	inline Vector3 &Vector3::operator/=(const float &other)
+	{
+		return *this = Divide(Vector3(other, other, other));
+	}
 }
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <cassert>
+#include <cmath>
 #include <ostream>
 #include <string>
 #include "Engine/Exports.hpp"
@@ -41,7 +44,7 @@ namespace acid
 		/// <summary>
 		/// Constructor for Vector4.
 		/// </summary>
-		Vector4();
+		constexpr Vector4();
 
 		/// <summary>
 		/// Constructor for Vector4.
@@ -50,7 +53,7 @@ namespace acid
 		/// <param name="y"> Start y. </param>
 		/// <param name="z"> Start z. </param>
 		/// <param name="w"> Start w. </param>
-		Vector4(const float &x, const float &y, const float &z, const float &w);
+		constexpr Vector4(const float &x, const float &y, const float &z, const float &w);
 
 		/// <summary>
 		/// Constructor for Vector4.
@@ -63,7 +66,7 @@ namespace acid
 		/// Constructor for Vector4.
 		/// </summary>
 		/// <param name="source"> Creates this vector out of a existing one. </param>
-		Vector4(const Vector4 &source);
+		constexpr Vector4(const Vector4 &source);
 
 		/// <summary>
 		/// Constructor for Vector4.
@@ -227,29 +230,29 @@ namespace acid
 
 		float &operator[](const uint32_t &index);
 
-		ACID_EXPORT friend Vector4 operator+(const Vector4 &left, const Vector4 &right);
+		friend Vector4 operator+(const Vector4 &left, const Vector4 &right) { return left.Add(right); }
 
-		ACID_EXPORT friend Vector4 operator-(const Vector4 &left, const Vector4 &right);
+		friend Vector4 operator-(const Vector4 &left, const Vector4 &right) { return left.Subtract(right); }
 
-		ACID_EXPORT friend Vector4 operator*(const Vector4 &left, const Vector4 &right);
+		friend Vector4 operator*(const Vector4 &left, const Vector4 &right) { return left.Multiply(right); }
 
-		ACID_EXPORT friend Vector4 operator/(const Vector4 &left, const Vector4 &right);
+		friend Vector4 operator/(const Vector4 &left, const Vector4 &right) { return left.Divide(right); }
 
-		ACID_EXPORT friend Vector4 operator+(const float &left, const Vector4 &right);
+		friend Vector4 operator+(const float &left, const Vector4 &right) { return Vector4(left, left, left, left).Add(right); }
 
-		ACID_EXPORT friend Vector4 operator-(const float &left, const Vector4 &right);
+		friend Vector4 operator-(const float &left, const Vector4 &right) { return Vector4(left, left, left, left).Subtract(right); }
 
-		ACID_EXPORT friend Vector4 operator*(const float &left, const Vector4 &right);
+		friend Vector4 operator*(const float &left, const Vector4 &right) { return Vector4(left, left, left, left).Multiply(right); }
 
-		ACID_EXPORT friend Vector4 operator/(const float &left, const Vector4 &right);
+		friend Vector4 operator/(const float &left, const Vector4 &right) { return Vector4(left, left, left, left).Divide(right); }
 
-		ACID_EXPORT friend Vector4 operator+(const Vector4 &left, const float &right);
+		friend Vector4 operator+(const Vector4 &left, const float &right) { return left.Add(Vector4(right, right, right, right)); }
 
-		ACID_EXPORT friend Vector4 operator-(const Vector4 &left, const float &right);
+		friend Vector4 operator-(const Vector4 &left, const float &right) { return left.Subtract(Vector4(right, right, right, right)); }
 
-		ACID_EXPORT friend Vector4 operator*(const Vector4 &left, const float &right);
+		friend Vector4 operator*(const Vector4 &left, const float &right) { return left.Multiply(Vector4(right, right, right, right)); }
 
-		ACID_EXPORT friend Vector4 operator/(const Vector4 &left, const float &right);
+		friend Vector4 operator/(const Vector4 &left, const float &right) { return left.Divide(Vector4(right, right, right, right)); }
 
 		Vector4 &operator+=(const Vector4 &other);
 
@@ -275,4 +278,200 @@ namespace acid
 
 		std::string ToString() const;
 	};
+
+	constexpr Vector4::Vector4() :
+		m_x(0.0f),
+		m_y(0.0f),
+		m_z(0.0f),
+		m_w(1.0f)
+	{
+	}
+
+	constexpr Vector4::Vector4(const float &x, const float &y, const float &z, const float &w) :
+		m_x(x),
+		m_y(y),
+		m_z(z),
+		m_w(w)
+	{
+	}
+
+	constexpr Vector4::Vector4(const Vector4 &source) :
+		m_x(source.m_x),
+		m_y(source.m_y),
+		m_z(source.m_z),
+		m_w(source.m_w)
+	{
+	}
+
+	inline Vector4 Vector4::Add(const Vector4 &other) const
+	{
+		return Vector4(m_x + other.m_x, m_y + other.m_y, m_z + other.m_z, m_w + other.m_w);
+	}
+
+	inline Vector4 Vector4::Subtract(const Vector4 &other) const
+	{
+		return Vector4(m_x - other.m_x, m_y - other.m_y, m_z - other.m_z, m_w - other.m_w);
+	}
+
+	inline Vector4 Vector4::Multiply(const Vector4 &other) const
+	{
+		return Vector4(m_x * other.m_x, m_y * other.m_y, m_z * other.m_z, m_w * other.m_w);
+	}
+
+	inline Vector4 Vector4::Divide(const Vector4 &other) const
+	{
+		return Vector4(m_x / other.m_x, m_y / other.m_y, m_z / other.m_z, m_w / other.m_w);
+	}
+
+	inline float Vector4::Dot(const Vector4 &other) const
+	{
+		return m_x * other.m_x + m_y * other.m_y + m_z * other.m_z + m_w * other.m_w;
+	}
+
+	inline Vector4 Vector4::Scale(const float &scalar) const
+	{
+		return Vector4(m_x * scalar, m_y * scalar, m_z * scalar, m_w * scalar);
+	}
+
+	inline Vector4 Vector4::Negate() const
+	{
+		return Vector4(-m_x, -m_y, -m_z, -m_w);
+	}
+
+	inline Vector4 Vector4::Normalize() const
+	{
+		float l = Length();
+		return Vector4(m_x / l, m_y / l, m_z / l, m_w / l);
+	}
+
+	inline float Vector4::LengthSquared() const
+	{
+		return m_x * m_x + m_y * m_y + m_z * m_z + m_w * m_w;
+	}
+
+	inline float Vector4::Length() const
+	{
+		return std::sqrt(LengthSquared());
+	}
+
+	inline float Vector4::MaxComponent() const
+	{
+		return std::max(m_x, std::max(m_y, std::max(m_z, m_w)));
+	}
+
+	inline float Vector4::MinComponent() const
+	{
+		return std::min(m_x, std::min(m_y, std::min(m_z, m_w)));
+	}
+
+	inline float Vector4::DistanceSquared(const Vector4 &other) const
+	{
+		float dx = m_x - other.m_x;
+		float dy = m_y - other.m_y;
+		float dz = m_z - other.m_z;
+		float dw = m_w - other.m_w;
+		return dx * dx + dy * dy + dz * dz + dw * dw;
+	}
+
+	inline float Vector4::Distance(const Vector4 &other) const
+	{
+		return std::sqrt(DistanceSquared(other));
+	}
+
+	inline bool Vector4::operator==(const Vector4 &other) const
+	{
+		return m_x == other.m_x && m_y == other.m_y && m_z == other.m_z && m_w == other.m_w;
+	}
+
+	inline bool Vector4::operator!=(const Vector4 &other) const
+	{
+		return !(*this == other);
+	}
+
+	inline bool Vector4::operator<(const Vector4 &other) const
+	{
+		return m_x < other.m_x && m_y < other.m_y && m_z < other.m_z && m_w < other.m_w;
+	}
+
+	inline bool Vector4::operator<=(const Vector4 &other) const
+	{
+		return m_x <= other.m_x && m_y <= other.m_y && m_z <= other.m_z && m_w <= other.m_w;
+	}
+
+	inline bool Vector4::operator>(const Vector4 &other) const
+	{
+		return m_x > other.m_x && m_y > other.m_y && m_z > other.m_z && m_w > other.m_w;
+	}
+
+	inline bool Vector4::operator>=(const Vector4 &other) const
+	{
+		return m_x >= other.m_x && m_y >= other.m_y && m_z >= other.m_z && m_w >= other.m_w;
+	}
+
+	inline bool Vector4::operator==(const float &value) const
+	{
+		return m_x == value && m_y == value && m_z == value && m_w == value;
+	}
+
+	inline bool Vector4::operator!=(const float &value) const
+	{
+		return !(*this == value);
+	}
+
+	inline Vector4 Vector4::operator-() const
+	{
+		return Negate();
+	}
+
+	inline const float &Vector4::operator[](const uint32_t &index) const
+	{
+		assert(index < 4);
+		return m_elements[index];
+	}
+
+	inline float &Vector4::operator[](const uint32_t &index)
+	{
+		assert(index < 4);
+		return m_elements[index];
+	}
+
+	inline Vector4 &Vector4::operator+=(const Vector4 &other)
+	{
+		return *this = Add(other);
+	}
+
+	inline Vector4 &Vector4::operator-=(const Vector4 &other)
+	{
+		return *this = Subtract(other);
+	}
+
+	inline Vector4 &Vector4::operator*=(const Vector4 &other)
+	{
+		return *this = Multiply(other);
+	}
+
+	inline Vector4 &Vector4::operator/=(const Vector4 &other)
+	{
+		return *this = Divide(other);
+	}
+
+	inline Vector4 &Vector4::operator+=(const float &other)
+	{
+		return *this = Add(Vector4(other, other, other, other));
+	}
+
+	inline Vector4 &Vector4::operator-=(const float &other)
+	{
+		return *this = Subtract(Vector4(other, other, other, other));
+	}
+
+	inline Vector4 &Vector4::operator*=(const float &other)
+	{
+		return *this = Multiply(Vector4(other, other, other, other));
+	}
+
+	inline Vector4 &Vector4::operator/=(const float &other)
+	{
+		return *this = Divide(Vector4(other, other, other, other));
+	}
 }
@@ -1,7 +1,6 @@
 #include "MeshRender.hpp"
 
 #include "Materials/IMaterial.hpp"
-#include "Physics/Rigidbody.hpp"
 #include "Objects/GameObject.hpp"
 #include "Scenes/Scenes.hpp"
 
@@ -32,18 +31,7 @@ namespace acid
 
 	bool MeshRender::CmdRender(const CommandBuffer &commandBuffer, UniformHandler &uniformScene, const GraphicsStage &graphicsStage)
 	{
-		// Checks if the mesh is in view.
-		auto rigidbody = GetGameObject()->GetComponent<Rigidbody>();
-
-		if (rigidbody != nullptr)
-		{
-			if (!rigidbody->InFrustum(Scenes::Get()->GetCamera()->GetViewFrustum()))
-			{
-				return false;
-			}
-		}
-
-		// Gets required components.
+		// Gets required components, meshes out of view were already culled by the renderer.
 		auto material = GetGameObject()->GetComponent<IMaterial>();
 		auto mesh = GetGameObject()->GetComponent<Mesh>();
 
@@ -1,38 +1,70 @@
 ﻿#include "RendererMeshes.hpp"
 
+#include "Physics/Rigidbody.hpp"
 #include "Scenes/Scenes.hpp"
 #include "MeshRender.hpp"
 
 namespace acid
 {
+	const uint32_t RendererMeshes::MESHES_PER_JOB = 256;
+
 	RendererMeshes::RendererMeshes(const GraphicsStage &graphicsStage, const MeshSort &meshSort) :
 		IRenderer(graphicsStage),
 		m_meshSort(meshSort),
-		m_uniformScene(UniformHandler(true))
+		m_uniformScene(UniformHandler(true)),
+		m_meshRenders(std::vector<MeshRender *>()),
+		m_jobCount(0)
 	{
 	}
 
-	void RendererMeshes::Render(const CommandBuffer &commandBuffer, const Vector4 &clipPlane, const ICamera &camera)
+	uint32_t RendererMeshes::PrepareJobs(const Vector4 &clipPlane, const ICamera &camera)
 	{
 		m_uniformScene.Push("projection", camera.GetProjectionMatrix());
 		m_uniformScene.Push("view", camera.GetViewMatrix());
 		m_uniformScene.Push("cameraPos", camera.GetPosition());
 
-		auto sceneMeshRenders = Scenes::Get()->GetStructure()->QueryComponents<MeshRender>();
+		m_meshRenders = Scenes::Get()->GetStructure()->QueryComponents<MeshRender>();
+		Rigidbody::CullComponents(camera.GetViewFrustum(), m_meshRenders);
 
 		if (m_meshSort != MESH_SORT_NONE)
 		{
-			std::sort(sceneMeshRenders.begin(), sceneMeshRenders.end());
+			std::sort(m_meshRenders.begin(), m_meshRenders.end());
 
 			if (m_meshSort == MESH_SORT_FRONT)
 			{
-				std::reverse(sceneMeshRenders.begin(), sceneMeshRenders.end());
+				std::reverse(m_meshRenders.begin(), m_meshRenders.end());
 			}
 		}
 
-		for (auto &meshRender : sceneMeshRenders)
+		// A few jobs per thread lets threads that finish early pick up more.
+		uint32_t maxJobs = 4 * (Engine::Get()->GetThreadPool()->GetThreadCount() + 1);
+		m_jobCount = std::min(static_cast<uint32_t>(m_meshRenders.size()) / MESHES_PER_JOB, maxJobs);
+
+		if (m_jobCount < 2)
+		{
+			m_jobCount = 0;
+		}
+
+		return m_jobCount;
+	}
+
+	void RendererMeshes::Render(const CommandBuffer &commandBuffer, const Vector4 &clipPlane, const ICamera &camera)
+	{
+		for (auto &meshRender : m_meshRenders)
 		{
 			meshRender->CmdRender(commandBuffer, m_uniformScene, GetGraphicsStage());
 		}
 	}
+
+	void RendererMeshes::RenderJob(const CommandBuffer &commandBuffer, const uint32_t &job)
+	{
+		// Jobs take neighbouring runs of meshes, so the sorted order is kept once the buffers are executed in job order.
+		std::size_t begin = m_meshRenders.size() * job / m_jobCount;
+		std::size_t end = m_meshRenders.size() * (job + 1) / m_jobCount;
+
+		for (std::size_t i = begin; i < end; i++)
+		{
+			m_meshRenders[i]->CmdRender(commandBuffer, m_uniformScene, GetGraphicsStage());
+		}
+	}
 }
@@ -7,6 +7,8 @@
 
 namespace acid
 {
+	class MeshRender;
+
 	enum MeshSort
 	{
 		MESH_SORT_NONE = 0,
@@ -20,9 +22,20 @@ namespace acid
 	private:
 		MeshSort m_meshSort;
 		UniformHandler m_uniformScene;
+		std::vector<MeshRender *> m_meshRenders;
+		uint32_t m_jobCount;
 	public:
+		/// <summary>
+		/// The fewest meshes recorded by one job, fewer meshes than this are recorded on the main thread.
+		/// </summary>
+		static const uint32_t MESHES_PER_JOB;
+
 		explicit RendererMeshes(const GraphicsStage &graphicsStage, const MeshSort &meshSort = MESH_SORT_NONE);
 
+		uint32_t PrepareJobs(const Vector4 &clipPlane, const ICamera &camera) override;
+
 		void Render(const CommandBuffer &commandBuffer, const Vector4 &clipPlane, const ICamera &camera) override;
+
+		void RenderJob(const CommandBuffer &commandBuffer, const uint32_t &job) override;
 	};
 }
@@ -1,5 +1,6 @@
 #include "Packet.hpp"
 
+#include <algorithm>
 #include <cstring>
 #include <cwchar>
 #include "Socket.hpp"
@@ -7,46 +8,183 @@
 namespace acid
 {
 	Packet::Packet() :
+		m_data(std::vector<char>()),
+		m_buffer(nullptr),
+		m_size(0),
+		m_capacity(0),
+		m_borrowed(false),
 		m_readPos(0),
 		m_sendPos(0),
 		m_isValid(true)
 	{
 	}
 
+	Packet::Packet(void *buffer, const std::size_t &capacity, const std::size_t &size) :
+		m_data(std::vector<char>()),
+		m_buffer(static_cast<char *>(buffer)),
+		m_size(std::min(size, capacity)),
+		m_capacity(capacity),
+		m_borrowed(buffer != nullptr),
+		m_readPos(0),
+		m_sendPos(0),
+		m_isValid(true)
+	{
+		if (buffer == nullptr)
+		{
+			m_size = 0;
+			m_capacity = 0;
+		}
+	}
+
+	Packet::Packet(const Packet &other) :
+		m_data(std::vector<char>(other.m_buffer, other.m_buffer + other.m_size)),
+		m_buffer(m_data.data()),
+		m_size(other.m_size),
+		m_capacity(other.m_size),
+		m_borrowed(false),
+		m_readPos(other.m_readPos),
+		m_sendPos(other.m_sendPos),
+		m_isValid(other.m_isValid)
+	{
+	}
+
+	Packet::Packet(Packet &&other) :
+		m_data(std::move(other.m_data)),
+		m_buffer(other.m_borrowed ? other.m_buffer : m_data.data()),
+		m_size(other.m_size),
+		m_capacity(other.m_borrowed ? other.m_capacity : m_data.size()),
+		m_borrowed(other.m_borrowed),
+		m_readPos(other.m_readPos),
+		m_sendPos(other.m_sendPos),
+		m_isValid(other.m_isValid)
+	{
+		other.m_data.clear();
+		other.m_buffer = nullptr;
+		other.m_size = 0;
+		other.m_capacity = 0;
+		other.m_borrowed = false;
+		other.m_readPos = 0;
+		other.m_sendPos = 0;
+	}
+
 	Packet::~Packet()
 	{
 	}
 
+	Packet &Packet::operator=(const Packet &other)
+	{
+		if (this != &other)
+		{
+			m_size = 0;
+			Append(other.m_buffer, other.m_size);
+			m_readPos = other.m_readPos;
+			m_sendPos = other.m_sendPos;
+			m_isValid = other.m_isValid;
+		}
+
+		return *this;
+	}
+
+	Packet &Packet::operator=(Packet &&other)
+	{
+		if (this != &other)
+		{
+			m_data = std::move(other.m_data);
+			m_buffer = other.m_borrowed ? other.m_buffer : m_data.data();
+			m_size = other.m_size;
+			m_capacity = other.m_borrowed ? other.m_capacity : m_data.size();
+			m_borrowed = other.m_borrowed;
+			m_readPos = other.m_readPos;
+			m_sendPos = other.m_sendPos;
+			m_isValid = other.m_isValid;
+
+			other.m_data.clear();
+			other.m_buffer = nullptr;
+			other.m_size = 0;
+			other.m_capacity = 0;
+			other.m_borrowed = false;
+			other.m_readPos = 0;
+			other.m_sendPos = 0;
+		}
+
+		return *this;
+	}
+
 	void Packet::Append(const void *data, std::size_t sizeInBytes)
 	{
 		if (data && (sizeInBytes > 0))
 		{
-			std::size_t start = m_data.size();
-			m_data.resize(start + sizeInBytes);
-			std::memcpy(&m_data[start], data, sizeInBytes);
+			if (m_size + sizeInBytes > m_capacity)
+			{
+				// Grows geometrically so a stream of small writes stays amortised constant time.
+				Reserve(std::max(m_size + sizeInBytes, 2 * m_capacity));
+			}
+
+			std::memcpy(m_buffer + m_size, data, sizeInBytes);
+			m_size += sizeInBytes;
 		}
 	}
 
+	void Packet::Reserve(const std::size_t &capacity)
+	{
+		if (capacity <= m_capacity)
+		{
+			return;
+		}
+
+		if (m_borrowed)
+		{
+			// The caller's buffer is full, the bytes move to heap storage and the buffer is left alone.
+			m_data.resize(capacity);
+
+			if (m_size > 0)
+			{
+				std::memcpy(m_data.data(), m_buffer, m_size);
+			}
+
+			m_borrowed = false;
+		}
+		else
+		{
+			m_data.resize(capacity);
+		}
+
+		m_buffer = m_data.data();
+		m_capacity = capacity;
+	}
+
+	const char *Packet::ReadData(const std::size_t &size)
+	{
+		if (!CheckSize(size))
+		{
+			return NULL;
+		}
+
+		const char *data = m_buffer + m_readPos;
+		m_readPos += size;
+		return data;
+	}
+
 	void Packet::Clear()
 	{
-		m_data.clear();
+		m_size = 0;
 		m_readPos = 0;
 		m_isValid = true;
 	}
 
 	const void *Packet::GetData() const
 	{
-		return !m_data.empty() ? &m_data[0] : NULL;
+		return m_size > 0 ? m_buffer : NULL;
 	}
 
 	std::size_t Packet::GetDataSize() const
 	{
-		return m_data.size();
+		return m_size;
 	}
 
 	bool Packet::EndOfPacket() const
 	{
-		return m_readPos >= m_data.size();
+		return m_readPos >= m_size;
 	}
 
 	Packet::operator BoolType() const
@@ -70,7 +208,7 @@ namespace acid
 	{
 		if (CheckSize(sizeof(data)))
 		{
-			data = *reinterpret_cast<const int8_t *>(&m_data[m_readPos]);
+			std::memcpy(&data, m_buffer + m_readPos, sizeof(data));
 			m_readPos += sizeof(data);
 		}
 
@@ -81,7 +219,7 @@ namespace acid
 	{
 		if (CheckSize(sizeof(data)))
 		{
-			data = *reinterpret_cast<const uint8_t *>(&m_data[m_readPos]);
+			std::memcpy(&data, m_buffer + m_readPos, sizeof(data));
 			m_readPos += sizeof(data);
 		}
 
@@ -92,7 +230,8 @@ namespace acid
 	{
 		if (CheckSize(sizeof(data)))
 		{
-			data = ntohs(*reinterpret_cast<const int16_t *>(&m_data[m_readPos]));
+			std::memcpy(&data, m_buffer + m_readPos, sizeof(data));
+			data = ntohs(data);
 			m_readPos += sizeof(data);
 		}
 
@@ -103,7 +242,8 @@ namespace acid
 	{
 		if (CheckSize(sizeof(data)))
 		{
-			data = ntohs(*reinterpret_cast<const uint16_t *>(&m_data[m_readPos]));
+			std::memcpy(&data, m_buffer + m_readPos, sizeof(data));
+			data = ntohs(data);
 			m_readPos += sizeof(data);
 		}
 
@@ -114,7 +254,8 @@ namespace acid
 	{
 		if (CheckSize(sizeof(data)))
 		{
-			data = ntohl(*reinterpret_cast<const int32_t *>(&m_data[m_readPos]));
+			std::memcpy(&data, m_buffer + m_readPos, sizeof(data));
+			data = ntohl(data);
 			m_readPos += sizeof(data);
 		}
 
@@ -125,7 +266,8 @@ namespace acid
 	{
 		if (CheckSize(sizeof(data)))
 		{
-			data = ntohl(*reinterpret_cast<const uint32_t *>(&m_data[m_readPos]));
+			std::memcpy(&data, m_buffer + m_readPos, sizeof(data));
+			data = ntohl(data);
 			m_readPos += sizeof(data);
 		}
 
@@ -137,7 +279,7 @@ namespace acid
 		if (CheckSize(sizeof(data)))
 		{
 			// Since ntohll is not available everywhere, we have to convert to network byte order (big endian) manually.
-			const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&m_data[m_readPos]);
+			const uint8_t *bytes = reinterpret_cast<const uint8_t *>(m_buffer + m_readPos);
 			data = (static_cast<int64_t>(bytes[0]) << 56) |
 			       (static_cast<int64_t>(bytes[1]) << 48) |
 			       (static_cast<int64_t>(bytes[2]) << 40) |
@@ -157,7 +299,7 @@ namespace acid
 		if (CheckSize(sizeof(data)))
 		{
 			// Since ntohll is not available everywhere, we have to convert to network byte order (big endian) manually.
-			const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&m_data[m_readPos]);
+			const uint8_t *bytes = reinterpret_cast<const uint8_t *>(m_buffer + m_readPos);
 			data = (static_cast<uint64_t>(bytes[0]) << 56) |
 			       (static_cast<uint64_t>(bytes[1]) << 48) |
 			       (static_cast<uint64_t>(bytes[2]) << 40) |
@@ -176,7 +318,7 @@ namespace acid
 	{
 		if (CheckSize(sizeof(data)))
 		{
-			data = *reinterpret_cast<const float *>(&m_data[m_readPos]);
+			std::memcpy(&data, m_buffer + m_readPos, sizeof(data));
 			m_readPos += sizeof(data);
 		}
 
@@ -187,7 +329,7 @@ namespace acid
 	{
 		if (CheckSize(sizeof(data)))
 		{
-			data = *reinterpret_cast<const double *>(&m_data[m_readPos]);
+			std::memcpy(&data, m_buffer + m_readPos, sizeof(data));
 			m_readPos += sizeof(data);
 		}
 
@@ -203,7 +345,7 @@ namespace acid
 		if ((length > 0) && CheckSize(length))
 		{
 			// Then extract characters.
-			std::memcpy(data, &m_data[m_readPos], length);
+			std::memcpy(data, m_buffer + m_readPos, length);
 			data[length] = '\0';
 
 			// Update reading position.
@@ -224,7 +366,27 @@ namespace acid
 		if ((length > 0) && CheckSize(length))
 		{
 			// Then extract characters.
-			data.assign(&m_data[m_readPos], length);
+			data.assign(m_buffer + m_readPos, length);
+
+			// Update reading position.
+			m_readPos += length;
+		}
+
+		return *this;
+	}
+
+	Packet &Packet::operator>>(std::string_view &data)
+	{
+		// First extract string length.
+		uint32_t length = 0;
+		*this >> length;
+
+		data = std::string_view();
+
+		if ((length > 0) && CheckSize(length))
+		{
+			// Then point at the characters in place.
+			data = std::string_view(m_buffer + m_readPos, length);
 
 			// Update reading position.
 			m_readPos += length;
@@ -396,6 +558,21 @@ namespace acid
 		return *this;
 	}
 
+	Packet &Packet::operator<<(const std::string_view &data)
+	{
+		// First insert string length.
+		uint32_t length = static_cast<uint32_t>(data.size());
+		*this << length;
+
+		// Then insert characters.
+		if (length > 0)
+		{
+			Append(data.data(), length * sizeof(std::string_view::value_type));
+		}
+
+		return *this;
+	}
+
 	Packet &Packet::operator<<(const wchar_t *data)
 	{
 		// First insert string length.
@@ -442,7 +619,7 @@ namespace acid
 
 	bool Packet::CheckSize(std::size_t size)
 	{
-		m_isValid = m_isValid && (m_readPos + size <= m_data.size());
+		m_isValid = m_isValid && (m_readPos + size <= m_size);
 		return m_isValid;
 	}
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include "Engine/Exports.hpp"
 
@@ -15,8 +16,16 @@ namespace acid
 		/// A bool-like type that cannot be converted to integer or pointer types.
 		typedef bool (Packet::*BoolType)(std::size_t);
 
-		/// Data stored in the packet.
+		/// Heap storage, used unless the packet was given a buffer or that buffer has filled up.
 		std::vector<char> m_data;
+		/// The bytes of the packet, either m_data or a caller owned buffer.
+		char *m_buffer;
+		/// Number of bytes written to the buffer.
+		std::size_t m_size;
+		/// Number of bytes the buffer can hold.
+		std::size_t m_capacity;
+		/// If the buffer is owned by the caller.
+		bool m_borrowed;
 		/// Current reading position in the packet.
 		std::size_t m_readPos;
 		/// Current send position in the packet (for handling partial sends).
@@ -29,8 +38,29 @@ namespace acid
 		/// </summary>
 		Packet();
 
+		/// <summary>
+		/// Creates a packet over a caller owned buffer, such as a slot in an arena or ring buffer, so building or reading it does not allocate.
+		/// The buffer must outlive the packet. If more than capacity bytes are appended the contents move to heap storage.
+		/// </summary>
+		/// <param name="buffer"> The memory to write into. </param>
+		/// <param name="capacity"> The size of the buffer, in bytes. </param>
+		/// <param name="size"> The number of bytes already in the buffer, for reading a received message in place. </param>
+		Packet(void *buffer, const std::size_t &capacity, const std::size_t &size = 0);
+
+		/// <summary>
+		/// Copy constructor, the copy always owns its bytes.
+		/// </summary>
+		/// <param name="other"> Instance to copy. </param>
+		Packet(const Packet &other);
+
+		Packet(Packet &&other);
+
 		virtual ~Packet();
 
+		Packet &operator=(const Packet &other);
+
+		Packet &operator=(Packet &&other);
+
 		/// <summary>
 		/// Append data to the end of the packet.
 		/// </summary>
@@ -38,6 +68,26 @@ namespace acid
 		/// <param name="sizeInBytes"> Number of bytes to append. </param>
 		void Append(const void *data, std::size_t sizeInBytes);
 
+		/// <summary>
+		/// Makes sure the packet can hold a number of bytes without growing, so a packet can be sized once up front.
+		/// </summary>
+		/// <param name="capacity"> The number of bytes to make room for. </param>
+		void Reserve(const std::size_t &capacity);
+
+		/// <summary>
+		/// Gets the number of bytes the packet can hold before it has to grow.
+		/// </summary>
+		/// <returns> The capacity, in bytes. </returns>
+		std::size_t GetCapacity() const { return m_capacity; }
+
+		/// <summary>
+		/// Reads raw bytes without copying them.
+		/// The returned pointer is only valid until data is next appended to the packet.
+		/// </summary>
+		/// <param name="size"> The number of bytes to read. </param>
+		/// <returns> Pointer to the bytes in the packet, or NULL if the packet does not have that many bytes left. </returns>
+		const char *ReadData(const std::size_t &size);
+
 		/// <summary>
 		/// Clear the packet, after calling Clear, the packet is empty.
 		/// </summary>
@@ -66,6 +116,11 @@ namespace acid
 		/// <returns> True if all data was read, false otherwise. </returns>
 		bool EndOfPacket() const;
 
+		/// <summary>
+		/// Puts the packet in an invalid state, for readers that find data that cannot be right, such as a tree nested deeper than they allow.
+		/// </summary>
+		void Invalidate() { m_isValid = false; }
+
 		/// <summary>
 		/// Test the validity of the packet, for reading.
 		/// This operator allows to test the packet as a boolean variable, to check if a reading operation was successful.
@@ -122,6 +177,14 @@ namespace acid
 
 		Packet &operator>>(std::string &data);
 
+		/// <summary>
+		/// Reads a string written by any of the narrow string writes without copying it.
+		/// The view is only valid until data is next appended to the packet.
+		/// </summary>
+		/// <param name="data"> Filled with a view of the characters in the packet. </param>
+		/// <returns> Reference to the packet. </returns>
+		Packet &operator>>(std::string_view &data);
+
 		Packet &operator>>(wchar_t *data);
 
 		Packet &operator>>(std::wstring &data);
@@ -154,6 +217,8 @@ namespace acid
 
 		Packet &operator<<(const std::string &data);
 
+		Packet &operator<<(const std::string_view &data);
+
 		Packet &operator<<(const wchar_t *data);
 
 		Packet &operator<<(const std::wstring &data);
@@ -8,7 +8,7 @@
 #undef _WIN32_WINNT
 #endif
 #define _WIN32_WINDOWS 0x0501
-#define _WIN32_WINNT   0x0501
+#define _WIN32_WINNT   0x0600
 #include <winsock2.h>
 #include <ws2tcpip.h>
 #include <basetsd.h>
@@ -75,6 +75,7 @@ namespace acid
 	class ACID_EXPORT Socket
 	{
 	private:
+		friend class SocketReactor;
 		friend class SocketSelector;
 
 		/// Type of the socket (TCP or UDP).
@@ -0,0 +1,379 @@
+#include "SocketReactor.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "Engine/Log.hpp"
+#include "Socket.hpp"
+
+#if defined(ACID_BUILD_LINUX)
+#include <errno.h>
+#include <sys/epoll.h>
+#elif !defined(ACID_BUILD_WINDOWS)
+#include <errno.h>
+#include <poll.h>
+#endif
+
+namespace acid
+{
+	struct SocketReactorEntry
+	{
+		Socket *socket;
+		SocketHandle handle;
+		uint32_t events;
+		SocketReactor::Callback callback;
+		bool removed;
+	};
+
+	struct SocketReactor::SocketReactorImpl
+	{
+		/// Registered sockets, an entry keeps its address for as long as it is registered.
+		std::unordered_map<Socket *, std::unique_ptr<SocketReactorEntry>> sockets;
+		/// Entries removed while polling, freed once the poll has finished dispatching.
+		std::vector<std::unique_ptr<SocketReactorEntry>> removed;
+		/// If callbacks are being dispatched.
+		bool polling;
+#if defined(ACID_BUILD_LINUX)
+		/// Epoll instance watching every registered socket.
+		int epoll;
+		/// Buffer filled by epoll_wait.
+		std::vector<epoll_event> ready;
+#else
+		/// Poll descriptors, rebuilt before a poll if the registered sockets changed.
+		std::vector<pollfd> handles;
+		/// The entry for each poll descriptor.
+		std::vector<SocketReactorEntry *> entries;
+		/// If the poll descriptors need rebuilding.
+		bool dirty;
+#endif
+	};
+
+	/// The most events taken from the kernel by one poll, any more are returned by the next poll.
+	static const std::size_t MAX_READY_EVENTS = 4096;
+
+	static int32_t TimeoutMilliseconds(const Time &timeout)
+	{
+		if (timeout == Time::ZERO)
+		{
+			return -1;
+		}
+
+		// Rounds up so a short timeout still waits.
+		return static_cast<int32_t>((timeout.AsMicroseconds() + 999) / 1000);
+	}
+
+#if defined(ACID_BUILD_LINUX)
+	static uint32_t ToEpollEvents(const uint32_t &events)
+	{
+		uint32_t result = EPOLLET | EPOLLRDHUP;
+
+		if (events & SOCKET_EVENT_READ)
+		{
+			result |= EPOLLIN;
+		}
+
+		if (events & SOCKET_EVENT_WRITE)
+		{
+			result |= EPOLLOUT;
+		}
+
+		return result;
+	}
+
+	static uint32_t FromEpollEvents(const uint32_t &events)
+	{
+		uint32_t result = 0;
+
+		if (events & EPOLLIN)
+		{
+			result |= SOCKET_EVENT_READ;
+		}
+
+		if (events & EPOLLOUT)
+		{
+			result |= SOCKET_EVENT_WRITE;
+		}
+
+		if (events & (EPOLLHUP | EPOLLRDHUP | EPOLLERR))
+		{
+			result |= SOCKET_EVENT_CLOSED;
+		}
+
+		return result;
+	}
+#else
+	static short ToPollEvents(const uint32_t &events)
+	{
+		short result = 0;
+
+		if (events & SOCKET_EVENT_READ)
+		{
+			result |= POLLIN;
+		}
+
+		if (events & SOCKET_EVENT_WRITE)
+		{
+			result |= POLLOUT;
+		}
+
+		return result;
+	}
+
+	static uint32_t FromPollEvents(const short &events)
+	{
+		uint32_t result = 0;
+
+		if (events & POLLIN)
+		{
+			result |= SOCKET_EVENT_READ;
+		}
+
+		if (events & POLLOUT)
+		{
+			result |= SOCKET_EVENT_WRITE;
+		}
+
+		if (events & (POLLHUP | POLLERR | POLLNVAL))
+		{
+			result |= SOCKET_EVENT_CLOSED;
+		}
+
+		return result;
+	}
+#endif
+
+	SocketReactor::SocketReactor() :
+		m_impl(new SocketReactorImpl)
+	{
+		m_impl->polling = false;
+#if defined(ACID_BUILD_LINUX)
+		m_impl->epoll = epoll_create1(EPOLL_CLOEXEC);
+
+		if (m_impl->epoll == -1)
+		{
+			Log::Error("Failed to create epoll instance: %i\n", errno);
+		}
+#else
+		m_impl->dirty = false;
+#endif
+	}
+
+	SocketReactor::~SocketReactor()
+	{
+#if defined(ACID_BUILD_LINUX)
+		if (m_impl->epoll != -1)
+		{
+			close(m_impl->epoll);
+		}
+#endif
+
+		delete m_impl;
+	}
+
+	bool SocketReactor::Add(Socket &socket, const uint32_t &events, const Callback &callback)
+	{
+		SocketHandle handle = socket.GetHandle();
+
+		if (handle == Socket::InvalidSocketHandle() || m_impl->sockets.find(&socket) != m_impl->sockets.end())
+		{
+			return false;
+		}
+
+		socket.SetBlocking(false);
+
+		auto entry = std::make_unique<SocketReactorEntry>();
+		entry->socket = &socket;
+		entry->handle = handle;
+		entry->events = events;
+		entry->callback = callback;
+		entry->removed = false;
+
+#if defined(ACID_BUILD_LINUX)
+		epoll_event event = {};
+		event.events = ToEpollEvents(events);
+		event.data.ptr = entry.get();
+
+		if (epoll_ctl(m_impl->epoll, EPOLL_CTL_ADD, handle, &event) == -1)
+		{
+			Log::Error("Failed to add socket to the reactor: %i\n", errno);
+			return false;
+		}
+#else
+		m_impl->dirty = true;
+#endif
+
+		m_impl->sockets.emplace(&socket, std::move(entry));
+		return true;
+	}
+
+	bool SocketReactor::Modify(Socket &socket, const uint32_t &events)
+	{
+		auto it = m_impl->sockets.find(&socket);
+
+		if (it == m_impl->sockets.end())
+		{
+			return false;
+		}
+
+		auto entry = (*it).second.get();
+		entry->events = events;
+
+#if defined(ACID_BUILD_LINUX)
+		epoll_event event = {};
+		event.events = ToEpollEvents(events);
+		event.data.ptr = entry;
+
+		if (epoll_ctl(m_impl->epoll, EPOLL_CTL_MOD, entry->handle, &event) == -1)
+		{
+			Log::Error("Failed to modify socket in the reactor: %i\n", errno);
+			return false;
+		}
+#else
+		m_impl->dirty = true;
+#endif
+
+		return true;
+	}
+
+	void SocketReactor::Remove(Socket &socket)
+	{
+		auto it = m_impl->sockets.find(&socket);
+
+		if (it == m_impl->sockets.end())
+		{
+			return;
+		}
+
+#if defined(ACID_BUILD_LINUX)
+		// Fails harmlessly if the socket was already closed, which also removes it from the epoll set.
+		epoll_ctl(m_impl->epoll, EPOLL_CTL_DEL, (*it).second->handle, nullptr);
+#else
+		m_impl->dirty = true;
+#endif
+
+		if (m_impl->polling)
+		{
+			(*it).second->removed = true;
+			m_impl->removed.emplace_back(std::move((*it).second));
+		}
+
+		m_impl->sockets.erase(it);
+	}
+
+	void SocketReactor::Clear()
+	{
+		for (auto &[socket, entry] : m_impl->sockets)
+		{
+#if defined(ACID_BUILD_LINUX)
+			epoll_ctl(m_impl->epoll, EPOLL_CTL_DEL, entry->handle, nullptr);
+#endif
+
+			if (m_impl->polling)
+			{
+				entry->removed = true;
+				m_impl->removed.emplace_back(std::move(entry));
+			}
+		}
+
+		m_impl->sockets.clear();
+#if !defined(ACID_BUILD_LINUX)
+		m_impl->dirty = true;
+#endif
+	}
+
+	uint32_t SocketReactor::Poll(Time timeout)
+	{
+		uint32_t dispatched = 0;
+
+#if defined(ACID_BUILD_LINUX)
+		m_impl->ready.resize(std::clamp<std::size_t>(m_impl->sockets.size(), 1, MAX_READY_EVENTS));
+		int count = epoll_wait(m_impl->epoll, m_impl->ready.data(), static_cast<int>(m_impl->ready.size()), TimeoutMilliseconds(timeout));
+
+		if (count == -1)
+		{
+			if (errno != EINTR)
+			{
+				Log::Error("Failed to wait on the reactor: %i\n", errno);
+			}
+
+			return 0;
+		}
+
+		m_impl->polling = true;
+
+		for (int i = 0; i < count; i++)
+		{
+			auto entry = static_cast<SocketReactorEntry *>(m_impl->ready[i].data.ptr);
+
+			if (entry->removed)
+			{
+				continue;
+			}
+
+			entry->callback(*entry->socket, FromEpollEvents(m_impl->ready[i].events));
+			dispatched++;
+		}
+#else
+		if (m_impl->dirty)
+		{
+			m_impl->handles.clear();
+			m_impl->entries.clear();
+
+			for (auto &[socket, entry] : m_impl->sockets)
+			{
+				pollfd handle = {};
+				handle.fd = entry->handle;
+				handle.events = ToPollEvents(entry->events);
+				m_impl->handles.emplace_back(handle);
+				m_impl->entries.emplace_back(entry.get());
+			}
+
+			m_impl->dirty = false;
+		}
+
+#if defined(ACID_BUILD_WINDOWS)
+		int count = WSAPoll(m_impl->handles.data(), static_cast<ULONG>(m_impl->handles.size()), TimeoutMilliseconds(timeout));
+#else
+		int count = poll(m_impl->handles.data(), static_cast<nfds_t>(m_impl->handles.size()), TimeoutMilliseconds(timeout));
+#endif
+
+		if (count <= 0)
+		{
+			return 0;
+		}
+
+		m_impl->polling = true;
+
+		int visited = 0;
+
+		for (std::size_t i = 0; i < m_impl->handles.size() && visited < count; i++)
+		{
+			if (m_impl->handles[i].revents == 0)
+			{
+				continue;
+			}
+
+			visited++;
+			auto entry = m_impl->entries[i];
+
+			if (entry->removed)
+			{
+				continue;
+			}
+
+			entry->callback(*entry->socket, FromPollEvents(m_impl->handles[i].revents));
+			dispatched++;
+		}
+#endif
+
+		m_impl->polling = false;
+		m_impl->removed.clear();
+		return dispatched;
+	}
+
+	uint32_t SocketReactor::GetSocketCount() const
+	{
+		return static_cast<uint32_t>(m_impl->sockets.size());
+	}
+}
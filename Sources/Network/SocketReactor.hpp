@@ -0,0 +1,104 @@
+#pragma once
+
+#include <functional>
+#include "Engine/Exports.hpp"
+#include "Maths/Time.hpp"
+
+namespace acid
+{
+	class Socket;
+
+	/// <summary>
+	/// Readiness events a socket can be watched for, combined as a bit mask.
+	/// </summary>
+	enum SocketEvent
+	{
+		/// The socket has data to receive, or a listener has a connection to accept.
+		SOCKET_EVENT_READ = 1,
+		/// The socket can send without blocking.
+		SOCKET_EVENT_WRITE = 2,
+		/// The peer hung up or the socket errored, the next receive reports why.
+		SOCKET_EVENT_CLOSED = 4
+	};
+
+	/// <summary>
+	/// Event loop that calls back when registered sockets become ready.
+	///
+	/// Unlike <see cref="SocketSelector"/> there is no limit on the number or value of socket handles,
+	/// and a poll only visits the sockets that are ready. On Linux it is backed by edge-triggered epoll,
+	/// other platforms fall back to poll. A callback is only repeated once new data arrives,
+	/// so it must receive, send, or accept until the call returns SOCKET_STATUS_NOT_READY.
+	/// Registered sockets are switched to non-blocking mode.
+	/// </summary>
+	class ACID_EXPORT SocketReactor
+	{
+	public:
+		/// <summary>
+		/// Called with a ready socket and the SocketEvent bits that are ready on it.
+		/// </summary>
+		typedef std::function<void(Socket &, const uint32_t &)> Callback;
+	private:
+		struct SocketReactorImpl;
+
+		/// Opaque pointer to the implementation (which requires OS-specific types).
+		SocketReactorImpl *m_impl;
+	public:
+		/// <summary>
+		/// Default constructor.
+		/// </summary>
+		SocketReactor();
+
+		SocketReactor(const SocketReactor &) = delete;
+
+		/// <summary>
+		/// Destructor.
+		/// </summary>
+		~SocketReactor();
+
+		/// <summary>
+		/// Starts watching a socket.
+		///
+		/// This function keeps a weak reference to the socket, so you have to make sure
+		/// that the socket is removed before it is destroyed.
+		/// </summary>
+		/// <param name="socket"> Reference to the socket to add. </param>
+		/// <param name="events"> The SocketEvent bits to watch for. </param>
+		/// <param name="callback"> The function called when the socket is ready. </param>
+		/// <returns> If the socket was added, false if it is invalid or already added. </returns>
+		bool Add(Socket &socket, const uint32_t &events, const Callback &callback);
+
+		/// <summary>
+		/// Changes the events watched on a socket that was already added.
+		/// </summary>
+		/// <param name="socket"> Reference to the socket to modify. </param>
+		/// <param name="events"> The SocketEvent bits to watch for. </param>
+		/// <returns> If the socket was modified, false if it was never added. </returns>
+		bool Modify(Socket &socket, const uint32_t &events);
+
+		/// <summary>
+		/// Stops watching a socket. It is safe to call from inside a callback, including for the socket being dispatched.
+		/// </summary>
+		/// <param name="socket"> Reference to the socket to remove. </param>
+		void Remove(Socket &socket);
+
+		/// <summary>
+		/// Stops watching all sockets.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Waits for sockets to become ready and calls their callbacks.
+		/// </summary>
+		/// <param name="timeout"> Maximum time to wait, (use Time::ZERO for infinity). </param>
+		/// <returns> The number of callbacks that were called. </returns>
+		uint32_t Poll(Time timeout = Time::ZERO);
+
+		/// <summary>
+		/// Gets the number of sockets being watched.
+		/// </summary>
+		/// <returns> The number of sockets. </returns>
+		uint32_t GetSocketCount() const;
+
+		SocketReactor &operator=(const SocketReactor &) = delete;
+	};
+}
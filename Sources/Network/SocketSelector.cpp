@@ -6,6 +6,13 @@
 #include "Engine/Log.hpp"
 #include "Socket.hpp"
 
+#if defined(ACID_BUILD_LINUX)
+#include <errno.h>
+#include <sys/epoll.h>
+#include <unordered_set>
+#include <vector>
+#endif
+
 #ifdef _MSC_VER
 #pragma warning(disable: 4127) // "conditional expression is constant" generated by the FD_SET macro
 #endif
@@ -14,6 +21,16 @@ namespace acid
 {
 	struct SocketSelector::SocketSelectorImpl
 	{
+#if defined(ACID_BUILD_LINUX)
+		/// Epoll instance watching every added socket for reads, unlike select it has no limit on handle values.
+		int epoll = -1;
+		/// Set containing all the sockets handles.
+		std::unordered_set<SocketHandle> allSockets;
+		/// Set containing handles of the sockets that are ready.
+		std::unordered_set<SocketHandle> socketsReady;
+		/// Buffer filled by epoll_wait.
+		std::vector<epoll_event> events;
+#else
 		/// Set containing all the sockets handles.
 		fd_set allSockets;
 		/// Set containing handles of the sockets that are ready.
@@ -22,6 +39,7 @@ namespace acid
 		int maxSocket;
 		/// Number of socket handles.
 		int socketCount;
+#endif
 	};
 
 	SocketSelector::SocketSelector() :
@@ -30,13 +48,40 @@ namespace acid
 		Clear();
 	}
 
+#if defined(ACID_BUILD_LINUX)
+	SocketSelector::SocketSelector(const SocketSelector &copy) :
+		m_impl(new SocketSelectorImpl)
+	{
+		// An epoll instance can't be shared, so the copy registers the same handles with its own.
+		Clear();
+
+		for (auto &handle : copy.m_impl->allSockets)
+		{
+			epoll_event event = {};
+			event.events = EPOLLIN;
+			event.data.fd = handle;
+			epoll_ctl(m_impl->epoll, EPOLL_CTL_ADD, handle, &event);
+			m_impl->allSockets.emplace(handle);
+		}
+
+		m_impl->socketsReady = copy.m_impl->socketsReady;
+	}
+#else
 	SocketSelector::SocketSelector(const SocketSelector &copy) :
 		m_impl(new SocketSelectorImpl(*copy.m_impl))
 	{
 	}
+#endif
 
 	SocketSelector::~SocketSelector()
 	{
+#if defined(ACID_BUILD_LINUX)
+		if (m_impl->epoll != -1)
+		{
+			close(m_impl->epoll);
+		}
+#endif
+
 		delete m_impl;
 	}
 
@@ -46,7 +91,22 @@ namespace acid
 
 		if (handle != Socket::InvalidSocketHandle())
 		{
-#if defined(ACID_BUILD_WINDOWS)
+#if defined(ACID_BUILD_LINUX)
+			if (!m_impl->allSockets.emplace(handle).second)
+			{
+				return;
+			}
+
+			epoll_event event = {};
+			event.events = EPOLLIN;
+			event.data.fd = handle;
+
+			if (epoll_ctl(m_impl->epoll, EPOLL_CTL_ADD, handle, &event) == -1)
+			{
+				Log::Error("The socket can't be added to the selector: %i\n", errno);
+				m_impl->allSockets.erase(handle);
+			}
+#elif defined(ACID_BUILD_WINDOWS)
 			if (m_impl->socketCount >= FD_SETSIZE)
 			{
 				Log::Error("The socket can't be added to the selector because the selector is full. This is a limitation of your operating system's FD_SETSIZE setting.\n");
@@ -70,7 +130,9 @@ namespace acid
 			m_impl->maxSocket = std::max(m_impl->maxSocket, handle);
 #endif
 
+#if !defined(ACID_BUILD_LINUX)
 			FD_SET(handle, &m_impl->allSockets);
+#endif
 		}
 	}
 
@@ -80,7 +142,14 @@ namespace acid
 
 		if (handle != Socket::InvalidSocketHandle())
 		{
-#if defined(ACID_BUILD_WINDOWS)
+#if defined(ACID_BUILD_LINUX)
+			if (m_impl->allSockets.erase(handle) != 0)
+			{
+				epoll_ctl(m_impl->epoll, EPOLL_CTL_DEL, handle, nullptr);
+			}
+
+			m_impl->socketsReady.erase(handle);
+#elif defined(ACID_BUILD_WINDOWS)
 			if (!FD_ISSET(handle, &m_impl->allSockets))
 			{
 				return;
@@ -95,22 +164,57 @@ namespace acid
 			}
 #endif
 
+#if !defined(ACID_BUILD_LINUX)
 			FD_CLR(handle, &m_impl->allSockets);
 			FD_CLR(handle, &m_impl->socketsReady);
+#endif
 		}
 	}
 
 	void SocketSelector::Clear()
 	{
+#if defined(ACID_BUILD_LINUX)
+		if (m_impl->epoll != -1)
+		{
+			close(m_impl->epoll);
+		}
+
+		m_impl->epoll = epoll_create1(EPOLL_CLOEXEC);
+
+		if (m_impl->epoll == -1)
+		{
+			Log::Error("Failed to create epoll instance: %i\n", errno);
+		}
+
+		m_impl->allSockets.clear();
+		m_impl->socketsReady.clear();
+#else
 		FD_ZERO(&m_impl->allSockets);
 		FD_ZERO(&m_impl->socketsReady);
 
 		m_impl->maxSocket = 0;
 		m_impl->socketCount = 0;
+#endif
 	}
 
 	bool SocketSelector::Wait(Time timeout)
 	{
+#if defined(ACID_BUILD_LINUX)
+		m_impl->socketsReady.clear();
+		m_impl->events.resize(std::max<std::size_t>(m_impl->allSockets.size(), 1));
+
+		// Rounds the timeout up to whole milliseconds so a short timeout still waits.
+		int milliseconds = timeout != Time::ZERO ? static_cast<int>((timeout.AsMicroseconds() + 999) / 1000) : -1;
+		int count = epoll_wait(m_impl->epoll, m_impl->events.data(), static_cast<int>(m_impl->events.size()), milliseconds);
+
+		for (int i = 0; i < count; i++)
+		{
+			SocketHandle handle = m_impl->events[i].data.fd;
+			m_impl->socketsReady.emplace(handle);
+		}
+
+		return count > 0;
+#else
 		// Setup the timeout
 		timeval time;
 		time.tv_sec = static_cast<long>(timeout.AsMicroseconds() / 1000000);
@@ -124,6 +228,7 @@ namespace acid
 		int count = select(m_impl->maxSocket + 1, &m_impl->socketsReady, NULL, NULL, timeout != Time::ZERO ? &time : NULL);
 
 		return count > 0;
+#endif
 	}
 
 	bool SocketSelector::IsReady(Socket &socket) const
@@ -132,6 +237,9 @@ namespace acid
 
 		if (handle != Socket::InvalidSocketHandle())
 		{
+#if defined(ACID_BUILD_LINUX)
+			return m_impl->socketsReady.find(handle) != m_impl->socketsReady.end();
+#else
 #if !defined(ACID_BUILD_WINDOWS)
 			if (handle >= FD_SETSIZE)
 			{
@@ -140,6 +248,7 @@ namespace acid
 #endif
 
 			return FD_ISSET(handle, &m_impl->socketsReady) != 0;
+#endif
 		}
 
 		return false;
@@ -9,6 +9,7 @@ namespace acid
 
 	/// <summary>
 	/// Multiplexer that allows to read from multiple sockets.
+	/// For servers with many connections prefer <see cref="SocketReactor"/>, which calls back only the sockets that are ready.
 	/// </summary>
 	class ACID_EXPORT SocketSelector
 	{
@@ -6,6 +6,10 @@
 #include "Network/IpAddress.hpp"
 #include "Network/Packet.hpp"
 
+#if !defined(ACID_BUILD_WINDOWS)
+#include <sys/uio.h>
+#endif
+
 #ifdef _MSC_VER
 #pragma warning(disable: 4127) // "conditional expression is constant" generated by the FD_SET macro
 #endif
@@ -13,12 +17,17 @@
 namespace acid
 {
 	// Define the low-level send/receive flags, which depends on the OS.
-#if defined(ACID_PLATFORM_LINUX)
+#if defined(ACID_BUILD_LINUX)
 	const int flags = MSG_NOSIGNAL;
 #else
 	const int flags = 0;
 #endif
 
+	// The most a pending packet grows by before its bytes have arrived.
+	const std::size_t receiveChunk = 64 * 1024;
+
+	const uint32_t TcpSocket::MAX_PACKET_SIZE = 64 * 1024 * 1024;
+
 	TcpSocket::TcpSocket() :
 		Socket(SOCKET_TYPE_TCP)
 	{
@@ -265,10 +274,8 @@ namespace acid
 		// This means that we have to send the packet size first, so that the
 		// receiver knows the actual end of the packet in the data stream.
 
-		// We allocate an extra memory block so that the size can be sent
-		// together with the data in a single call. This may seem inefficient,
-		// but it is actually required to avoid partial send, which could cause
-		// data corruption on the receiving end.
+		// The size and the data are handed to the kernel together as a gather write,
+		// so they go out in a single call without first copying them into one block.
 
 		// Get the data to send from the packet.
 		std::size_t size = 0;
@@ -276,33 +283,80 @@ namespace acid
 
 		// First convert the packet size to network byte order
 		uint32_t packetSize = htonl(static_cast<uint32_t>(size));
+		std::size_t total = sizeof(packetSize) + size;
+		std::size_t sent = 0;
 
-		// Allocate memory for the data block to send
-		std::vector<char> blockToSend(sizeof(packetSize) + size);
+		// Loop until every byte has been sent, resuming from where a previous partial send stopped.
+		while (packet.m_sendPos < total)
+		{
+			std::size_t position = packet.m_sendPos;
+			std::size_t dataOffset = position > sizeof(packetSize) ? position - sizeof(packetSize) : 0;
+			int result = 0;
 
-		// Copy the packet size and data into the block to send
-		std::memcpy(&blockToSend[0], &packetSize, sizeof(packetSize));
+#if defined(ACID_BUILD_WINDOWS)
+			WSABUF buffers[2];
+			DWORD bufferCount = 0;
 
-		if (size > 0)
-		{
-			std::memcpy(&blockToSend[0] + sizeof(packetSize), data, size);
-		}
+			if (position < sizeof(packetSize))
+			{
+				buffers[bufferCount].buf = reinterpret_cast<char *>(&packetSize) + position;
+				buffers[bufferCount].len = static_cast<ULONG>(sizeof(packetSize) - position);
+				bufferCount++;
+			}
 
-		// Send the data block.
-		std::size_t sent;
-		SocketStatus status = Send(&blockToSend[0] + packet.m_sendPos, blockToSend.size() - packet.m_sendPos, sent);
+			if (size > dataOffset)
+			{
+				buffers[bufferCount].buf = const_cast<char *>(static_cast<const char *>(data)) + dataOffset;
+				buffers[bufferCount].len = static_cast<ULONG>(size - dataOffset);
+				bufferCount++;
+			}
 
-		// In the case of a partial send, record the location to resume from
-		if (status == SOCKET_STATUS_PARTIAL)
-		{
-			packet.m_sendPos += sent;
-		}
-		else if (status == SOCKET_STATUS_DONE)
-		{
-			packet.m_sendPos = 0;
+			DWORD sentBytes = 0;
+			result = WSASend(GetHandle(), buffers, bufferCount, &sentBytes, 0, NULL, NULL) == 0 ? static_cast<int>(sentBytes) : -1;
+#else
+			iovec buffers[2];
+			std::size_t bufferCount = 0;
+
+			if (position < sizeof(packetSize))
+			{
+				buffers[bufferCount].iov_base = reinterpret_cast<char *>(&packetSize) + position;
+				buffers[bufferCount].iov_len = sizeof(packetSize) - position;
+				bufferCount++;
+			}
+
+			if (size > dataOffset)
+			{
+				buffers[bufferCount].iov_base = const_cast<char *>(static_cast<const char *>(data)) + dataOffset;
+				buffers[bufferCount].iov_len = size - dataOffset;
+				bufferCount++;
+			}
+
+			msghdr message = {};
+			message.msg_iov = buffers;
+			message.msg_iovlen = bufferCount;
+			result = static_cast<int>(sendmsg(GetHandle(), &message, flags));
+#endif
+
+			// Check for errors.
+			if (result < 0)
+			{
+				SocketStatus status = Socket::GetErrorStatus();
+
+				// In the case of a partial send, the packet keeps the location to resume from.
+				if ((status == SOCKET_STATUS_NOT_READY) && sent)
+				{
+					return SOCKET_STATUS_PARTIAL;
+				}
+
+				return status;
+			}
+
+			packet.m_sendPos += static_cast<std::size_t>(result);
+			sent += static_cast<std::size_t>(result);
 		}
 
-		return status;
+		packet.m_sendPos = 0;
+		return SOCKET_STATUS_DONE;
 	}
 
 	SocketStatus TcpSocket::Receive(Packet &packet)
@@ -339,37 +393,46 @@ namespace acid
 			packetSize = ntohl(m_pendingPacket.m_size);
 		}
 
-		// Loop until we receive all the packet data.
-		char buffer[1024];
+		// The size comes from the peer, so a size that cannot be right closes the connection instead of allocating it.
+		if (packetSize > MAX_PACKET_SIZE)
+		{
+			Log::Error("Received packet of %i bytes, larger than the maximum of %i, disconnecting\n", packetSize, MAX_PACKET_SIZE);
+			Disconnect();
+			return SOCKET_STATUS_ERROR;
+		}
 
-		while (m_pendingPacket.m_data.size() < packetSize)
+		// Loop until we receive all the packet data, straight into the pending buffer. The buffer grows as bytes arrive, not by the announced size up front.
+		while (m_pendingPacket.m_received < packetSize)
 		{
+			std::size_t chunk = std::min(static_cast<std::size_t>(packetSize) - m_pendingPacket.m_received, receiveChunk);
+
+			if (m_pendingPacket.m_data.size() < m_pendingPacket.m_received + chunk)
+			{
+				m_pendingPacket.m_data.resize(m_pendingPacket.m_received + chunk);
+			}
+
 			// Receive a chunk of data.
-			std::size_t sizeToGet = std::min(static_cast<std::size_t>(packetSize - m_pendingPacket.m_data.size()), sizeof(buffer));
-			SocketStatus status = Receive(buffer, sizeToGet, received);
+			SocketStatus status = Receive(&m_pendingPacket.m_data[0] + m_pendingPacket.m_received, chunk, received);
 
 			if (status != SOCKET_STATUS_DONE)
 			{
 				return status;
 			}
 
-			// Append it into the packet.
-			if (received > 0)
-			{
-				m_pendingPacket.m_data.resize(m_pendingPacket.m_data.size() + received);
-				char *begin = &m_pendingPacket.m_data[0] + m_pendingPacket.m_data.size() - received;
-				std::memcpy(begin, buffer, received);
-			}
+			m_pendingPacket.m_received += received;
 		}
 
 		// We have received all the packet data: we can copy it to the user packet.
-		if (!m_pendingPacket.m_data.empty())
+		if (packetSize > 0)
 		{
-			packet.OnReceive(&m_pendingPacket.m_data[0], m_pendingPacket.m_data.size());
+			packet.Reserve(packetSize);
+			packet.OnReceive(&m_pendingPacket.m_data[0], packetSize);
 		}
 
-		// Clear the pending packet data.
-		m_pendingPacket = PendingPacket();
+		// Clear the pending packet, its buffer is kept for the next packet.
+		m_pendingPacket.m_size = 0;
+		m_pendingPacket.m_sizeReceived = 0;
+		m_pendingPacket.m_received = 0;
 		return SOCKET_STATUS_DONE;
 	}
 }
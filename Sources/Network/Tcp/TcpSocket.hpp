@@ -20,6 +20,7 @@ namespace acid
 		PendingPacket() :
 			m_size(0),
 			m_sizeReceived(0),
+			m_received(0),
 			m_data(std::vector<char>())
 		{
 		}
@@ -28,6 +29,8 @@ namespace acid
 		uint32_t m_size;
 		/// Number of size bytes received so far.
 		std::size_t m_sizeReceived;
+		/// Number of data bytes received so far.
+		std::size_t m_received;
 		/// Data of the packet.
 		std::vector<char> m_data;
 	};
@@ -44,6 +47,11 @@ namespace acid
 		/// Temporary data of the packet currently being received.
 		PendingPacket m_pendingPacket;
 	public:
+		/// <summary>
+		/// The largest packet that will be received, the connection is closed if a peer announces a larger one.
+		/// </summary>
+		static const uint32_t MAX_PACKET_SIZE;
+
 		/// <summary>
 		/// Default constructor.
 		/// </summary>
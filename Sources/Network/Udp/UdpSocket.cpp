@@ -1,17 +1,31 @@
 #include "UdpSocket.hpp"
 
 #include <algorithm>
+#include <cstring>
 #include "Engine/Log.hpp"
 #include "Network/IpAddress.hpp"
 #include "Network/Packet.hpp"
 
+#if defined(ACID_BUILD_LINUX)
+#include <errno.h>
+#include <netinet/udp.h>
+#include <sys/uio.h>
+
+#if !defined(UDP_SEGMENT)
+#define UDP_SEGMENT 103
+#endif
+#endif
+
 namespace acid
 {
 	const uint32_t UdpSocket::MAX_DATAGRAM_SIZE = 65507;
+	const uint32_t UdpSocket::MAX_BATCH_SIZE = 64;
+	const uint32_t UdpSocket::MAX_SEGMENTS = 64;
 
 	UdpSocket::UdpSocket() :
 		Socket(SOCKET_TYPE_UDP),
-		m_buffer(MAX_DATAGRAM_SIZE)
+		m_buffer(MAX_DATAGRAM_SIZE),
+		m_segmentation(true)
 	{
 	}
 
@@ -168,4 +182,241 @@ namespace acid
 
 		return status;
 	}
+
+	SocketStatus UdpSocket::Send(UdpDatagram *datagrams, const std::size_t &count, std::size_t &sent)
+	{
+		sent = 0;
+
+		// Create the internal socket if it doesn't exist.
+		Create();
+
+		for (std::size_t i = 0; i < count; i++)
+		{
+			if (datagrams[i].size > MAX_DATAGRAM_SIZE)
+			{
+				Log::Error("Cannot send data over the network (the number of bytes to send is greater than UdpSocket::MAX_DATAGRAM_SIZE)\n");
+				return SOCKET_STATUS_ERROR;
+			}
+		}
+
+#if defined(ACID_BUILD_LINUX)
+		mmsghdr headers[MAX_BATCH_SIZE];
+		iovec vectors[MAX_BATCH_SIZE];
+		sockaddr_in addresses[MAX_BATCH_SIZE];
+
+		while (sent < count)
+		{
+			std::size_t batch = std::min<std::size_t>(count - sent, MAX_BATCH_SIZE);
+
+			for (std::size_t i = 0; i < batch; i++)
+			{
+				auto &datagram = datagrams[sent + i];
+				addresses[i] = Socket::CreateAddress(datagram.remoteAddress.ToInteger(), datagram.remotePort);
+				vectors[i].iov_base = datagram.data;
+				vectors[i].iov_len = datagram.size;
+				std::memset(&headers[i], 0, sizeof(mmsghdr));
+				headers[i].msg_hdr.msg_name = &addresses[i];
+				headers[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+				headers[i].msg_hdr.msg_iov = &vectors[i];
+				headers[i].msg_hdr.msg_iovlen = 1;
+			}
+
+			int result = sendmmsg(GetHandle(), headers, static_cast<unsigned int>(batch), 0);
+
+			if (result < 0)
+			{
+				SocketStatus status = Socket::GetErrorStatus();
+				return (sent > 0 && status == SOCKET_STATUS_NOT_READY) ? SOCKET_STATUS_PARTIAL : status;
+			}
+
+			sent += static_cast<std::size_t>(result);
+		}
+#else
+		for (; sent < count; sent++)
+		{
+			auto &datagram = datagrams[sent];
+			SocketStatus status = Send(datagram.data, datagram.size, datagram.remoteAddress, datagram.remotePort);
+
+			if (status != SOCKET_STATUS_DONE)
+			{
+				return (sent > 0 && status == SOCKET_STATUS_NOT_READY) ? SOCKET_STATUS_PARTIAL : status;
+			}
+		}
+#endif
+
+		return SOCKET_STATUS_DONE;
+	}
+
+	SocketStatus UdpSocket::Receive(UdpDatagram *datagrams, const std::size_t &count, std::size_t &received)
+	{
+		received = 0;
+
+#if defined(ACID_BUILD_LINUX)
+		mmsghdr headers[MAX_BATCH_SIZE];
+		iovec vectors[MAX_BATCH_SIZE];
+		sockaddr_in addresses[MAX_BATCH_SIZE];
+
+		while (received < count)
+		{
+			std::size_t batch = std::min<std::size_t>(count - received, MAX_BATCH_SIZE);
+
+			for (std::size_t i = 0; i < batch; i++)
+			{
+				auto &datagram = datagrams[received + i];
+				vectors[i].iov_base = datagram.data;
+				vectors[i].iov_len = datagram.size;
+				std::memset(&headers[i], 0, sizeof(mmsghdr));
+				headers[i].msg_hdr.msg_name = &addresses[i];
+				headers[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+				headers[i].msg_hdr.msg_iov = &vectors[i];
+				headers[i].msg_hdr.msg_iovlen = 1;
+			}
+
+			// Only the first call may wait, later batches just take what has already arrived.
+			int result = recvmmsg(GetHandle(), headers, static_cast<unsigned int>(batch), received == 0 ? MSG_WAITFORONE : MSG_DONTWAIT, nullptr);
+
+			if (result < 0)
+			{
+				return received > 0 ? SOCKET_STATUS_DONE : Socket::GetErrorStatus();
+			}
+
+			for (int i = 0; i < result; i++)
+			{
+				auto &datagram = datagrams[received + i];
+				datagram.received = headers[i].msg_len;
+				datagram.remoteAddress = IpAddress(ntohl(addresses[i].sin_addr.s_addr));
+				datagram.remotePort = ntohs(addresses[i].sin_port);
+			}
+
+			received += static_cast<std::size_t>(result);
+
+			if (static_cast<std::size_t>(result) < batch)
+			{
+				break;
+			}
+		}
+#else
+		while (received < count)
+		{
+			auto &datagram = datagrams[received];
+			SocketStatus status = Receive(datagram.data, datagram.size, datagram.received, datagram.remoteAddress, datagram.remotePort);
+
+			if (status != SOCKET_STATUS_DONE)
+			{
+				return (received > 0 && status == SOCKET_STATUS_NOT_READY) ? SOCKET_STATUS_DONE : status;
+			}
+
+			received++;
+
+			// Another receive could block, so a blocking socket returns after the first datagram.
+			if (IsBlocking())
+			{
+				break;
+			}
+		}
+#endif
+
+		return SOCKET_STATUS_DONE;
+	}
+
+	SocketStatus UdpSocket::SendSegmented(const void *data, const std::size_t &size, const std::size_t &segmentSize, const IpAddress &remoteAddress,
+		const unsigned short &remotePort, std::size_t &sent)
+	{
+		sent = 0;
+
+		// Create the internal socket if it doesn't exist.
+		Create();
+
+		if (segmentSize == 0 || segmentSize > MAX_DATAGRAM_SIZE)
+		{
+			Log::Error("Cannot send data over the network (the segment size must be between 1 and UdpSocket::MAX_DATAGRAM_SIZE)\n");
+			return SOCKET_STATUS_ERROR;
+		}
+
+		std::size_t offset = 0;
+
+#if defined(ACID_BUILD_LINUX)
+		// Each send can carry at most MAX_SEGMENTS datagrams and MAX_DATAGRAM_SIZE bytes.
+		std::size_t sendSize = std::min<std::size_t>(MAX_SEGMENTS, MAX_DATAGRAM_SIZE / segmentSize) * segmentSize;
+		sockaddr_in address = Socket::CreateAddress(remoteAddress.ToInteger(), remotePort);
+
+		while (m_segmentation && offset < size)
+		{
+			std::size_t length = std::min(size - offset, sendSize);
+
+			iovec vector;
+			vector.iov_base = const_cast<char *>(static_cast<const char *>(data) + offset);
+			vector.iov_len = length;
+
+			msghdr message = {};
+			message.msg_name = &address;
+			message.msg_namelen = sizeof(address);
+			message.msg_iov = &vector;
+			message.msg_iovlen = 1;
+
+			alignas(cmsghdr) char control[CMSG_SPACE(sizeof(uint16_t))] = {};
+
+			if (length > segmentSize)
+			{
+				message.msg_control = control;
+				message.msg_controllen = sizeof(control);
+
+				cmsghdr *header = CMSG_FIRSTHDR(&message);
+				header->cmsg_level = SOL_UDP;
+				header->cmsg_type = UDP_SEGMENT;
+				header->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+				uint16_t segment = static_cast<uint16_t>(segmentSize);
+				std::memcpy(CMSG_DATA(header), &segment, sizeof(segment));
+			}
+
+			if (sendmsg(GetHandle(), &message, 0) < 0)
+			{
+				// Older kernels and some devices refuse segmentation, from then on the datagrams are batched instead.
+				if (errno == EINVAL || errno == ENOPROTOOPT || errno == EOPNOTSUPP || errno == EIO)
+				{
+					m_segmentation = false;
+					break;
+				}
+
+				SocketStatus status = Socket::GetErrorStatus();
+				return (sent > 0 && status == SOCKET_STATUS_NOT_READY) ? SOCKET_STATUS_PARTIAL : status;
+			}
+
+			offset += length;
+			sent = offset;
+		}
+#endif
+
+		UdpDatagram datagrams[MAX_BATCH_SIZE];
+
+		while (offset < size)
+		{
+			std::size_t batch = 0;
+
+			for (; batch < MAX_BATCH_SIZE && offset < size; batch++)
+			{
+				std::size_t length = std::min(size - offset, segmentSize);
+				datagrams[batch].data = const_cast<char *>(static_cast<const char *>(data) + offset);
+				datagrams[batch].size = length;
+				datagrams[batch].remoteAddress = remoteAddress;
+				datagrams[batch].remotePort = remotePort;
+				offset += length;
+			}
+
+			std::size_t batchSent = 0;
+			SocketStatus status = Send(datagrams, batch, batchSent);
+
+			for (std::size_t i = 0; i < batchSent; i++)
+			{
+				sent += datagrams[i].size;
+			}
+
+			if (status != SOCKET_STATUS_DONE)
+			{
+				return (sent > 0 && (status == SOCKET_STATUS_NOT_READY || status == SOCKET_STATUS_PARTIAL)) ? SOCKET_STATUS_PARTIAL : status;
+			}
+		}
+
+		return SOCKET_STATUS_DONE;
+	}
 }
@@ -9,6 +9,23 @@ namespace acid
 {
 	class Packet;
 
+	/// <summary>
+	/// A datagram for the batched send and receive functions, the bytes live in memory owned by the caller.
+	/// </summary>
+	struct UdpDatagram
+	{
+		/// The bytes to send, or the buffer to receive into.
+		void *data;
+		/// The number of bytes to send, or the capacity of the receive buffer.
+		std::size_t size;
+		/// Filled with the number of bytes received.
+		std::size_t received;
+		/// The receiver, or filled with the sender.
+		IpAddress remoteAddress;
+		/// The receivers port, or filled with the senders port.
+		unsigned short remotePort;
+	};
+
 	/// <summary>
 	/// Specialized socket using the UDP protocol.
 	/// </summary>
@@ -18,8 +35,12 @@ namespace acid
 	private:
 		/// Temporary buffer holding the received data in Receive(Packet).
 		std::vector<char> m_buffer;
+		/// If the kernel has not yet refused segmentation offload.
+		bool m_segmentation;
 	public:
 		static const uint32_t MAX_DATAGRAM_SIZE;
+		static const uint32_t MAX_BATCH_SIZE;
+		static const uint32_t MAX_SEGMENTS;
 
 		/// <summary>
 		/// Default constructor.
@@ -97,5 +118,40 @@ namespace acid
 		/// <param name="remotePort"> Port of the peer that sent the data. </param>
 		/// <returns> Status code. </returns>
 		SocketStatus Receive(Packet &packet, IpAddress &remoteAddress, unsigned short &remotePort);
+
+		/// <summary>
+		/// Send many datagrams, each to its own peer. On Linux up to MAX_BATCH_SIZE datagrams are sent per system call with sendmmsg,
+		/// other platforms send them one at a time. The data is sent straight from the callers buffers.
+		/// </summary>
+		/// <param name="datagrams"> The datagrams to send. </param>
+		/// <param name="count"> The number of datagrams. </param>
+		/// <param name="sent"> This variable is filled with the number of datagrams sent. </param>
+		/// <returns> Status code, SOCKET_STATUS_PARTIAL if a non-blocking socket could only send some of the datagrams. </returns>
+		SocketStatus Send(UdpDatagram *datagrams, const std::size_t &count, std::size_t &sent);
+
+		/// <summary>
+		/// Receive as many waiting datagrams as fit, straight into the callers buffers. On Linux this is done with recvmmsg.
+		/// In blocking mode, this function waits for the first datagram and then takes whatever else has already arrived.
+		/// </summary>
+		/// <param name="datagrams"> The datagrams to fill, each with a buffer and its capacity. </param>
+		/// <param name="count"> The number of datagrams. </param>
+		/// <param name="received"> This variable is filled with the number of datagrams received. </param>
+		/// <returns> Status code. </returns>
+		SocketStatus Receive(UdpDatagram *datagrams, const std::size_t &count, std::size_t &received);
+
+		/// <summary>
+		/// Send a run of equally sized datagrams to one peer. The data is split into datagrams of segmentSize bytes, the last may be shorter.
+		/// On Linux the kernel splits it with UDP segmentation offload, so up to MAX_SEGMENTS datagrams cost one system call.
+		/// If the kernel does not support it the datagrams are sent with <see cref="Send(UdpDatagram *, const std::size_t &, std::size_t &)"/>.
+		/// </summary>
+		/// <param name="data"> Pointer to the datagrams, back to back. </param>
+		/// <param name="size"> Number of bytes to send. </param>
+		/// <param name="segmentSize"> The size of each datagram. </param>
+		/// <param name="remoteAddress"> Address of the receiver. </param>
+		/// <param name="remotePort"> Port of the receiver to send the data to. </param>
+		/// <param name="sent"> This variable is filled with the number of bytes sent, always a whole number of datagrams. </param>
+		/// <returns> Status code, SOCKET_STATUS_PARTIAL if a non-blocking socket could only send some of the datagrams. </returns>
+		SocketStatus SendSegmented(const void *data, const std::size_t &size, const std::size_t &segmentSize, const IpAddress &remoteAddress, const unsigned short &remotePort,
+			std::size_t &sent);
 	};
 }
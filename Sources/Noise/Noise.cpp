@@ -1,7 +1,12 @@
 ﻿#include "Noise.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <random>
+#include <vector>
+#include "Engine/Engine.hpp"
+#include "Maths/Simd.hpp"
 
 namespace acid
 {
@@ -94,6 +99,109 @@ namespace acid
 		-0.8666666667f, -0.1529411765f,
 	};
 
+	// Batch
+	template<typename Function>
+	static void ForEachRows(const uint32_t &rows, const Function &function)
+	{
+		if (Engine::Get() == nullptr)
+		{
+			function(0, rows);
+			return;
+		}
+
+		// Rows are handed out in runs, so each run sets up its scratch rows once.
+		auto threadPool = Engine::Get()->GetThreadPool();
+		uint32_t runs = std::min(rows, 4 * (threadPool->GetThreadCount() + 1));
+
+		threadPool->ParallelFor(0, runs, [&](const uint32_t &run)
+		{
+			function(static_cast<uint32_t>(static_cast<uint64_t>(rows) * run / runs), static_cast<uint32_t>(static_cast<uint64_t>(rows) * (run + 1) / runs));
+		}, 1);
+	}
+
+#if defined(ACID_SIMD_SSE)
+	// Matches FastFloor, which also steps negative whole numbers down by one.
+	static __m128i FloorSse(const __m128 &f)
+	{
+		return _mm_add_epi32(_mm_cvttps_epi32(f), _mm_castps_si128(_mm_cmplt_ps(f, _mm_setzero_ps())));
+	}
+
+	static __m128 LerpSse(const __m128 &a, const __m128 &b, const __m128 &t)
+	{
+		return _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(b, a)));
+	}
+
+	static __m128 InterpSse(const NoiseInterp &interp, const __m128 &t)
+	{
+		switch (interp)
+		{
+		case NOISE_INTERP_HERMITE:
+			return _mm_mul_ps(_mm_mul_ps(t, t), _mm_sub_ps(_mm_set1_ps(3.0f), _mm_mul_ps(_mm_set1_ps(2.0f), t)));
+		case NOISE_INTERP_QUINTIC:
+			return _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(t, t), t),
+				_mm_add_ps(_mm_mul_ps(t, _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f))), _mm_set1_ps(10.0f)));
+		default:
+			return t;
+		}
+	}
+
+	// Matches FastRound, which rounds halves away from zero.
+	static __m128i RoundSse(const __m128 &f)
+	{
+		__m128 half = _mm_or_ps(_mm_and_ps(_mm_cmpge_ps(f, _mm_setzero_ps()), _mm_set1_ps(0.5f)), _mm_andnot_ps(_mm_cmpge_ps(f, _mm_setzero_ps()), _mm_set1_ps(-0.5f)));
+		return _mm_cvttps_epi32(_mm_add_ps(f, half));
+	}
+
+	static __m128 SelectSse(const __m128 &mask, const __m128 &a, const __m128 &b)
+	{
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+	}
+
+	static __m128i SelectSse(const __m128 &mask, const __m128i &a, const __m128i &b)
+	{
+		return _mm_castps_si128(SelectSse(mask, _mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+	}
+
+	// A simplex corner adds t^4 times its gradient, or nothing once t is below zero.
+	static __m128 SimplexCornerSse(const __m128 &t, const __m128 &gradient)
+	{
+		__m128 t2 = _mm_mul_ps(t, t);
+		return _mm_andnot_ps(_mm_cmplt_ps(t, _mm_setzero_ps()), _mm_mul_ps(_mm_mul_ps(t2, t2), gradient));
+	}
+
+	static __m128 AbsSse(const __m128 &f)
+	{
+		return _mm_andnot_ps(_mm_set1_ps(-0.0f), f);
+	}
+
+	static __m128 CellularDistanceSse(const NoiseCellularFunc &function, const __m128 &vecX, const __m128 &vecY)
+	{
+		switch (function)
+		{
+		case NOISE_CELLULAR_MANHATTAN:
+			return _mm_add_ps(AbsSse(vecX), AbsSse(vecY));
+		case NOISE_CELLULAR_NATURAL:
+			return _mm_add_ps(_mm_add_ps(AbsSse(vecX), AbsSse(vecY)), _mm_add_ps(_mm_mul_ps(vecX, vecX), _mm_mul_ps(vecY, vecY)));
+		default:
+			return _mm_add_ps(_mm_mul_ps(vecX, vecX), _mm_mul_ps(vecY, vecY));
+		}
+	}
+
+	static __m128 CellularDistanceSse(const NoiseCellularFunc &function, const __m128 &vecX, const __m128 &vecY, const __m128 &vecZ)
+	{
+		switch (function)
+		{
+		case NOISE_CELLULAR_MANHATTAN:
+			return _mm_add_ps(_mm_add_ps(AbsSse(vecX), AbsSse(vecY)), AbsSse(vecZ));
+		case NOISE_CELLULAR_NATURAL:
+			return _mm_add_ps(_mm_add_ps(_mm_add_ps(AbsSse(vecX), AbsSse(vecY)), AbsSse(vecZ)),
+				_mm_add_ps(_mm_add_ps(_mm_mul_ps(vecX, vecX), _mm_mul_ps(vecY, vecY)), _mm_mul_ps(vecZ, vecZ)));
+		default:
+			return _mm_add_ps(_mm_add_ps(_mm_mul_ps(vecX, vecX), _mm_mul_ps(vecY, vecY)), _mm_mul_ps(vecZ, vecZ));
+		}
+	}
+#endif
+
 	static const float F3 = 1.0f / 3.0f;
 	static const float G3 = 1.0f / 6.0f;
 
@@ -901,6 +1009,86 @@ namespace acid
 		return ValueCoord4d(m_seed, x, y, z, w);
 	}
 
+	void Noise::FillGrid2D(const float &originX, const float &originY, const float &step, const uint32_t &width, const uint32_t &height, float *result) const
+	{
+		ForEachRows(height, [&](const uint32_t &firstRow, const uint32_t &lastRow)
+		{
+			if (!IsBatchedType())
+			{
+				for (uint32_t row = firstRow; row < lastRow; row++)
+				{
+					for (uint32_t col = 0; col < width; col++)
+					{
+						result[row * width + col] = GetNoise(originX + static_cast<float>(col) * step, originY + static_cast<float>(row) * step);
+					}
+				}
+
+				return;
+			}
+
+			std::vector<float> x(width);
+			std::vector<float> y(width);
+			std::vector<float> octave(width);
+
+			for (uint32_t row = firstRow; row < lastRow; row++)
+			{
+				float sampleY = (originY + static_cast<float>(row) * step) * m_frequency;
+
+				// Fractals scale the coordinates in place, so they are reset for every row.
+				for (uint32_t col = 0; col < width; col++)
+				{
+					x[col] = (originX + static_cast<float>(col) * step) * m_frequency;
+					y[col] = sampleY;
+				}
+
+				FillBatch(width, x.data(), y.data(), nullptr, octave.data(), result + row * width);
+			}
+		});
+	}
+
+	void Noise::FillGrid3D(const float &originX, const float &originY, const float &originZ, const float &step, const uint32_t &width, const uint32_t &height, const uint32_t &depth,
+		float *result) const
+	{
+		ForEachRows(height * depth, [&](const uint32_t &firstRow, const uint32_t &lastRow)
+		{
+			if (!IsBatchedType())
+			{
+				for (uint32_t row = firstRow; row < lastRow; row++)
+				{
+					float sampleY = originY + static_cast<float>(row % height) * step;
+					float sampleZ = originZ + static_cast<float>(row / height) * step;
+
+					for (uint32_t col = 0; col < width; col++)
+					{
+						result[row * width + col] = GetNoise(originX + static_cast<float>(col) * step, sampleY, sampleZ);
+					}
+				}
+
+				return;
+			}
+
+			std::vector<float> x(width);
+			std::vector<float> y(width);
+			std::vector<float> z(width);
+			std::vector<float> octave(width);
+
+			for (uint32_t row = firstRow; row < lastRow; row++)
+			{
+				float sampleY = (originY + static_cast<float>(row % height) * step) * m_frequency;
+				float sampleZ = (originZ + static_cast<float>(row / height) * step) * m_frequency;
+
+				for (uint32_t col = 0; col < width; col++)
+				{
+					x[col] = (originX + static_cast<float>(col) * step) * m_frequency;
+					y[col] = sampleY;
+					z[col] = sampleZ;
+				}
+
+				FillBatch(width, x.data(), y.data(), z.data(), octave.data(), result + row * width);
+			}
+		});
+	}
+
 	void Noise::CalculateFractalBounding()
 	{
 		float amp = m_gain;
@@ -915,6 +1103,757 @@ namespace acid
 		m_fractalBounding = 1.0f / ampFractal;
 	}
 
+	bool Noise::IsBatchedType() const
+	{
+		switch (m_noiseType)
+		{
+		case NOISE_TYPE_VALUE:
+		case NOISE_TYPE_VALUEFRACTAL:
+		case NOISE_TYPE_PERLIN:
+		case NOISE_TYPE_PERLINFRACTAL:
+		case NOISE_TYPE_SIMPLEX:
+		case NOISE_TYPE_SIMPLEXFRACTAL:
+		case NOISE_TYPE_CELLULAR:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	void Noise::FillBatch(const uint32_t &count, float *x, float *y, float *z, float *octave, float *result) const
+	{
+		if (m_noiseType == NOISE_TYPE_CELLULAR)
+		{
+			if (z == nullptr)
+			{
+				SingleCellularBatch(count, x, y, result);
+			}
+			else
+			{
+				SingleCellularBatch(count, x, y, z, result);
+			}
+
+			return;
+		}
+
+		bool gradient = m_noiseType == NOISE_TYPE_PERLIN || m_noiseType == NOISE_TYPE_PERLINFRACTAL;
+
+		auto single = [&](const uint8_t &offset, float *destination)
+		{
+			switch (m_noiseType)
+			{
+			case NOISE_TYPE_SIMPLEX:
+			case NOISE_TYPE_SIMPLEXFRACTAL:
+				if (z == nullptr)
+				{
+					SingleSimplexBatch(offset, count, x, y, destination);
+				}
+				else
+				{
+					SingleSimplexBatch(offset, count, x, y, z, destination);
+				}
+				break;
+			default:
+				if (z == nullptr)
+				{
+					SingleLattice(offset, gradient, count, x, y, destination);
+				}
+				else
+				{
+					SingleLattice(offset, gradient, count, x, y, z, destination);
+				}
+				break;
+			}
+		};
+
+		if (m_noiseType == NOISE_TYPE_VALUE || m_noiseType == NOISE_TYPE_PERLIN || m_noiseType == NOISE_TYPE_SIMPLEX)
+		{
+			single(0, result);
+			return;
+		}
+
+		// Mirrors the Single*Fractal* functions, one octave over the whole row at a time.
+		single(m_perm[0], octave);
+
+		for (uint32_t j = 0; j < count; j++)
+		{
+			switch (m_fractalType)
+			{
+			case NOISE_FRACTAL_FBM:
+				result[j] = octave[j];
+				break;
+			case NOISE_FRACTAL_BILLOW:
+				result[j] = std::fabs(octave[j]) * 2.0f - 1.0f;
+				break;
+			case NOISE_FRACTAL_RIGIDMULTI:
+				result[j] = 1.0f - std::fabs(octave[j]);
+				break;
+			}
+		}
+
+		float amp = 1.0f;
+
+		for (int32_t i = 1; i < m_octaves; i++)
+		{
+			for (uint32_t j = 0; j < count; j++)
+			{
+				x[j] *= m_lacunarity;
+				y[j] *= m_lacunarity;
+
+				if (z != nullptr)
+				{
+					z[j] *= m_lacunarity;
+				}
+			}
+
+			amp *= m_gain;
+			single(m_perm[i], octave);
+
+			for (uint32_t j = 0; j < count; j++)
+			{
+				switch (m_fractalType)
+				{
+				case NOISE_FRACTAL_FBM:
+					result[j] += octave[j] * amp;
+					break;
+				case NOISE_FRACTAL_BILLOW:
+					result[j] += (std::fabs(octave[j]) * 2.0f - 1.0f) * amp;
+					break;
+				case NOISE_FRACTAL_RIGIDMULTI:
+					result[j] -= (1.0f - std::fabs(octave[j])) * amp;
+					break;
+				}
+			}
+		}
+
+		if (m_fractalType != NOISE_FRACTAL_RIGIDMULTI)
+		{
+			for (uint32_t j = 0; j < count; j++)
+			{
+				result[j] *= m_fractalBounding;
+			}
+		}
+	}
+
+	void Noise::SingleLattice(const uint8_t &offset, const bool &gradient, const uint32_t &count, const float *x, const float *y, float *result) const
+	{
+		uint32_t i = 0;
+
+#if defined(ACID_SIMD_SSE)
+		alignas(16) int32_t xi[4];
+		alignas(16) int32_t yi[4];
+		alignas(16) float corners[4][4];
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 fx = _mm_loadu_ps(x + i);
+			__m128 fy = _mm_loadu_ps(y + i);
+			__m128i x0 = FloorSse(fx);
+			__m128i y0 = FloorSse(fy);
+			_mm_store_si128(reinterpret_cast<__m128i *>(xi), x0);
+			_mm_store_si128(reinterpret_cast<__m128i *>(yi), y0);
+
+			__m128 xd0 = _mm_sub_ps(fx, _mm_cvtepi32_ps(x0));
+			__m128 yd0 = _mm_sub_ps(fy, _mm_cvtepi32_ps(y0));
+			__m128 xs = InterpSse(m_interp, xd0);
+			__m128 ys = InterpSse(m_interp, yd0);
+
+			if (gradient)
+			{
+				alignas(16) float gradX[4][4];
+				alignas(16) float gradY[4][4];
+
+				for (uint32_t lane = 0; lane < 4; lane++)
+				{
+					for (uint32_t corner = 0; corner < 4; corner++)
+					{
+						uint8_t lutPos = Index2d12(offset, xi[lane] + static_cast<int32_t>(corner & 1), yi[lane] + static_cast<int32_t>(corner >> 1));
+						gradX[corner][lane] = GRAD_X[lutPos];
+						gradY[corner][lane] = GRAD_Y[lutPos];
+					}
+				}
+
+				__m128 one = _mm_set1_ps(1.0f);
+				__m128 xd[2] = { xd0, _mm_sub_ps(xd0, one) };
+				__m128 yd[2] = { yd0, _mm_sub_ps(yd0, one) };
+
+				for (uint32_t corner = 0; corner < 4; corner++)
+				{
+					_mm_store_ps(corners[corner], _mm_add_ps(_mm_mul_ps(xd[corner & 1], _mm_load_ps(gradX[corner])),
+						_mm_mul_ps(yd[corner >> 1], _mm_load_ps(gradY[corner]))));
+				}
+			}
+			else
+			{
+				for (uint32_t lane = 0; lane < 4; lane++)
+				{
+					for (uint32_t corner = 0; corner < 4; corner++)
+					{
+						corners[corner][lane] = VAL_LUT[Index2d256(offset, xi[lane] + static_cast<int32_t>(corner & 1), yi[lane] + static_cast<int32_t>(corner >> 1))];
+					}
+				}
+			}
+
+			__m128 xf0 = LerpSse(_mm_load_ps(corners[0]), _mm_load_ps(corners[1]), xs);
+			__m128 xf1 = LerpSse(_mm_load_ps(corners[2]), _mm_load_ps(corners[3]), xs);
+			_mm_storeu_ps(result + i, LerpSse(xf0, xf1, ys));
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			result[i] = gradient ? SinglePerlin(offset, x[i], y[i]) : SingleValue(offset, x[i], y[i]);
+		}
+	}
+
+	void Noise::SingleLattice(const uint8_t &offset, const bool &gradient, const uint32_t &count, const float *x, const float *y, const float *z, float *result) const
+	{
+		uint32_t i = 0;
+
+#if defined(ACID_SIMD_SSE)
+		alignas(16) int32_t xi[4];
+		alignas(16) int32_t yi[4];
+		alignas(16) int32_t zi[4];
+		alignas(16) float corners[8][4];
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 fx = _mm_loadu_ps(x + i);
+			__m128 fy = _mm_loadu_ps(y + i);
+			__m128 fz = _mm_loadu_ps(z + i);
+			__m128i x0 = FloorSse(fx);
+			__m128i y0 = FloorSse(fy);
+			__m128i z0 = FloorSse(fz);
+			_mm_store_si128(reinterpret_cast<__m128i *>(xi), x0);
+			_mm_store_si128(reinterpret_cast<__m128i *>(yi), y0);
+			_mm_store_si128(reinterpret_cast<__m128i *>(zi), z0);
+
+			__m128 xd0 = _mm_sub_ps(fx, _mm_cvtepi32_ps(x0));
+			__m128 yd0 = _mm_sub_ps(fy, _mm_cvtepi32_ps(y0));
+			__m128 zd0 = _mm_sub_ps(fz, _mm_cvtepi32_ps(z0));
+			__m128 xs = InterpSse(m_interp, xd0);
+			__m128 ys = InterpSse(m_interp, yd0);
+			__m128 zs = InterpSse(m_interp, zd0);
+
+			if (gradient)
+			{
+				alignas(16) float gradX[8][4];
+				alignas(16) float gradY[8][4];
+				alignas(16) float gradZ[8][4];
+
+				for (uint32_t lane = 0; lane < 4; lane++)
+				{
+					for (uint32_t corner = 0; corner < 8; corner++)
+					{
+						uint8_t lutPos = Index3d12(offset, xi[lane] + static_cast<int32_t>(corner & 1), yi[lane] + static_cast<int32_t>((corner >> 1) & 1),
+							zi[lane] + static_cast<int32_t>(corner >> 2));
+						gradX[corner][lane] = GRAD_X[lutPos];
+						gradY[corner][lane] = GRAD_Y[lutPos];
+						gradZ[corner][lane] = GRAD_Z[lutPos];
+					}
+				}
+
+				__m128 one = _mm_set1_ps(1.0f);
+				__m128 xd[2] = { xd0, _mm_sub_ps(xd0, one) };
+				__m128 yd[2] = { yd0, _mm_sub_ps(yd0, one) };
+				__m128 zd[2] = { zd0, _mm_sub_ps(zd0, one) };
+
+				for (uint32_t corner = 0; corner < 8; corner++)
+				{
+					__m128 dot = _mm_add_ps(_mm_mul_ps(xd[corner & 1], _mm_load_ps(gradX[corner])), _mm_mul_ps(yd[(corner >> 1) & 1], _mm_load_ps(gradY[corner])));
+					_mm_store_ps(corners[corner], _mm_add_ps(dot, _mm_mul_ps(zd[corner >> 2], _mm_load_ps(gradZ[corner]))));
+				}
+			}
+			else
+			{
+				for (uint32_t lane = 0; lane < 4; lane++)
+				{
+					for (uint32_t corner = 0; corner < 8; corner++)
+					{
+						corners[corner][lane] = VAL_LUT[Index3d256(offset, xi[lane] + static_cast<int32_t>(corner & 1), yi[lane] + static_cast<int32_t>((corner >> 1) & 1),
+							zi[lane] + static_cast<int32_t>(corner >> 2))];
+					}
+				}
+			}
+
+			__m128 xf00 = LerpSse(_mm_load_ps(corners[0]), _mm_load_ps(corners[1]), xs);
+			__m128 xf10 = LerpSse(_mm_load_ps(corners[2]), _mm_load_ps(corners[3]), xs);
+			__m128 xf01 = LerpSse(_mm_load_ps(corners[4]), _mm_load_ps(corners[5]), xs);
+			__m128 xf11 = LerpSse(_mm_load_ps(corners[6]), _mm_load_ps(corners[7]), xs);
+			__m128 yf0 = LerpSse(xf00, xf10, ys);
+			__m128 yf1 = LerpSse(xf01, xf11, ys);
+			_mm_storeu_ps(result + i, LerpSse(yf0, yf1, zs));
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			result[i] = gradient ? SinglePerlin(offset, x[i], y[i], z[i]) : SingleValue(offset, x[i], y[i], z[i]);
+		}
+	}
+
+	void Noise::SingleSimplexBatch(const uint8_t &offset, const uint32_t &count, const float *x, const float *y, float *result) const
+	{
+		uint32_t i = 0;
+
+#if defined(ACID_SIMD_SSE)
+		alignas(16) int32_t cellI[4];
+		alignas(16) int32_t cellJ[4];
+		alignas(16) float stepI[4];
+		alignas(16) float gradX[3][4];
+		alignas(16) float gradY[3][4];
+
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 half = _mm_set1_ps(0.5f);
+		const __m128 g2 = _mm_set1_ps(G2);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 fx = _mm_loadu_ps(x + i);
+			__m128 fy = _mm_loadu_ps(y + i);
+			__m128 t = _mm_mul_ps(_mm_add_ps(fx, fy), _mm_set1_ps(F2));
+			__m128i ci = FloorSse(_mm_add_ps(fx, t));
+			__m128i cj = FloorSse(_mm_add_ps(fy, t));
+			t = _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(ci, cj)), g2);
+
+			__m128 x0 = _mm_sub_ps(fx, _mm_sub_ps(_mm_cvtepi32_ps(ci), t));
+			__m128 y0 = _mm_sub_ps(fy, _mm_sub_ps(_mm_cvtepi32_ps(cj), t));
+
+			// The middle corner steps along x when x0 > y0, otherwise along y.
+			__m128 i1 = _mm_and_ps(_mm_cmpgt_ps(x0, y0), one);
+			__m128 j1 = _mm_sub_ps(one, i1);
+
+			__m128 x1 = _mm_add_ps(_mm_sub_ps(x0, i1), g2);
+			__m128 y1 = _mm_add_ps(_mm_sub_ps(y0, j1), g2);
+			__m128 x2 = _mm_add_ps(_mm_sub_ps(x0, one), _mm_set1_ps(2.0f * G2));
+			__m128 y2 = _mm_add_ps(_mm_sub_ps(y0, one), _mm_set1_ps(2.0f * G2));
+
+			_mm_store_si128(reinterpret_cast<__m128i *>(cellI), ci);
+			_mm_store_si128(reinterpret_cast<__m128i *>(cellJ), cj);
+			_mm_store_ps(stepI, i1);
+
+			for (uint32_t lane = 0; lane < 4; lane++)
+			{
+				auto middle = static_cast<int32_t>(stepI[lane]);
+				uint8_t lutPos[3] = {
+					Index2d12(offset, cellI[lane], cellJ[lane]),
+					Index2d12(offset, cellI[lane] + middle, cellJ[lane] + 1 - middle),
+					Index2d12(offset, cellI[lane] + 1, cellJ[lane] + 1)
+				};
+
+				for (uint32_t corner = 0; corner < 3; corner++)
+				{
+					gradX[corner][lane] = GRAD_X[lutPos[corner]];
+					gradY[corner][lane] = GRAD_Y[lutPos[corner]];
+				}
+			}
+
+			__m128 n0 = SimplexCornerSse(_mm_sub_ps(_mm_sub_ps(half, _mm_mul_ps(x0, x0)), _mm_mul_ps(y0, y0)),
+				_mm_add_ps(_mm_mul_ps(x0, _mm_load_ps(gradX[0])), _mm_mul_ps(y0, _mm_load_ps(gradY[0]))));
+			__m128 n1 = SimplexCornerSse(_mm_sub_ps(_mm_sub_ps(half, _mm_mul_ps(x1, x1)), _mm_mul_ps(y1, y1)),
+				_mm_add_ps(_mm_mul_ps(x1, _mm_load_ps(gradX[1])), _mm_mul_ps(y1, _mm_load_ps(gradY[1]))));
+			__m128 n2 = SimplexCornerSse(_mm_sub_ps(_mm_sub_ps(half, _mm_mul_ps(x2, x2)), _mm_mul_ps(y2, y2)),
+				_mm_add_ps(_mm_mul_ps(x2, _mm_load_ps(gradX[2])), _mm_mul_ps(y2, _mm_load_ps(gradY[2]))));
+			_mm_storeu_ps(result + i, _mm_mul_ps(_mm_set1_ps(70.0f), _mm_add_ps(_mm_add_ps(n0, n1), n2)));
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			result[i] = SingleSimplex(offset, x[i], y[i]);
+		}
+	}
+
+	void Noise::SingleSimplexBatch(const uint8_t &offset, const uint32_t &count, const float *x, const float *y, const float *z, float *result) const
+	{
+		uint32_t i = 0;
+
+#if defined(ACID_SIMD_SSE)
+		alignas(16) int32_t cellI[4];
+		alignas(16) int32_t cellJ[4];
+		alignas(16) int32_t cellK[4];
+		alignas(16) float steps[6][4];
+		alignas(16) float gradX[4][4];
+		alignas(16) float gradY[4][4];
+		alignas(16) float gradZ[4][4];
+
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 limit = _mm_set1_ps(0.6f);
+		const __m128 g3 = _mm_set1_ps(G3);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 fx = _mm_loadu_ps(x + i);
+			__m128 fy = _mm_loadu_ps(y + i);
+			__m128 fz = _mm_loadu_ps(z + i);
+			__m128 t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(fx, fy), fz), _mm_set1_ps(F3));
+			__m128i ci = FloorSse(_mm_add_ps(fx, t));
+			__m128i cj = FloorSse(_mm_add_ps(fy, t));
+			__m128i ck = FloorSse(_mm_add_ps(fz, t));
+			t = _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(_mm_add_epi32(ci, cj), ck)), g3);
+
+			__m128 x0 = _mm_sub_ps(fx, _mm_sub_ps(_mm_cvtepi32_ps(ci), t));
+			__m128 y0 = _mm_sub_ps(fy, _mm_sub_ps(_mm_cvtepi32_ps(cj), t));
+			__m128 z0 = _mm_sub_ps(fz, _mm_sub_ps(_mm_cvtepi32_ps(ck), t));
+
+			// The same corner order as the branches in SingleSimplex, written as masks of the three comparisons.
+			__m128 a = _mm_cmpge_ps(x0, y0);
+			__m128 b = _mm_cmpge_ps(y0, z0);
+			__m128 c = _mm_cmpge_ps(x0, z0);
+			__m128 i1 = _mm_and_ps(_mm_and_ps(a, _mm_or_ps(b, c)), one);
+			__m128 j1 = _mm_and_ps(_mm_andnot_ps(a, b), one);
+			__m128 k1 = _mm_andnot_ps(_mm_or_ps(b, _mm_and_ps(a, c)), one);
+			__m128 i2 = _mm_and_ps(_mm_or_ps(a, _mm_and_ps(b, c)), one);
+			__m128 j2 = _mm_andnot_ps(_mm_andnot_ps(b, a), one);
+			__m128 k2 = _mm_andnot_ps(_mm_and_ps(b, _mm_or_ps(a, c)), one);
+
+			__m128 x1 = _mm_add_ps(_mm_sub_ps(x0, i1), g3);
+			__m128 y1 = _mm_add_ps(_mm_sub_ps(y0, j1), g3);
+			__m128 z1 = _mm_add_ps(_mm_sub_ps(z0, k1), g3);
+			__m128 x2 = _mm_add_ps(_mm_sub_ps(x0, i2), _mm_set1_ps(2.0f * G3));
+			__m128 y2 = _mm_add_ps(_mm_sub_ps(y0, j2), _mm_set1_ps(2.0f * G3));
+			__m128 z2 = _mm_add_ps(_mm_sub_ps(z0, k2), _mm_set1_ps(2.0f * G3));
+			__m128 x3 = _mm_add_ps(_mm_sub_ps(x0, one), _mm_set1_ps(3.0f * G3));
+			__m128 y3 = _mm_add_ps(_mm_sub_ps(y0, one), _mm_set1_ps(3.0f * G3));
+			__m128 z3 = _mm_add_ps(_mm_sub_ps(z0, one), _mm_set1_ps(3.0f * G3));
+
+			_mm_store_si128(reinterpret_cast<__m128i *>(cellI), ci);
+			_mm_store_si128(reinterpret_cast<__m128i *>(cellJ), cj);
+			_mm_store_si128(reinterpret_cast<__m128i *>(cellK), ck);
+			_mm_store_ps(steps[0], i1);
+			_mm_store_ps(steps[1], j1);
+			_mm_store_ps(steps[2], k1);
+			_mm_store_ps(steps[3], i2);
+			_mm_store_ps(steps[4], j2);
+			_mm_store_ps(steps[5], k2);
+
+			for (uint32_t lane = 0; lane < 4; lane++)
+			{
+				int32_t ii = cellI[lane];
+				int32_t jj = cellJ[lane];
+				int32_t kk = cellK[lane];
+				uint8_t lutPos[4] = {
+					Index3d12(offset, ii, jj, kk),
+					Index3d12(offset, ii + static_cast<int32_t>(steps[0][lane]), jj + static_cast<int32_t>(steps[1][lane]), kk + static_cast<int32_t>(steps[2][lane])),
+					Index3d12(offset, ii + static_cast<int32_t>(steps[3][lane]), jj + static_cast<int32_t>(steps[4][lane]), kk + static_cast<int32_t>(steps[5][lane])),
+					Index3d12(offset, ii + 1, jj + 1, kk + 1)
+				};
+
+				for (uint32_t corner = 0; corner < 4; corner++)
+				{
+					gradX[corner][lane] = GRAD_X[lutPos[corner]];
+					gradY[corner][lane] = GRAD_Y[lutPos[corner]];
+					gradZ[corner][lane] = GRAD_Z[lutPos[corner]];
+				}
+			}
+
+			__m128 xd[4] = {x0, x1, x2, x3};
+			__m128 yd[4] = {y0, y1, y2, y3};
+			__m128 zd[4] = {z0, z1, z2, z3};
+			__m128 n[4];
+
+			for (uint32_t corner = 0; corner < 4; corner++)
+			{
+				__m128 t2 = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(limit, _mm_mul_ps(xd[corner], xd[corner])), _mm_mul_ps(yd[corner], yd[corner])), _mm_mul_ps(zd[corner], zd[corner]));
+				__m128 gradient = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xd[corner], _mm_load_ps(gradX[corner])), _mm_mul_ps(yd[corner], _mm_load_ps(gradY[corner]))),
+					_mm_mul_ps(zd[corner], _mm_load_ps(gradZ[corner])));
+				n[corner] = SimplexCornerSse(t2, gradient);
+			}
+
+			_mm_storeu_ps(result + i, _mm_mul_ps(_mm_set1_ps(32.0f), _mm_add_ps(_mm_add_ps(_mm_add_ps(n[0], n[1]), n[2]), n[3])));
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			result[i] = SingleSimplex(offset, x[i], y[i], z[i]);
+		}
+	}
+
+	void Noise::SingleCellularBatch(const uint32_t &count, const float *x, const float *y, float *result) const
+	{
+		uint32_t i = 0;
+
+#if defined(ACID_SIMD_SSE)
+		bool edge = m_cellularReturnType != NOISE_CELLULAR_CELLVALUE && m_cellularReturnType != NOISE_CELLULAR_NOISELOOKUP &&
+			m_cellularReturnType != NOISE_CELLULAR_DISTANCE;
+		alignas(16) int32_t roundX[4];
+		alignas(16) int32_t roundY[4];
+		alignas(16) int32_t closestX[4];
+		alignas(16) int32_t closestY[4];
+		alignas(16) float cellX[4];
+		alignas(16) float cellY[4];
+
+		const __m128 jitter = _mm_set1_ps(m_cellularJitter);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 fx = _mm_loadu_ps(x + i);
+			__m128 fy = _mm_loadu_ps(y + i);
+			__m128i xr = RoundSse(fx);
+			__m128i yr = RoundSse(fy);
+			_mm_store_si128(reinterpret_cast<__m128i *>(roundX), xr);
+			_mm_store_si128(reinterpret_cast<__m128i *>(roundY), yr);
+
+			__m128 distance[FN_CELLULAR_INDEX_MAX + 1];
+			__m128i xc = _mm_setzero_si128();
+			__m128i yc = _mm_setzero_si128();
+
+			for (auto &d : distance)
+			{
+				d = _mm_set1_ps(999999.0f);
+			}
+
+			// Neighbours are visited in the scalar order, so ties pick the same cell.
+			for (int32_t dx = -1; dx <= 1; dx++)
+			{
+				__m128i xi = _mm_add_epi32(xr, _mm_set1_epi32(dx));
+
+				for (int32_t dy = -1; dy <= 1; dy++)
+				{
+					__m128i yi = _mm_add_epi32(yr, _mm_set1_epi32(dy));
+
+					for (uint32_t lane = 0; lane < 4; lane++)
+					{
+						uint8_t lutPos = Index2d256(0, roundX[lane] + dx, roundY[lane] + dy);
+						cellX[lane] = CELL_2D_X[lutPos];
+						cellY[lane] = CELL_2D_Y[lutPos];
+					}
+
+					__m128 vecX = _mm_add_ps(_mm_sub_ps(_mm_cvtepi32_ps(xi), fx), _mm_mul_ps(_mm_load_ps(cellX), jitter));
+					__m128 vecY = _mm_add_ps(_mm_sub_ps(_mm_cvtepi32_ps(yi), fy), _mm_mul_ps(_mm_load_ps(cellY), jitter));
+					__m128 newDistance = CellularDistanceSse(m_cellularDistanceFunction, vecX, vecY);
+
+					if (edge)
+					{
+						for (int32_t j = m_cellularDistanceIndex1; j > 0; j--)
+						{
+							distance[j] = _mm_max_ps(_mm_min_ps(distance[j], newDistance), distance[j - 1]);
+						}
+
+						distance[0] = _mm_min_ps(distance[0], newDistance);
+						continue;
+					}
+
+					__m128 closer = _mm_cmplt_ps(newDistance, distance[0]);
+					distance[0] = SelectSse(closer, newDistance, distance[0]);
+					xc = SelectSse(closer, xi, xc);
+					yc = SelectSse(closer, yi, yc);
+				}
+			}
+
+			switch (m_cellularReturnType)
+			{
+			case NOISE_CELLULAR_CELLVALUE:
+			case NOISE_CELLULAR_NOISELOOKUP:
+				_mm_store_si128(reinterpret_cast<__m128i *>(closestX), xc);
+				_mm_store_si128(reinterpret_cast<__m128i *>(closestY), yc);
+
+				for (uint32_t lane = 0; lane < 4; lane++)
+				{
+					if (m_cellularReturnType == NOISE_CELLULAR_CELLVALUE)
+					{
+						result[i + lane] = ValueCoord2d(m_seed, closestX[lane], closestY[lane]);
+						continue;
+					}
+
+					assert(m_cellularNoiseLookup);
+
+					uint8_t lutPos = Index2d256(0, closestX[lane], closestY[lane]);
+					result[i + lane] = m_cellularNoiseLookup->GetNoise(closestX[lane] + CELL_2D_X[lutPos] * m_cellularJitter, closestY[lane] + CELL_2D_Y[lutPos] * m_cellularJitter);
+				}
+				break;
+			case NOISE_CELLULAR_DISTANCE:
+				_mm_storeu_ps(result + i, distance[0]);
+				break;
+			case NOISE_CELLULAR_DISTANCE2:
+				_mm_storeu_ps(result + i, distance[m_cellularDistanceIndex1]);
+				break;
+			case NOISE_CELLULAR_DISTANCE2ADD:
+				_mm_storeu_ps(result + i, _mm_add_ps(distance[m_cellularDistanceIndex1], distance[m_cellularDistanceIndex0]));
+				break;
+			case NOISE_CELLULAR_DISTANCE2SUB:
+				_mm_storeu_ps(result + i, _mm_sub_ps(distance[m_cellularDistanceIndex1], distance[m_cellularDistanceIndex0]));
+				break;
+			case NOISE_CELLULAR_DISTANCE2MUL:
+				_mm_storeu_ps(result + i, _mm_mul_ps(distance[m_cellularDistanceIndex1], distance[m_cellularDistanceIndex0]));
+				break;
+			case NOISE_CELLULAR_DISTANCE2DIV:
+				_mm_storeu_ps(result + i, _mm_div_ps(distance[m_cellularDistanceIndex0], distance[m_cellularDistanceIndex1]));
+				break;
+			default:
+				_mm_storeu_ps(result + i, _mm_setzero_ps());
+				break;
+			}
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			switch (m_cellularReturnType)
+			{
+			case NOISE_CELLULAR_CELLVALUE:
+			case NOISE_CELLULAR_NOISELOOKUP:
+			case NOISE_CELLULAR_DISTANCE:
+				result[i] = SingleCellular(x[i], y[i]);
+				break;
+			default:
+				result[i] = SingleCellular2Edge(x[i], y[i]);
+				break;
+			}
+		}
+	}
+
+	void Noise::SingleCellularBatch(const uint32_t &count, const float *x, const float *y, const float *z, float *result) const
+	{
+		uint32_t i = 0;
+
+#if defined(ACID_SIMD_SSE)
+		bool edge = m_cellularReturnType != NOISE_CELLULAR_CELLVALUE && m_cellularReturnType != NOISE_CELLULAR_NOISELOOKUP &&
+			m_cellularReturnType != NOISE_CELLULAR_DISTANCE;
+		alignas(16) int32_t roundX[4];
+		alignas(16) int32_t roundY[4];
+		alignas(16) int32_t roundZ[4];
+		alignas(16) int32_t closestX[4];
+		alignas(16) int32_t closestY[4];
+		alignas(16) int32_t closestZ[4];
+		alignas(16) float cellX[4];
+		alignas(16) float cellY[4];
+		alignas(16) float cellZ[4];
+
+		const __m128 jitter = _mm_set1_ps(m_cellularJitter);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 fx = _mm_loadu_ps(x + i);
+			__m128 fy = _mm_loadu_ps(y + i);
+			__m128 fz = _mm_loadu_ps(z + i);
+			__m128i xr = RoundSse(fx);
+			__m128i yr = RoundSse(fy);
+			__m128i zr = RoundSse(fz);
+			_mm_store_si128(reinterpret_cast<__m128i *>(roundX), xr);
+			_mm_store_si128(reinterpret_cast<__m128i *>(roundY), yr);
+			_mm_store_si128(reinterpret_cast<__m128i *>(roundZ), zr);
+
+			__m128 distance[FN_CELLULAR_INDEX_MAX + 1];
+			__m128i xc = _mm_setzero_si128();
+			__m128i yc = _mm_setzero_si128();
+			__m128i zc = _mm_setzero_si128();
+
+			for (auto &d : distance)
+			{
+				d = _mm_set1_ps(999999.0f);
+			}
+
+			for (int32_t dx = -1; dx <= 1; dx++)
+			{
+				__m128i xi = _mm_add_epi32(xr, _mm_set1_epi32(dx));
+
+				for (int32_t dy = -1; dy <= 1; dy++)
+				{
+					__m128i yi = _mm_add_epi32(yr, _mm_set1_epi32(dy));
+
+					for (int32_t dz = -1; dz <= 1; dz++)
+					{
+						__m128i zi = _mm_add_epi32(zr, _mm_set1_epi32(dz));
+
+						for (uint32_t lane = 0; lane < 4; lane++)
+						{
+							uint8_t lutPos = Index3d256(0, roundX[lane] + dx, roundY[lane] + dy, roundZ[lane] + dz);
+							cellX[lane] = CELL_3D_X[lutPos];
+							cellY[lane] = CELL_3D_Y[lutPos];
+							cellZ[lane] = CELL_3D_Z[lutPos];
+						}
+
+						__m128 vecX = _mm_add_ps(_mm_sub_ps(_mm_cvtepi32_ps(xi), fx), _mm_mul_ps(_mm_load_ps(cellX), jitter));
+						__m128 vecY = _mm_add_ps(_mm_sub_ps(_mm_cvtepi32_ps(yi), fy), _mm_mul_ps(_mm_load_ps(cellY), jitter));
+						__m128 vecZ = _mm_add_ps(_mm_sub_ps(_mm_cvtepi32_ps(zi), fz), _mm_mul_ps(_mm_load_ps(cellZ), jitter));
+						__m128 newDistance = CellularDistanceSse(m_cellularDistanceFunction, vecX, vecY, vecZ);
+
+						if (edge)
+						{
+							for (int32_t j = m_cellularDistanceIndex1; j > 0; j--)
+							{
+								distance[j] = _mm_max_ps(_mm_min_ps(distance[j], newDistance), distance[j - 1]);
+							}
+
+							distance[0] = _mm_min_ps(distance[0], newDistance);
+							continue;
+						}
+
+						__m128 closer = _mm_cmplt_ps(newDistance, distance[0]);
+						distance[0] = SelectSse(closer, newDistance, distance[0]);
+						xc = SelectSse(closer, xi, xc);
+						yc = SelectSse(closer, yi, yc);
+						zc = SelectSse(closer, zi, zc);
+					}
+				}
+			}
+
+			switch (m_cellularReturnType)
+			{
+			case NOISE_CELLULAR_CELLVALUE:
+			case NOISE_CELLULAR_NOISELOOKUP:
+				_mm_store_si128(reinterpret_cast<__m128i *>(closestX), xc);
+				_mm_store_si128(reinterpret_cast<__m128i *>(closestY), yc);
+				_mm_store_si128(reinterpret_cast<__m128i *>(closestZ), zc);
+
+				for (uint32_t lane = 0; lane < 4; lane++)
+				{
+					if (m_cellularReturnType == NOISE_CELLULAR_CELLVALUE)
+					{
+						result[i + lane] = ValueCoord3d(m_seed, closestX[lane], closestY[lane], closestZ[lane]);
+						continue;
+					}
+
+					assert(m_cellularNoiseLookup);
+
+					uint8_t lutPos = Index3d256(0, closestX[lane], closestY[lane], closestZ[lane]);
+					result[i + lane] = m_cellularNoiseLookup->GetNoise(closestX[lane] + CELL_3D_X[lutPos] * m_cellularJitter,
+						closestY[lane] + CELL_3D_Y[lutPos] * m_cellularJitter, closestZ[lane] + CELL_3D_Z[lutPos] * m_cellularJitter);
+				}
+				break;
+			case NOISE_CELLULAR_DISTANCE:
+				_mm_storeu_ps(result + i, distance[0]);
+				break;
+			case NOISE_CELLULAR_DISTANCE2:
+				_mm_storeu_ps(result + i, distance[m_cellularDistanceIndex1]);
+				break;
+			case NOISE_CELLULAR_DISTANCE2ADD:
+				_mm_storeu_ps(result + i, _mm_add_ps(distance[m_cellularDistanceIndex1], distance[m_cellularDistanceIndex0]));
+				break;
+			case NOISE_CELLULAR_DISTANCE2SUB:
+				_mm_storeu_ps(result + i, _mm_sub_ps(distance[m_cellularDistanceIndex1], distance[m_cellularDistanceIndex0]));
+				break;
+			case NOISE_CELLULAR_DISTANCE2MUL:
+				_mm_storeu_ps(result + i, _mm_mul_ps(distance[m_cellularDistanceIndex1], distance[m_cellularDistanceIndex0]));
+				break;
+			case NOISE_CELLULAR_DISTANCE2DIV:
+				_mm_storeu_ps(result + i, _mm_div_ps(distance[m_cellularDistanceIndex0], distance[m_cellularDistanceIndex1]));
+				break;
+			default:
+				_mm_storeu_ps(result + i, _mm_setzero_ps());
+				break;
+			}
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			switch (m_cellularReturnType)
+			{
+			case NOISE_CELLULAR_CELLVALUE:
+			case NOISE_CELLULAR_NOISELOOKUP:
+			case NOISE_CELLULAR_DISTANCE:
+				result[i] = SingleCellular(x[i], y[i], z[i]);
+				break;
+			default:
+				result[i] = SingleCellular2Edge(x[i], y[i], z[i]);
+				break;
+			}
+		}
+	}
+
 	// Helpers
 	int32_t Noise::FastFloor(const float &f)
 	{
@@ -356,9 +356,53 @@ namespace acid
 
 		float GetWhiteNoiseInt(int32_t x, int32_t y, int32_t z, int32_t w) const;
 
+		// Batch
+		/// <summary>
+		/// Fills a grid with <see cref="GetNoise(float, float)"/> samples, rows are split across the engine thread pool when one is running.
+		/// Value, perlin and simplex noise (and their fractals) and cellular noise are sampled several points at a time with SIMD.
+		/// </summary>
+		/// <param name="originX"> The x coordinate of the first sample. </param>
+		/// <param name="originY"> The y coordinate of the first sample. </param>
+		/// <param name="step"> The distance between neighbouring samples. </param>
+		/// <param name="width"> The number of samples along x. </param>
+		/// <param name="height"> The number of samples along y. </param>
+		/// <param name="result"> The samples, stored as result[y * width + x]. Must hold width * height floats. </param>
+		void FillGrid2D(const float &originX, const float &originY, const float &step, const uint32_t &width, const uint32_t &height, float *result) const;
+
+		/// <summary>
+		/// Fills a grid with <see cref="GetNoise(float, float, float)"/> samples, rows are split across the engine thread pool when one is running.
+		/// </summary>
+		/// <param name="originX"> The x coordinate of the first sample. </param>
+		/// <param name="originY"> The y coordinate of the first sample. </param>
+		/// <param name="originZ"> The z coordinate of the first sample. </param>
+		/// <param name="step"> The distance between neighbouring samples. </param>
+		/// <param name="width"> The number of samples along x. </param>
+		/// <param name="height"> The number of samples along y. </param>
+		/// <param name="depth"> The number of samples along z. </param>
+		/// <param name="result"> The samples, stored as result[(z * height + y) * width + x]. Must hold width * height * depth floats. </param>
+		void FillGrid3D(const float &originX, const float &originY, const float &originZ, const float &step, const uint32_t &width, const uint32_t &height, const uint32_t &depth,
+			float *result) const;
+
 	private:
 		void CalculateFractalBounding();
 
+		// Batch
+		bool IsBatchedType() const;
+
+		void FillBatch(const uint32_t &count, float *x, float *y, float *z, float *octave, float *result) const;
+
+		void SingleLattice(const uint8_t &offset, const bool &gradient, const uint32_t &count, const float *x, const float *y, float *result) const;
+
+		void SingleLattice(const uint8_t &offset, const bool &gradient, const uint32_t &count, const float *x, const float *y, const float *z, float *result) const;
+
+		void SingleSimplexBatch(const uint8_t &offset, const uint32_t &count, const float *x, const float *y, float *result) const;
+
+		void SingleSimplexBatch(const uint8_t &offset, const uint32_t &count, const float *x, const float *y, const float *z, float *result) const;
+
+		void SingleCellularBatch(const uint32_t &count, const float *x, const float *y, float *result) const;
+
+		void SingleCellularBatch(const uint32_t &count, const float *x, const float *y, const float *z, float *result) const;
+
 		// Helpers
 		static int32_t FastFloor(const float &f);
 
@@ -0,0 +1,69 @@
+#include "ComponentIndex.hpp"
+
+namespace acid
+{
+	void ComponentView::Insert(IComponent *component)
+	{
+		if (m_indices.find(component) != m_indices.end())
+		{
+			return;
+		}
+
+		m_indices.emplace(component, static_cast<uint32_t>(m_components.size()));
+		m_components.emplace_back(component);
+	}
+
+	void ComponentView::Erase(IComponent *component)
+	{
+		auto it = m_indices.find(component);
+
+		if (it == m_indices.end())
+		{
+			return;
+		}
+
+		// Swaps the last component into the removed slot.
+		uint32_t index = (*it).second;
+		m_indices.erase(it);
+
+		if (index != m_components.size() - 1)
+		{
+			m_components[index] = m_components.back();
+			m_indices[m_components[index]] = index;
+		}
+
+		m_components.pop_back();
+	}
+
+	ComponentIndex::ComponentIndex() :
+		m_all(ComponentView()),
+		m_views(std::unordered_map<TypeId, ComponentView>()),
+		m_mutex()
+	{
+	}
+
+	void ComponentIndex::Add(IComponent *component)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_all.Insert(component);
+
+		for (auto &[typeId, view] : m_views)
+		{
+			if (view.m_isSame(component))
+			{
+				view.Insert(component);
+			}
+		}
+	}
+
+	void ComponentIndex::Remove(IComponent *component)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_all.Erase(component);
+
+		for (auto &[typeId, view] : m_views)
+		{
+			view.Erase(component);
+		}
+	}
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "Helpers/TypeInfo.hpp"
+#include "IComponent.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// A contiguous array of components that match a type, with a index map for constant time removal.
+	/// </summary>
+	struct ComponentView
+	{
+		std::function<bool(IComponent *)> m_isSame;
+		std::vector<IComponent *> m_components;
+		std::unordered_map<IComponent *, uint32_t> m_indices;
+
+		void Insert(IComponent *component);
+
+		void Erase(IComponent *component);
+	};
+
+	/// <summary>
+	/// A class that keeps per type views of the components in a structure, views are created on the first query of a type
+	/// and kept up to date as components are added and removed. This replaces walking every object for every query.
+	/// </summary>
+	class ACID_EXPORT ComponentIndex
+	{
+	private:
+		ComponentView m_all;
+		std::unordered_map<TypeId, ComponentView> m_views;
+		std::mutex m_mutex;
+	public:
+		/// <summary>
+		/// Creates a new component index.
+		/// </summary>
+		ComponentIndex();
+
+		ComponentIndex(const ComponentIndex&) = delete;
+
+		ComponentIndex& operator=(const ComponentIndex&) = delete;
+
+		/// <summary>
+		/// Adds a component into the index.
+		/// </summary>
+		/// <param name="component"> The component to add. </param>
+		void Add(IComponent *component);
+
+		/// <summary>
+		/// Removes a component from the index.
+		/// </summary>
+		/// <param name="component"> The component to remove. </param>
+		void Remove(IComponent *component);
+
+		/// <summary>
+		/// Returns all indexed components of a type.
+		/// </summary>
+		/// <param name="allowDisabled"> If disabled components will be included in this query. </param>
+		/// <returns> The list of all components that match the type. </returns>
+		template<typename T>
+		std::vector<T *> Query(const bool &allowDisabled = false)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			auto &view = GetView<T>();
+
+			auto result = std::vector<T *>();
+			result.reserve(view.m_components.size());
+
+			for (auto &component : view.m_components)
+			{
+				if (allowDisabled || component->IsEnabled())
+				{
+					result.emplace_back(static_cast<T *>(component));
+				}
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Returns the first indexed component of a type.
+		/// </summary>
+		/// <param name="allowDisabled"> If disabled components will be included in this query. </param>
+		/// <returns> The first component of the type found. </returns>
+		template<typename T>
+		T *GetFirst(const bool &allowDisabled = false)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			auto &view = GetView<T>();
+
+			for (auto &component : view.m_components)
+			{
+				if (allowDisabled || component->IsEnabled())
+				{
+					return static_cast<T *>(component);
+				}
+			}
+
+			return nullptr;
+		}
+	private:
+		template<typename T>
+		ComponentView &GetView()
+		{
+			auto it = m_views.find(TypeInfo::GetTypeId<T>());
+
+			if (it != m_views.end())
+			{
+				return (*it).second;
+			}
+
+			ComponentView view = {};
+			view.m_isSame = [](IComponent *component) -> bool
+			{
+				return dynamic_cast<T *>(component) != nullptr;
+			};
+
+			for (auto &component : m_all.m_components)
+			{
+				if (view.m_isSame(component))
+				{
+					view.Insert(component);
+				}
+			}
+
+			return (*m_views.emplace(TypeInfo::GetTypeId<T>(), std::move(view)).first).second;
+		}
+	};
+}
@@ -51,12 +51,32 @@ namespace acid
 		m_name = FileSystem::FileName(filename);
 	}
 
+	GameObject::~GameObject()
+	{
+		if (m_structure == nullptr)
+		{
+			return;
+		}
+
+		for (auto &component : m_components)
+		{
+			m_structure->OnComponentRemove(component.get());
+		}
+
+		m_structure->OnObjectRemove(this);
+	}
+
 	void GameObject::Update()
 	{
 		for (auto it = m_components.begin(); it != m_components.end();)
 		{
 			if ((*it)->IsRemoved())
 			{
+				if (m_structure != nullptr)
+				{
+					m_structure->OnComponentRemove((*it).get());
+				}
+
 				it = m_components.erase(it);
 				continue;
 			}
@@ -90,6 +110,12 @@ namespace acid
 
 		component->SetGameObject(this);
 		m_components.emplace_back(component);
+
+		if (m_structure != nullptr)
+		{
+			m_structure->OnComponentAdd(component);
+		}
+
 		return component;
 	}
 
@@ -101,6 +127,11 @@ namespace acid
 			{
 				(*it)->SetGameObject(nullptr);
 
+				if (m_structure != nullptr)
+				{
+					m_structure->OnComponentRemove((*it).get());
+				}
+
 				m_components.erase(it);
 				return true;
 			}
@@ -122,6 +153,11 @@ namespace acid
 
 			(*it)->SetGameObject(nullptr);
 
+			if (m_structure != nullptr)
+			{
+				m_structure->OnComponentRemove((*it).get());
+			}
+
 			m_components.erase(it);
 			return true;
 		}
@@ -135,9 +171,9 @@ namespace acid
 		{
 			m_structure->Move(this, structure);
 		}
-		else
+		else if (structure != nullptr)
 		{
-			m_structure->Add(this);
+			structure->Add(this);
 		}
 
 		m_structure = structure;
@@ -37,6 +37,8 @@ namespace acid
 		/// <param name="structure"> The structure to store the object into, if null it will be stored in the scenes structure. </param>
 		explicit GameObject(const std::string &filename, const Transform &transform = Transform::ZERO, ISpatialStructure *structure = nullptr);
 
+		~GameObject();
+
 		GameObject(const GameObject&) = delete; 
 
 		GameObject& operator=(const GameObject&) = delete;
@@ -136,6 +138,11 @@ namespace acid
 				{
 					(*it)->SetGameObject(nullptr);
 
+					if (m_structure != nullptr)
+					{
+						m_structure->OnComponentRemove((*it).get());
+					}
+
 					m_components.erase(it);
 					return true;
 				}
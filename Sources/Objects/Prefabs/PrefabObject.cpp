@@ -1,5 +1,6 @@
 #include "PrefabObject.hpp"
 
+#include "Files/Binary/FileBinary.hpp"
 #include "Files/Json/FileJson.hpp"
 #include "Files/Xml/FileXml.hpp"
 #include "Helpers/FileSystem.hpp"
@@ -42,6 +43,12 @@ namespace acid
 			m_file->Load();
 			m_parent = m_file->GetParent();
 		}
+		else if (fileExt == ".bin")
+		{
+			m_file = std::make_unique<FileBinary>(filename);
+			m_file->Load();
+			m_parent = m_file->GetParent();
+		}
 		else if (fileExt == ".xml")
 		{
 			m_file = std::make_unique<FileXml>(filename);
@@ -1,13 +1,12 @@
 ﻿#pragma once
 
-#include "Maths/Vector2.hpp"
 #include "Maths/Vector3.hpp"
 #include "ParticleType.hpp"
 
 namespace acid
 {
 	/// <summary>
-	/// A instance of a particle type.
+	/// The starting state of a particle, once added to <see cref="Particles"/> it is simulated by the pool for its type.
 	/// </summary>
 	class ACID_EXPORT Particle
 	{
@@ -17,24 +16,13 @@ namespace acid
 		Vector3 m_position;
 
 		Vector3 m_velocity;
-		Vector3 m_change;
-
-		Vector2 m_textureOffset1;
-		Vector2 m_textureOffset2;
 
 		float m_lifeLength;
 		float m_stageCycles;
 		float m_rotation;
 		float m_scale;
 		float m_gravityEffect;
-
-		float m_elapsedTime;
-		float m_transparency;
-		float m_textureBlendFactor;
-		float m_distanceToCamera;
 	public:
-		static const float FADE_TIME;
-
 		/// <summary>
 		/// Creates a new particle object.
 		/// </summary>
@@ -48,44 +36,20 @@ namespace acid
 		/// <param name="gravityEffect"> The particles gravity effect. </param>
 		Particle(const std::shared_ptr<ParticleType> &particleType, const Vector3 &position, const Vector3 &velocity, const float &lifeLength, const float &stageCycles, const float &rotation, const float &scale, const float &gravityEffect);
 
-		/// <summary>
-		/// Updates the particle.
-		/// </summary>
-		void Update();
-
-		bool IsAlive() const { return m_transparency > 0.0f; }
-
 		std::shared_ptr<ParticleType> GetParticleType() const { return m_particleType; }
 
 		Vector3 GetPosition() const { return m_position; }
 
 		Vector3 GetVelocity() const { return m_velocity; }
 
-		Vector3 GetChange() const { return m_change; }
-
-		Vector2 GetTextureOffset1() const { return m_textureOffset1; }
-
-		Vector2 GetTextureOffset2() const { return m_textureOffset2; }
-
 		float GetLifeLength() const { return m_lifeLength; }
 
+		float GetStageCycles() const { return m_stageCycles; }
+
 		float GetRotation() const { return m_rotation; }
 
 		float GetScale() const { return m_scale; }
 
 		float GetGravityEffect() const { return m_gravityEffect; }
-
-		float GetElapsedTime() const { return m_elapsedTime; }
-
-		float GetTransparency() const { return m_transparency; }
-
-		float GetTextureBlendFactor() const { return m_textureBlendFactor; }
-
-		float DistanceToCamera() const { return m_distanceToCamera; }
-
-		bool operator<(const Particle &other) const;
-
-	private:
-		Vector2 CalculateTextureOffset(const int32_t &index) const;
 	};
 }
@@ -0,0 +1,245 @@
+#include "ParticlePool.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include "Engine/Engine.hpp"
+
+namespace acid
+{
+	const float ParticlePool::FADE_TIME = 1.0f;
+	const uint32_t ParticlePool::BATCH_SIZE = 4096;
+
+	ParticlePool::ParticlePool(const std::shared_ptr<ParticleType> &particleType) :
+		m_particleType(particleType),
+		m_streams(std::array<std::vector<float>, PARTICLE_STREAM_COUNT>()),
+		m_order(std::vector<uint32_t>()),
+		m_source(std::vector<uint32_t>()),
+		m_remap(std::vector<uint32_t>())
+	{
+	}
+
+	void ParticlePool::Add(const Particle &particle)
+	{
+		m_order.emplace_back(GetCount());
+
+		m_streams[PARTICLE_STREAM_POSITION_X].emplace_back(particle.GetPosition().m_x);
+		m_streams[PARTICLE_STREAM_POSITION_Y].emplace_back(particle.GetPosition().m_y);
+		m_streams[PARTICLE_STREAM_POSITION_Z].emplace_back(particle.GetPosition().m_z);
+		m_streams[PARTICLE_STREAM_VELOCITY_X].emplace_back(particle.GetVelocity().m_x);
+		m_streams[PARTICLE_STREAM_VELOCITY_Y].emplace_back(particle.GetVelocity().m_y);
+		m_streams[PARTICLE_STREAM_VELOCITY_Z].emplace_back(particle.GetVelocity().m_z);
+		m_streams[PARTICLE_STREAM_LIFE_LENGTH].emplace_back(particle.GetLifeLength());
+		m_streams[PARTICLE_STREAM_STAGE_CYCLES].emplace_back(particle.GetStageCycles());
+		m_streams[PARTICLE_STREAM_ROTATION].emplace_back(particle.GetRotation());
+		m_streams[PARTICLE_STREAM_SCALE].emplace_back(particle.GetScale());
+		m_streams[PARTICLE_STREAM_GRAVITY_EFFECT].emplace_back(particle.GetGravityEffect());
+		m_streams[PARTICLE_STREAM_ELAPSED_TIME].emplace_back(0.0f);
+		m_streams[PARTICLE_STREAM_TRANSPARENCY].emplace_back(1.0f);
+		m_streams[PARTICLE_STREAM_TEXTURE_BLEND].emplace_back(0.0f);
+		m_streams[PARTICLE_STREAM_OFFSET1_X].emplace_back(0.0f);
+		m_streams[PARTICLE_STREAM_OFFSET1_Y].emplace_back(0.0f);
+		m_streams[PARTICLE_STREAM_OFFSET2_X].emplace_back(0.0f);
+		m_streams[PARTICLE_STREAM_OFFSET2_Y].emplace_back(0.0f);
+		m_streams[PARTICLE_STREAM_DISTANCE].emplace_back(0.0f);
+	}
+
+	void ParticlePool::Update(const float &delta, const std::optional<Vector3> &cameraPosition)
+	{
+		uint32_t count = GetCount();
+		uint32_t batches = (count + BATCH_SIZE - 1) / BATCH_SIZE;
+
+		auto integrate = [&](const uint32_t &batch)
+		{
+			Integrate(batch * BATCH_SIZE, std::min(count, (batch + 1) * BATCH_SIZE), delta, cameraPosition);
+		};
+
+		if (batches > 1 && Engine::Get() != nullptr)
+		{
+			Engine::Get()->GetThreadPool()->ParallelFor(0, batches, integrate, 1);
+		}
+		else
+		{
+			for (uint32_t batch = 0; batch < batches; batch++)
+			{
+				integrate(batch);
+			}
+		}
+
+		RemoveDead();
+		SortOrder();
+	}
+
+	void ParticlePool::Clear()
+	{
+		for (auto &stream : m_streams)
+		{
+			stream.clear();
+		}
+
+		m_order.clear();
+	}
+
+	void ParticlePool::Integrate(const uint32_t &begin, const uint32_t &end, const float &delta, const std::optional<Vector3> &cameraPosition)
+	{
+		float *positionX = m_streams[PARTICLE_STREAM_POSITION_X].data();
+		float *positionY = m_streams[PARTICLE_STREAM_POSITION_Y].data();
+		float *positionZ = m_streams[PARTICLE_STREAM_POSITION_Z].data();
+		float *velocityX = m_streams[PARTICLE_STREAM_VELOCITY_X].data();
+		float *velocityY = m_streams[PARTICLE_STREAM_VELOCITY_Y].data();
+		float *velocityZ = m_streams[PARTICLE_STREAM_VELOCITY_Z].data();
+		const float *lifeLength = m_streams[PARTICLE_STREAM_LIFE_LENGTH].data();
+		const float *gravityEffect = m_streams[PARTICLE_STREAM_GRAVITY_EFFECT].data();
+		float *elapsedTime = m_streams[PARTICLE_STREAM_ELAPSED_TIME].data();
+		float *transparency = m_streams[PARTICLE_STREAM_TRANSPARENCY].data();
+		float fade = delta / FADE_TIME;
+
+		// Kept free of branches and calls so the compiler can vectorise it.
+		for (uint32_t i = begin; i < end; i++)
+		{
+			velocityY[i] += -10.0f * gravityEffect[i] * delta;
+			positionX[i] += velocityX[i] * delta;
+			positionY[i] += velocityY[i] * delta;
+			positionZ[i] += velocityZ[i] * delta;
+			elapsedTime[i] += delta;
+			transparency[i] -= elapsedTime[i] > lifeLength[i] - FADE_TIME ? fade : 0.0f;
+		}
+
+		if (cameraPosition)
+		{
+			float *distance = m_streams[PARTICLE_STREAM_DISTANCE].data();
+
+			for (uint32_t i = begin; i < end; i++)
+			{
+				float x = cameraPosition->m_x - positionX[i];
+				float y = cameraPosition->m_y - positionY[i];
+				float z = cameraPosition->m_z - positionZ[i];
+				distance[i] = x * x + y * y + z * z;
+			}
+		}
+
+		if (m_particleType->GetTexture() == nullptr)
+		{
+			return;
+		}
+
+		const float *stageCycles = m_streams[PARTICLE_STREAM_STAGE_CYCLES].data();
+		float *textureBlend = m_streams[PARTICLE_STREAM_TEXTURE_BLEND].data();
+		float *offset1X = m_streams[PARTICLE_STREAM_OFFSET1_X].data();
+		float *offset1Y = m_streams[PARTICLE_STREAM_OFFSET1_Y].data();
+		float *offset2X = m_streams[PARTICLE_STREAM_OFFSET2_X].data();
+		float *offset2Y = m_streams[PARTICLE_STREAM_OFFSET2_Y].data();
+
+		int32_t numberOfRows = static_cast<int32_t>(m_particleType->GetNumberOfRows());
+		int32_t stageCount = numberOfRows * numberOfRows;
+
+		for (uint32_t i = begin; i < end; i++)
+		{
+			if (transparency[i] <= 0.0f)
+			{
+				continue;
+			}
+
+			float lifeFactor = stageCycles[i] * elapsedTime[i] / lifeLength[i];
+			float atlasProgression = lifeFactor * stageCount;
+			int32_t index1 = static_cast<int32_t>(std::floor(atlasProgression));
+			int32_t index2 = index1 < stageCount - 1 ? index1 + 1 : index1;
+
+			textureBlend[i] = std::fmod(atlasProgression, 1.0f);
+			offset1X[i] = static_cast<float>(index1 % numberOfRows) / numberOfRows;
+			offset1Y[i] = static_cast<float>(index1 / numberOfRows) / numberOfRows;
+			offset2X[i] = static_cast<float>(index2 % numberOfRows) / numberOfRows;
+			offset2Y[i] = static_cast<float>(index2 / numberOfRows) / numberOfRows;
+		}
+	}
+
+	void ParticlePool::RemoveDead()
+	{
+		const auto &transparency = m_streams[PARTICLE_STREAM_TRANSPARENCY];
+		uint32_t count = GetCount();
+
+		if (std::all_of(transparency.begin(), transparency.end(), [](const float &value) { return value > 0.0f; }))
+		{
+			return;
+		}
+
+		// Tracks which particle ends up in each slot, so the draw order can be carried over.
+		m_source.resize(count);
+		std::iota(m_source.begin(), m_source.end(), 0);
+		m_remap.assign(count, UINT32_MAX);
+
+		uint32_t size = count;
+
+		for (uint32_t i = 0; i < size;)
+		{
+			if (transparency[i] > 0.0f)
+			{
+				m_remap[m_source[i]] = i;
+				i++;
+				continue;
+			}
+
+			size--;
+
+			for (auto &stream : m_streams)
+			{
+				stream[i] = stream[size];
+			}
+
+			m_source[i] = m_source[size];
+		}
+
+		for (auto &stream : m_streams)
+		{
+			stream.resize(size);
+		}
+
+		uint32_t written = 0;
+
+		for (auto &index : m_order)
+		{
+			if (m_remap[index] != UINT32_MAX)
+			{
+				m_order[written] = m_remap[index];
+				written++;
+			}
+		}
+
+		m_order.resize(written);
+	}
+
+	void ParticlePool::SortOrder()
+	{
+		const auto &distance = m_streams[PARTICLE_STREAM_DISTANCE];
+		auto further = [&distance](const uint32_t &a, const uint32_t &b)
+		{
+			return distance[a] > distance[b];
+		};
+
+		// The order from last frame is close to sorted, so an insertion sort usually only makes a few moves.
+		// If the camera jumped and too many particles need moving it falls back to a full sort.
+		std::size_t moves = 0;
+		std::size_t maxMoves = 8 * m_order.size() + 64;
+
+		for (std::size_t i = 1; i < m_order.size(); i++)
+		{
+			uint32_t index = m_order[i];
+			std::size_t j = i;
+
+			while (j > 0 && further(index, m_order[j - 1]))
+			{
+				m_order[j] = m_order[j - 1];
+				j--;
+			}
+
+			m_order[j] = index;
+			moves += i - j;
+
+			if (moves > maxMoves)
+			{
+				std::sort(m_order.begin(), m_order.end(), further);
+				return;
+			}
+		}
+	}
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <array>
+#include <optional>
+#include <vector>
+#include "Maths/Vector3.hpp"
+#include "Maths/Vector4.hpp"
+#include "Particle.hpp"
+
+namespace acid
+{
+	enum ParticleStream
+	{
+		PARTICLE_STREAM_POSITION_X = 0,
+		PARTICLE_STREAM_POSITION_Y = 1,
+		PARTICLE_STREAM_POSITION_Z = 2,
+		PARTICLE_STREAM_VELOCITY_X = 3,
+		PARTICLE_STREAM_VELOCITY_Y = 4,
+		PARTICLE_STREAM_VELOCITY_Z = 5,
+		PARTICLE_STREAM_LIFE_LENGTH = 6,
+		PARTICLE_STREAM_STAGE_CYCLES = 7,
+		PARTICLE_STREAM_ROTATION = 8,
+		PARTICLE_STREAM_SCALE = 9,
+		PARTICLE_STREAM_GRAVITY_EFFECT = 10,
+		PARTICLE_STREAM_ELAPSED_TIME = 11,
+		PARTICLE_STREAM_TRANSPARENCY = 12,
+		PARTICLE_STREAM_TEXTURE_BLEND = 13,
+		PARTICLE_STREAM_OFFSET1_X = 14,
+		PARTICLE_STREAM_OFFSET1_Y = 15,
+		PARTICLE_STREAM_OFFSET2_X = 16,
+		PARTICLE_STREAM_OFFSET2_Y = 17,
+		PARTICLE_STREAM_DISTANCE = 18,
+		PARTICLE_STREAM_COUNT = 19
+	};
+
+	/// <summary>
+	/// Simulates every live particle of one type, each attribute is stored in its own packed array so the integrator streams through plain floats.
+	/// Dead particles are swap-removed and the back to front draw order is repaired from the previous frame instead of being resorted.
+	/// </summary>
+	class ACID_EXPORT ParticlePool
+	{
+	private:
+		std::shared_ptr<ParticleType> m_particleType;
+		std::array<std::vector<float>, PARTICLE_STREAM_COUNT> m_streams;
+		std::vector<uint32_t> m_order;
+
+		std::vector<uint32_t> m_source;
+		std::vector<uint32_t> m_remap;
+	public:
+		static const float FADE_TIME;
+		static const uint32_t BATCH_SIZE;
+
+		/// <summary>
+		/// Creates a new particle pool.
+		/// </summary>
+		/// <param name="particleType"> The type shared by every particle in this pool. </param>
+		explicit ParticlePool(const std::shared_ptr<ParticleType> &particleType);
+
+		/// <summary>
+		/// Adds a particle to the pool, it is simulated from the next update.
+		/// </summary>
+		/// <param name="particle"> The particles starting state. </param>
+		void Add(const Particle &particle);
+
+		/// <summary>
+		/// Integrates every particle, removes the dead and updates the draw order. Batches of particles are spread over the engine thread pool.
+		/// </summary>
+		/// <param name="delta"> The time since the last update, in seconds. </param>
+		/// <param name="cameraPosition"> The camera position to sort by, if there is a camera. </param>
+		void Update(const float &delta, const std::optional<Vector3> &cameraPosition);
+
+		/// <summary>
+		/// Removes every particle from the pool.
+		/// </summary>
+		void Clear();
+
+		std::shared_ptr<ParticleType> GetParticleType() const { return m_particleType; }
+
+		uint32_t GetCount() const { return static_cast<uint32_t>(m_streams[PARTICLE_STREAM_TRANSPARENCY].size()); }
+
+		/// <summary>
+		/// Gets the particle indices sorted from furthest to nearest the camera.
+		/// </summary>
+		/// <returns> The draw order. </returns>
+		const std::vector<uint32_t> &GetOrder() const { return m_order; }
+
+		/// <summary>
+		/// Gets a attribute stream, indexed by particle.
+		/// </summary>
+		/// <param name="stream"> The stream to get. </param>
+		/// <returns> The attribute values. </returns>
+		const std::vector<float> &GetStream(const ParticleStream &stream) const { return m_streams[stream]; }
+
+		Vector3 GetPosition(const uint32_t &index) const { return Vector3(m_streams[PARTICLE_STREAM_POSITION_X][index], m_streams[PARTICLE_STREAM_POSITION_Y][index], m_streams[PARTICLE_STREAM_POSITION_Z][index]); }
+
+		Vector3 GetVelocity(const uint32_t &index) const { return Vector3(m_streams[PARTICLE_STREAM_VELOCITY_X][index], m_streams[PARTICLE_STREAM_VELOCITY_Y][index], m_streams[PARTICLE_STREAM_VELOCITY_Z][index]); }
+
+		Vector4 GetTextureOffsets(const uint32_t &index) const { return Vector4(m_streams[PARTICLE_STREAM_OFFSET1_X][index], m_streams[PARTICLE_STREAM_OFFSET1_Y][index], m_streams[PARTICLE_STREAM_OFFSET2_X][index], m_streams[PARTICLE_STREAM_OFFSET2_Y][index]); }
+
+		float GetRotation(const uint32_t &index) const { return m_streams[PARTICLE_STREAM_ROTATION][index]; }
+
+		float GetScale(const uint32_t &index) const { return m_streams[PARTICLE_STREAM_SCALE][index]; }
+
+		float GetTransparency(const uint32_t &index) const { return m_streams[PARTICLE_STREAM_TRANSPARENCY][index]; }
+
+		float GetTextureBlendFactor(const uint32_t &index) const { return m_streams[PARTICLE_STREAM_TEXTURE_BLEND][index]; }
+
+		float GetDistanceToCamera(const uint32_t &index) const { return m_streams[PARTICLE_STREAM_DISTANCE][index]; }
+	private:
+		void Integrate(const uint32_t &begin, const uint32_t &end, const float &delta, const std::optional<Vector3> &cameraPosition);
+
+		void RemoveDead();
+
+		void SortOrder();
+	};
+}
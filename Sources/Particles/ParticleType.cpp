@@ -4,7 +4,7 @@
 #include "Models/Shapes/ModelRectangle.hpp"
 #include "Helpers/String.hpp"
 #include "Scenes/Scenes.hpp"
-#include "Particle.hpp"
+#include "ParticlePool.hpp"
 
 namespace acid
 {
@@ -52,30 +52,50 @@ namespace acid
 	{
 	}
 
-	void ParticleType::Update(const std::vector<Particle> &particles)
+	void ParticleType::Update(const ParticlePool &pool)
 	{
 		auto instanceData = std::vector<ParticleData>();
 		instanceData.resize(MAX_TYPE_INSTANCES);
 		uint32_t i = 0;
+		auto viewFrustum = Scenes::Get()->GetCamera()->GetViewFrustum();
 
-		for (auto &particle : particles)
+		// Every particle is culled as one batch, then the visible ones are taken in draw order.
+		auto &scales = pool.GetStream(PARTICLE_STREAM_SCALE);
+		auto radii = std::vector<float>(scales.size());
+
+		for (std::size_t j = 0; j < scales.size(); j++)
+		{
+			radii[j] = FRUSTUM_BUFFER * scales[j];
+		}
+
+		auto culled = std::vector<uint32_t>(radii.size());
+		uint32_t culledCount = viewFrustum.CullSpheres(pool.GetStream(PARTICLE_STREAM_POSITION_X).data(), pool.GetStream(PARTICLE_STREAM_POSITION_Y).data(),
+			pool.GetStream(PARTICLE_STREAM_POSITION_Z).data(), radii.data(), static_cast<uint32_t>(radii.size()), culled.data());
+		auto visible = std::vector<uint8_t>(radii.size(), 0);
+
+		for (uint32_t j = 0; j < culledCount; j++)
+		{
+			visible[culled[j]] = 1;
+		}
+
+		for (auto &index : pool.GetOrder())
 		{
-			if (!Scenes::Get()->GetCamera()->GetViewFrustum().SphereInFrustum(particle.GetPosition(), FRUSTUM_BUFFER * particle.GetScale()))
+			if (visible[index] == 0)
 			{
 				continue;
 			}
 
-			instanceData[i] = GetInstanceData(particle);
+			instanceData[i] = GetInstanceData(pool, index);
 			i++;
 
-			if (i > instanceData.size())
+			if (i >= instanceData.size())
 			{
 				break;
 			}
 		}
 
 		m_storageBuffer.Push("data", *instanceData.data(), sizeof(ParticleData) * MAX_TYPE_INSTANCES);
-		m_instances = static_cast<uint32_t>(instanceData.size());
+		m_instances = i;
 	}
 
 	bool ParticleType::CmdRender(const CommandBuffer &commandBuffer, const Pipeline &pipeline, UniformHandler &uniformScene)
@@ -126,35 +146,30 @@ namespace acid
 		return result.str();
 	}
 
-	ParticleData ParticleType::GetInstanceData(const Particle &particle)
+	ParticleData ParticleType::GetInstanceData(const ParticlePool &pool, const uint32_t &index) const
 	{
 		ParticleData instanceData = {};
 
 		Matrix4 modelMatrix = Matrix4();
-		modelMatrix = modelMatrix.Translate(particle.GetPosition());
+		modelMatrix = modelMatrix.Translate(pool.GetPosition(index));
 
 		for (uint32_t i = 0; i < 3; i++)
 		{
-			modelMatrix[0][i] = particle.GetScale();
+			modelMatrix[0][i] = pool.GetScale(index);
 		}
 		
-		modelMatrix[1][0] = Maths::Radians(particle.GetRotation());
+		modelMatrix[1][0] = Maths::Radians(pool.GetRotation(index));
 
 		instanceData.modelMatrix = modelMatrix;
 
-		instanceData.colourOffset = particle.GetParticleType()->GetColourOffset();
+		instanceData.colourOffset = m_colourOffset;
 
-		Vector4 offsets = Vector4();
-		offsets.m_x = particle.GetTextureOffset1().m_x;
-		offsets.m_y = particle.GetTextureOffset1().m_y;
-		offsets.m_z = particle.GetTextureOffset2().m_x;
-		offsets.m_w = particle.GetTextureOffset2().m_y;
-		instanceData.offsets = offsets;
+		instanceData.offsets = pool.GetTextureOffsets(index);
 
 		Vector3 blend = Vector3();
-		blend.m_x = particle.GetTextureBlendFactor();
-		blend.m_y = particle.GetTransparency();
-		blend.m_z = static_cast<float>(particle.GetParticleType()->GetNumberOfRows());
+		blend.m_x = pool.GetTextureBlendFactor(index);
+		blend.m_y = pool.GetTransparency(index);
+		blend.m_z = static_cast<float>(m_numberOfRows);
 		instanceData.blend = blend;
 
 		return instanceData;
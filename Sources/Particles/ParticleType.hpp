@@ -23,7 +23,7 @@ namespace acid
 		float _padding;
 	};
 
-	class Particle;
+	class ParticlePool;
 
 	/// <summary>
 	/// A definition for what a particle should act and look like.
@@ -77,7 +77,7 @@ namespace acid
 		/// <param name="scale"> The averaged scale for the particle. </param>
 		explicit ParticleType(const std::shared_ptr<Texture> &texture = nullptr, const uint32_t &numberOfRows = 1, const Colour &colourOffset = Colour::BLACK, const float &lifeLength = 10.0f, const float &stageCycles = 1.0f, const float &scale = 1.0f);
 
-		void Update(const std::vector<Particle> &particles);
+		void Update(const ParticlePool &pool);
 
 		bool CmdRender(const CommandBuffer &commandBuffer, const Pipeline &pipeline, UniformHandler &uniformScene);
 
@@ -113,6 +113,6 @@ namespace acid
 	private:
 		static std::string ToFilename(const std::shared_ptr<Texture> &texture, const uint32_t &numberOfRows, const Colour &colourOffset, const float &lifeLength, const float &stageCycles, const float &scale);
 
-		ParticleData GetInstanceData(const Particle &particle);
+		ParticleData GetInstanceData(const ParticlePool &pool, const uint32_t &index) const;
 	};
 }
@@ -7,7 +7,8 @@ namespace acid
 	const float Particles::MAX_ELAPSED_TIME = 5.0f;
 
 	Particles::Particles() :
-		m_particles(std::map<std::shared_ptr<ParticleType>, std::vector<Particle>>())
+		m_pools(std::vector<std::unique_ptr<ParticlePool>>()),
+		m_poolIndices(std::unordered_map<ParticleType *, uint32_t>())
 	{
 	}
 
@@ -18,41 +19,33 @@ namespace acid
 			return;
 		}
 
-		for (auto it = m_particles.begin(); it != m_particles.end(); ++it)
-		{
-			for (auto it1 = (*it).second.begin(); it1 != (*it).second.end();)
-			{
-				(*it1).Update();
-
-				if (!(*it1).IsAlive())
-				{
-					it1 = (*it).second.erase(it1);
-					continue;
-				}
+		float delta = Engine::Get()->GetDelta().AsSeconds();
+		auto camera = Scenes::Get()->GetCamera();
+		auto cameraPosition = camera != nullptr ? std::make_optional(camera->GetPosition()) : std::nullopt;
 
-				++it1;
-			}
-
-			std::sort((*it).second.begin(), (*it).second.end());
-			(*it).first->Update((*it).second);
+		for (auto &pool : m_pools)
+		{
+			pool->Update(delta, cameraPosition);
+			pool->GetParticleType()->Update(*pool);
 		}
 	}
 
 	void Particles::AddParticle(const Particle &particle)
 	{
-		auto it = m_particles.find(particle.GetParticleType());
+		auto it = m_poolIndices.find(particle.GetParticleType().get());
 
-		if (it == m_particles.end())
+		if (it == m_poolIndices.end())
 		{
-			m_particles.emplace(particle.GetParticleType(), std::vector<Particle>());
-			it = m_particles.find(particle.GetParticleType());
+			it = m_poolIndices.emplace(particle.GetParticleType().get(), static_cast<uint32_t>(m_pools.size())).first;
+			m_pools.emplace_back(std::make_unique<ParticlePool>(particle.GetParticleType()));
 		}
 
-		(*it).second.emplace_back(particle);
+		m_pools[(*it).second]->Add(particle);
 	}
 
 	void Particles::Clear()
 	{
-		m_particles.clear();
+		m_pools.clear();
+		m_poolIndices.clear();
 	}
 }
@@ -1,9 +1,9 @@
 #pragma once
 
-#include <map>
+#include <unordered_map>
 #include <vector>
 #include "Engine/Engine.hpp"
-#include "Particle.hpp"
+#include "ParticlePool.hpp"
 
 namespace acid
 {
@@ -16,7 +16,8 @@ namespace acid
 	private:
 		static const float MAX_ELAPSED_TIME;
 
-		std::map<std::shared_ptr<ParticleType>, std::vector<Particle>> m_particles;
+		std::vector<std::unique_ptr<ParticlePool>> m_pools;
+		std::unordered_map<ParticleType *, uint32_t> m_poolIndices;
 	public:
 		/// <summary>
 		/// Gets this engine instance.
@@ -36,9 +37,9 @@ namespace acid
 		void Clear();
 
 		/// <summary>
-		/// Gets a list of all particles.
+		/// Gets the particle pools, one for each particle type that has been emitted.
 		/// </summary>
-		/// <returns> All particles. </returns>
-		std::map<std::shared_ptr<ParticleType>, std::vector<Particle>> GetParticles() const { return m_particles; }
+		/// <returns> The particle pools. </returns>
+		const std::vector<std::unique_ptr<ParticlePool>> &GetPools() const { return m_pools; }
 	};
 }
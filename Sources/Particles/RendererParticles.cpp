@@ -18,13 +18,11 @@ namespace acid
 		m_uniformScene.Push("projection", camera.GetProjectionMatrix());
 		m_uniformScene.Push("view", camera.GetViewMatrix());
 
-		auto particles = Particles::Get()->GetParticles();
-
 		m_pipeline.BindPipeline(commandBuffer);
 
-		for (auto &[type, particles] : particles)
+		for (auto &pool : Particles::Get()->GetPools())
 		{
-			type->CmdRender(commandBuffer, m_pipeline, m_uniformScene);
+			pool->GetParticleType()->CmdRender(commandBuffer, m_pipeline, m_uniformScene);
 		}
 	}
 }
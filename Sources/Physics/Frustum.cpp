@@ -2,6 +2,7 @@
 
 #include <array>
 #include <cmath>
+#include "Maths/Simd.hpp"
 
 namespace acid
 {
@@ -131,6 +132,174 @@ namespace acid
 		return true;
 	}
 
+	uint32_t Frustum::CullSpheres(const float *x, const float *y, const float *z, const float *radius, const uint32_t &count, uint32_t *visible) const
+	{
+		uint32_t written = 0;
+		uint32_t i = 0;
+
+#if defined(ACID_SIMD_AVX)
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 px = _mm256_loadu_ps(x + i);
+			__m256 py = _mm256_loadu_ps(y + i);
+			__m256 pz = _mm256_loadu_ps(z + i);
+			__m256 negRadius = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(radius + i));
+			__m256 outside = _mm256_setzero_ps();
+
+			for (const auto &plane : m_frustum)
+			{
+				__m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(plane[0]), px), _mm256_mul_ps(_mm256_set1_ps(plane[1]), py)),
+					_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(plane[2]), pz), _mm256_set1_ps(plane[3])));
+				outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance, negRadius, _CMP_LE_OQ));
+			}
+
+			auto mask = static_cast<uint32_t>(~_mm256_movemask_ps(outside));
+
+			// Writes every index and only advances past the visible ones, this avoids a branch per lane.
+			for (uint32_t lane = 0; lane < 8; lane++)
+			{
+				visible[written] = i + lane;
+				written += (mask >> lane) & 1;
+			}
+		}
+#elif defined(ACID_SIMD_SSE)
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 px = _mm_loadu_ps(x + i);
+			__m128 py = _mm_loadu_ps(y + i);
+			__m128 pz = _mm_loadu_ps(z + i);
+			__m128 negRadius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(radius + i));
+			__m128 outside = _mm_setzero_ps();
+
+			for (const auto &plane : m_frustum)
+			{
+				__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane[0]), px), _mm_mul_ps(_mm_set1_ps(plane[1]), py)),
+					_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane[2]), pz), _mm_set1_ps(plane[3])));
+				outside = _mm_or_ps(outside, _mm_cmple_ps(distance, negRadius));
+			}
+
+			auto mask = static_cast<uint32_t>(~_mm_movemask_ps(outside));
+
+			// Writes every index and only advances past the visible ones, this avoids a branch per lane.
+			for (uint32_t lane = 0; lane < 4; lane++)
+			{
+				visible[written] = i + lane;
+				written += (mask >> lane) & 1;
+			}
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			if (SphereInFrustum(Vector3(x[i], y[i], z[i]), radius[i]))
+			{
+				visible[written++] = i;
+			}
+		}
+
+		return written;
+	}
+
+	uint32_t Frustum::CullBoxes(const float *x, const float *y, const float *z, const float *extentX, const float *extentY, const float *extentZ,
+		const uint32_t &count, uint32_t *visible) const
+	{
+		// A box is outside a plane when its most positive corner is behind it, that corner is the centre distance plus the extents projected onto the absolute normal.
+		uint32_t written = 0;
+		uint32_t i = 0;
+
+#if defined(ACID_SIMD_AVX)
+		const __m256 signMask = _mm256_set1_ps(-0.0f);
+
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 px = _mm256_loadu_ps(x + i);
+			__m256 py = _mm256_loadu_ps(y + i);
+			__m256 pz = _mm256_loadu_ps(z + i);
+			__m256 ex = _mm256_loadu_ps(extentX + i);
+			__m256 ey = _mm256_loadu_ps(extentY + i);
+			__m256 ez = _mm256_loadu_ps(extentZ + i);
+			__m256 outside = _mm256_setzero_ps();
+
+			for (const auto &plane : m_frustum)
+			{
+				__m256 nx = _mm256_set1_ps(plane[0]);
+				__m256 ny = _mm256_set1_ps(plane[1]);
+				__m256 nz = _mm256_set1_ps(plane[2]);
+				__m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx, px), _mm256_mul_ps(ny, py)),
+					_mm256_add_ps(_mm256_mul_ps(nz, pz), _mm256_set1_ps(plane[3])));
+				__m256 reach = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_andnot_ps(signMask, nx), ex), _mm256_mul_ps(_mm256_andnot_ps(signMask, ny), ey)),
+					_mm256_mul_ps(_mm256_andnot_ps(signMask, nz), ez));
+				outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(distance, reach), _mm256_setzero_ps(), _CMP_LE_OQ));
+			}
+
+			auto mask = static_cast<uint32_t>(~_mm256_movemask_ps(outside));
+
+			for (uint32_t lane = 0; lane < 8; lane++)
+			{
+				visible[written] = i + lane;
+				written += (mask >> lane) & 1;
+			}
+		}
+#elif defined(ACID_SIMD_SSE)
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 px = _mm_loadu_ps(x + i);
+			__m128 py = _mm_loadu_ps(y + i);
+			__m128 pz = _mm_loadu_ps(z + i);
+			__m128 ex = _mm_loadu_ps(extentX + i);
+			__m128 ey = _mm_loadu_ps(extentY + i);
+			__m128 ez = _mm_loadu_ps(extentZ + i);
+			__m128 outside = _mm_setzero_ps();
+
+			for (const auto &plane : m_frustum)
+			{
+				__m128 nx = _mm_set1_ps(plane[0]);
+				__m128 ny = _mm_set1_ps(plane[1]);
+				__m128 nz = _mm_set1_ps(plane[2]);
+				__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, px), _mm_mul_ps(ny, py)),
+					_mm_add_ps(_mm_mul_ps(nz, pz), _mm_set1_ps(plane[3])));
+				__m128 reach = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_andnot_ps(signMask, nx), ex), _mm_mul_ps(_mm_andnot_ps(signMask, ny), ey)),
+					_mm_mul_ps(_mm_andnot_ps(signMask, nz), ez));
+				outside = _mm_or_ps(outside, _mm_cmple_ps(_mm_add_ps(distance, reach), _mm_setzero_ps()));
+			}
+
+			auto mask = static_cast<uint32_t>(~_mm_movemask_ps(outside));
+
+			for (uint32_t lane = 0; lane < 4; lane++)
+			{
+				visible[written] = i + lane;
+				written += (mask >> lane) & 1;
+			}
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			bool inside = true;
+
+			for (const auto &plane : m_frustum)
+			{
+				float distance = plane[0] * x[i] + plane[1] * y[i] + plane[2] * z[i] + plane[3];
+				float reach = std::fabs(plane[0]) * extentX[i] + std::fabs(plane[1]) * extentY[i] + std::fabs(plane[2]) * extentZ[i];
+
+				if (distance + reach <= 0.0f)
+				{
+					inside = false;
+					break;
+				}
+			}
+
+			if (inside)
+			{
+				visible[written++] = i;
+			}
+		}
+
+		return written;
+	}
+
 	void Frustum::NormalizePlane(const int32_t &side)
 	{
 		float magnitude = std::sqrt(m_frustum[side][0] * m_frustum[side][0] +
@@ -48,6 +48,33 @@ namespace acid
 		/// <returns> True if partially contained, false if outside. </returns>
 		bool CubeInFrustum(const Vector3 &min, const Vector3 &max) const;
 
+		/// <summary>
+		/// Culls a batch of spheres stored as separate component arrays, several spheres are tested at once when SSE or AVX is available.
+		/// </summary>
+		/// <param name="x"> The sphere centres x components. </param>
+		/// <param name="y"> The sphere centres y components. </param>
+		/// <param name="z"> The sphere centres z components. </param>
+		/// <param name="radius"> The sphere radii. </param>
+		/// <param name="count"> The number of spheres. </param>
+		/// <param name="visible"> Filled with the indices of visible spheres, must hold at least count indices. </param>
+		/// <returns> The number of visible spheres written. </returns>
+		uint32_t CullSpheres(const float *x, const float *y, const float *z, const float *radius, const uint32_t &count, uint32_t *visible) const;
+
+		/// <summary>
+		/// Culls a batch of boxes stored as separate component arrays, a box is visible under the same rule as <see cref="CubeInFrustum"/>.
+		/// </summary>
+		/// <param name="x"> The box centres x components. </param>
+		/// <param name="y"> The box centres y components. </param>
+		/// <param name="z"> The box centres z components. </param>
+		/// <param name="extentX"> The box half sizes along x. </param>
+		/// <param name="extentY"> The box half sizes along y. </param>
+		/// <param name="extentZ"> The box half sizes along z. </param>
+		/// <param name="count"> The number of boxes. </param>
+		/// <param name="visible"> Filled with the indices of visible boxes, must hold at least count indices. </param>
+		/// <returns> The number of visible boxes written. </returns>
+		uint32_t CullBoxes(const float *x, const float *y, const float *z, const float *extentX, const float *extentY, const float *extentZ,
+			const uint32_t &count, uint32_t *visible) const;
+
 	private:
 		void NormalizePlane(const int32_t &side);
 	};
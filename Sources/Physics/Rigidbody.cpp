@@ -1,5 +1,6 @@
 ﻿#include "Rigidbody.hpp"
 
+#include <array>
 #include <cassert>
 #include <BulletCollision/CollisionShapes/btCollisionShape.h>
 #include <BulletDynamics/Dynamics/btDiscreteDynamicsWorld.h>
@@ -138,15 +139,65 @@ namespace acid
 
 	bool Rigidbody::InFrustum(const Frustum &frustum)
 	{
-		btVector3 min = btVector3();
-		btVector3 max = btVector3();
+		Vector3 min = Vector3();
+		Vector3 max = Vector3();
+		GetAabb(min, max);
+		return frustum.CubeInFrustum(min, max);
+	}
+
+	bool Rigidbody::GetAabb(Vector3 &min, Vector3 &max) const
+	{
+		btVector3 btMin = btVector3(0.0f, 0.0f, 0.0f);
+		btVector3 btMax = btVector3(0.0f, 0.0f, 0.0f);
+		bool created = m_body != nullptr && m_shape != nullptr;
+
+		if (created)
+		{
+			m_body->getAabb(btMin, btMax);
+		}
+
+		min = Collider::Convert(btMin);
+		max = Collider::Convert(btMax);
+		return created;
+	}
+
+	std::vector<uint8_t> Rigidbody::CullObjects(const Frustum &frustum, const std::vector<GameObject *> &objects)
+	{
+		auto visible = std::vector<uint8_t>(objects.size(), 1);
+		auto bounded = std::vector<uint32_t>();
+		std::array<std::vector<float>, 6> bounds;
+
+		for (uint32_t i = 0; i < objects.size(); i++)
+		{
+			auto rigidbody = objects[i]->GetComponent<Rigidbody>();
+			Vector3 min = Vector3();
+			Vector3 max = Vector3();
+
+			if (rigidbody == nullptr || !rigidbody->GetAabb(min, max))
+			{
+				continue;
+			}
+
+			for (uint32_t j = 0; j < 3; j++)
+			{
+				bounds[j].emplace_back(0.5f * (min[j] + max[j]));
+				bounds[j + 3].emplace_back(0.5f * (max[j] - min[j]));
+			}
+
+			bounded.emplace_back(i);
+			visible[i] = 0;
+		}
+
+		auto inside = std::vector<uint32_t>(bounded.size());
+		uint32_t insideCount = frustum.CullBoxes(bounds[0].data(), bounds[1].data(), bounds[2].data(), bounds[3].data(), bounds[4].data(), bounds[5].data(),
+			static_cast<uint32_t>(bounded.size()), inside.data());
 
-		if (m_body != nullptr && m_shape != nullptr)
+		for (uint32_t i = 0; i < insideCount; i++)
 		{
-			m_body->getAabb(min, max);
+			visible[bounded[inside[i]]] = 1;
 		}
 
-		return frustum.CubeInFrustum(Collider::Convert(min), Collider::Convert(max));
+		return visible;
 	}
 
 	void Rigidbody::SetGravity(const Vector3 &gravity)
@@ -61,6 +61,52 @@ namespace acid
 		/// <returns> If the shape is partially in the view frustum. </returns>
 		bool InFrustum(const Frustum &frustum);
 
+		/// <summary>
+		/// Gets the world space bounding box of the shape, zero if the body has not been created.
+		/// </summary>
+		/// <param name="min"> The minimum point to write into. </param>
+		/// <param name="max"> The maximum point to write into. </param>
+		/// <returns> If the body has been created. </returns>
+		bool GetAabb(Vector3 &min, Vector3 &max) const;
+
+		/// <summary>
+		/// Finds which objects have their rigidbody box in a frustum, every box is culled as one batch. Objects without a created body are always visible.
+		/// </summary>
+		/// <param name="frustum"> The frustum. </param>
+		/// <param name="objects"> The objects to cull. </param>
+		/// <returns> A flag for each object, non zero if the object is visible. </returns>
+		static std::vector<uint8_t> CullObjects(const Frustum &frustum, const std::vector<GameObject *> &objects);
+
+		/// <summary>
+		/// Removes the components whose object has its rigidbody box outside a frustum, the order of the remaining components is kept.
+		/// </summary>
+		/// <param name="frustum"> The frustum. </param>
+		/// <param name="components"> The components to cull. </param>
+		template<typename T>
+		static void CullComponents(const Frustum &frustum, std::vector<T *> &components)
+		{
+			auto objects = std::vector<GameObject *>();
+			objects.reserve(components.size());
+
+			for (auto &component : components)
+			{
+				objects.emplace_back(component->GetGameObject());
+			}
+
+			auto visible = CullObjects(frustum, objects);
+			std::size_t written = 0;
+
+			for (std::size_t i = 0; i < components.size(); i++)
+			{
+				if (visible[i] != 0)
+				{
+					components[written++] = components[i];
+				}
+			}
+
+			components.resize(written);
+		}
+
 		void SetGravity(const Vector3 &gravity);
 
 		Force *AddForce(Force *force);
@@ -1,6 +1,5 @@
 ﻿#include "Buffer.hpp"
 
-#include <cassert>
 #include "Display/Display.hpp"
 #include "Renderer/Renderer.hpp"
 
@@ -9,7 +8,8 @@ namespace acid
 	Buffer::Buffer(const VkDeviceSize &size, const VkBufferUsageFlags &usage, const VkMemoryPropertyFlags &properties) :
 		m_size(size),
 		m_buffer(VK_NULL_HANDLE),
-		m_bufferMemory(VK_NULL_HANDLE)
+		m_memory(MemoryAllocation()),
+		m_upload(0)
 	{
 		if (m_size == 0)
 		{
@@ -33,51 +33,56 @@ namespace acid
 
 		Display::CheckVk(vkCreateBuffer(logicalDevice, &bufferCreateInfo, nullptr, &m_buffer));
 
-		// Allocates buffer memory.
-		VkMemoryRequirements memoryRequirements;
-		vkGetBufferMemoryRequirements(logicalDevice, m_buffer, &memoryRequirements);
-
-		VkMemoryAllocateInfo memoryAllocateInfo = {};
-		memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-		memoryAllocateInfo.allocationSize = memoryRequirements.size;
-		memoryAllocateInfo.memoryTypeIndex = FindMemoryType(memoryRequirements.memoryTypeBits, properties);
-
-		Display::CheckVk(vkAllocateMemory(logicalDevice, &memoryAllocateInfo, nullptr, &m_bufferMemory));
-
-		vkBindBufferMemory(logicalDevice, m_buffer, m_bufferMemory, 0);
+		// Takes the memory from a shared block rather than allocating it for this buffer alone.
+		m_memory = Display::Get()->GetMemoryAllocator()->AllocateBuffer(m_buffer, properties);
 	}
 
 	Buffer::~Buffer()
 	{
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
+		auto memoryAllocator = Display::Get()->GetMemoryAllocator();
+		auto buffer = m_buffer;
+		auto memory = m_memory;
 
-		vkDestroyBuffer(logicalDevice, m_buffer, nullptr);
-		vkFreeMemory(logicalDevice, m_bufferMemory, nullptr);
+		// Frames still in flight may read from the buffer.
+		Renderer::Defer([logicalDevice, memoryAllocator, buffer, memory]()
+		{
+			vkDestroyBuffer(logicalDevice, buffer, nullptr);
+			memoryAllocator->Free(memory);
+		});
 	}
 
-	uint32_t Buffer::FindMemoryType(const uint32_t &typeFilter, const VkMemoryPropertyFlags &requiredProperties)
+	void Buffer::MapMemory(void **data) const
 	{
-		auto physicalDevice = Display::Get()->GetPhysicalDevice();
+		*data = m_memory.m_mapped;
+	}
 
-		VkPhysicalDeviceMemoryProperties physicalDeviceMemoryProperties;
-		vkGetPhysicalDeviceMemoryProperties(physicalDevice, &physicalDeviceMemoryProperties);
+	void Buffer::UnmapMemory() const
+	{
+		Display::Get()->GetMemoryAllocator()->Flush(m_memory);
+	}
 
-		for (uint32_t i = 0; i < physicalDeviceMemoryProperties.memoryTypeCount; i++)
+	void Buffer::Upload(const void *data, const VkDeviceSize &size, const VkDeviceSize &offset)
+	{
+		if (m_buffer == VK_NULL_HANDLE || size == 0)
 		{
-			uint32_t memoryTypeBits = 1 << i;
-			bool isRequiredMemoryType = typeFilter & memoryTypeBits;
-
-			VkMemoryPropertyFlags properties = physicalDeviceMemoryProperties.memoryTypes[i].propertyFlags;
-			bool hasRequiredProperties = (properties & requiredProperties) == requiredProperties;
-
-			if (isRequiredMemoryType && hasRequiredProperties)
-			{
-				return i;
-			}
+			return;
 		}
 
-		assert(false && "Failed to find a valid memory type for buffer!");
-		return 0;
+		auto buffer = m_buffer;
+		m_upload = Display::Get()->GetUploadQueue()->Upload(data, size, [buffer, size, offset](const VkCommandBuffer &commandBuffer, const VkBuffer &stagingBuffer, const VkDeviceSize &stagingOffset)
+		{
+			VkBufferCopy copyRegion = {};
+			copyRegion.srcOffset = stagingOffset;
+			copyRegion.dstOffset = offset;
+			copyRegion.size = size;
+			vkCmdCopyBuffer(commandBuffer, stagingBuffer, buffer, 1, &copyRegion);
+		});
+	}
+
+	uint32_t Buffer::FindMemoryType(const uint32_t &typeFilter, const VkMemoryPropertyFlags &requiredProperties)
+	{
+		return Display::Get()->GetMemoryAllocator()->FindMemoryType(typeFilter, requiredProperties);
 	}
 
 	void Buffer::CopyBuffer(const VkBuffer srcBuffer, const VkBuffer dstBuffer, const VkDeviceSize &size)
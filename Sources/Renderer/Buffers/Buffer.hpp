@@ -2,7 +2,9 @@
 
 #include <cstring>
 #include <vulkan/vulkan.h>
+#include "Renderer/Commands/UploadQueue.hpp"
 #include "Renderer/Descriptors/DescriptorSet.hpp"
+#include "Renderer/Memory/MemoryAllocator.hpp"
 
 namespace acid
 {
@@ -11,7 +13,8 @@ namespace acid
 	protected:
 		VkDeviceSize m_size;
 		VkBuffer m_buffer;
-		VkDeviceMemory m_bufferMemory;
+		MemoryAllocation m_memory;
+		UploadHandle m_upload;
 	public:
 		Buffer(const VkDeviceSize &size, const VkBufferUsageFlags &usage, const VkMemoryPropertyFlags &properties);
 
@@ -21,7 +24,33 @@ namespace acid
 
 		VkBuffer GetBuffer() const { return m_buffer; }
 
-		VkDeviceMemory GetBufferMemory() const { return m_bufferMemory; }
+		const MemoryAllocation &GetMemory() const { return m_memory; }
+
+		/// <summary>
+		/// Gets the host memory of a host visible buffer, the memory stays mapped for as long as the buffer lives.
+		/// </summary>
+		/// <param name="data"> The pointer to set to the start of the buffer. </param>
+		void MapMemory(void **data) const;
+
+		/// <summary>
+		/// Ends a write to the memory given by <seealso cref="#MapMemory()"/>, flushing it if the memory is not host coherent.
+		/// </summary>
+		void UnmapMemory() const;
+
+		/// <summary>
+		/// Copies data into a device local buffer through the upload queue, without waiting for the copy to finish.
+		/// The buffer must have been created with transfer destination usage.
+		/// </summary>
+		/// <param name="data"> The data to copy. </param>
+		/// <param name="size"> The size of the data. </param>
+		/// <param name="offset"> Where in the buffer to copy the data to. </param>
+		void Upload(const void *data, const VkDeviceSize &size, const VkDeviceSize &offset = 0);
+
+		/// <summary>
+		/// Gets the last upload to the buffer, frames read the buffer after it without waiting, anything reading it on the host waits on it first.
+		/// </summary>
+		/// <returns> The upload handle. </returns>
+		UploadHandle GetUpload() const { return m_upload; }
 
 		static uint32_t FindMemoryType(const uint32_t &typeFilter, const VkMemoryPropertyFlags &requiredProperties);
 
@@ -11,12 +11,10 @@ namespace acid
 
 	void InstanceBuffer::Update(const void *newData)
 	{
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
-
 		// Copies the data to the buffer.
 		void *data;
-		vkMapMemory(logicalDevice, m_bufferMemory, 0, m_size, 0, &data);
+		MapMemory(&data);
 		memcpy(data, newData, static_cast<size_t>(m_size));
-		vkUnmapMemory(logicalDevice, m_bufferMemory);
+		UnmapMemory();
 	}
 }
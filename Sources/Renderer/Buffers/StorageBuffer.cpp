@@ -1,28 +1,44 @@
 ﻿#include "StorageBuffer.hpp"
 
 #include "Display/Display.hpp"
+#include "Renderer/Renderer.hpp"
 
 namespace acid
 {
+	static VkDeviceSize FrameStride(const VkDeviceSize &size)
+	{
+		auto alignment = Display::Get()->GetPhysicalDeviceProperties().limits.minStorageBufferOffsetAlignment;
+		return alignment == 0 ? size : (size + alignment - 1) / alignment * alignment;
+	}
+
 	StorageBuffer::StorageBuffer(const VkDeviceSize &size) :
 		IDescriptor(),
-		Buffer(size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT), // TODO: Use DEVICE_LOCAL instead.
-		m_bufferInfo({})
+		Buffer(FrameStride(size) * Renderer::MAX_FRAMES_IN_FLIGHT, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT),
+		m_range(size),
+		m_stride(FrameStride(size)),
+		m_mapped(nullptr),
+		m_bufferInfos(std::vector<VkDescriptorBufferInfo>(Renderer::MAX_FRAMES_IN_FLIGHT))
 	{
-		m_bufferInfo.buffer = m_buffer;
-		m_bufferInfo.offset = 0;
-		m_bufferInfo.range = m_size;
+		for (uint32_t i = 0; i < Renderer::MAX_FRAMES_IN_FLIGHT; i++)
+		{
+			m_bufferInfos[i].buffer = m_buffer;
+			m_bufferInfos[i].offset = m_stride * i;
+			m_bufferInfos[i].range = m_range;
+		}
+
+		// The memory is host coherent and stays mapped with its block.
+		m_mapped = m_memory.m_mapped;
 	}
 
 	void StorageBuffer::Update(const void *newData)
 	{
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
+		if (m_mapped == nullptr)
+		{
+			return;
+		}
 
-		// Copies the data to the buffer.
-		void *data;
-		vkMapMemory(logicalDevice, m_bufferMemory, 0, m_size, 0, &data);
-		memcpy(data, newData, static_cast<size_t>(m_size));
-		vkUnmapMemory(logicalDevice, m_bufferMemory);
+		// Coherent memory needs no flush, the copy is seen by the next submission.
+		memcpy(m_mapped + m_stride * Renderer::Get()->GetFrameIndex(), newData, static_cast<size_t>(m_range));
 	}
 
 	DescriptorType StorageBuffer::CreateDescriptor(const uint32_t &binding, const VkDescriptorType &descriptorType, const VkShaderStageFlags &stage, const uint32_t &count)
@@ -50,7 +66,7 @@ namespace acid
 		descriptorWrite.dstArrayElement = 0;
 		descriptorWrite.descriptorType = descriptorType;
 		descriptorWrite.descriptorCount = 1;
-		descriptorWrite.pBufferInfo = &m_bufferInfo;
+		descriptorWrite.pBufferInfo = &m_bufferInfos[Renderer::Get()->GetFrameIndex()];
 
 		return descriptorWrite;
 	}
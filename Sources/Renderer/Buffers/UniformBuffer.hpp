@@ -1,5 +1,6 @@
 ﻿#pragma once
 
+#include <vector>
 #include <vulkan/vulkan.h>
 #include "Renderer/Descriptors/IDescriptor.hpp"
 #include "Renderer/Pipelines/ShaderProgram.hpp"
@@ -12,10 +13,21 @@ namespace acid
 		public Buffer
 	{
 	private:
-		VkDescriptorBufferInfo m_bufferInfo;
+		VkDeviceSize m_range;
+		VkDeviceSize m_stride;
+		char *m_mapped;
+		std::vector<VkDescriptorBufferInfo> m_bufferInfos;
 	public:
+		/// <summary>
+		/// Creates a uniform buffer holding one copy of the data per frame in flight, mapped for as long as it lives.
+		/// </summary>
+		/// <param name="size"> The size of the data. </param>
 		explicit UniformBuffer(const VkDeviceSize &size);
 
+		/// <summary>
+		/// Copies data into the copy read by the frame being recorded, the copies of frames still on the GPU are untouched.
+		/// </summary>
+		/// <param name="newData"> The data, the size given when the buffer was created. </param>
 		void Update(const void *newData);
 
 		static DescriptorType CreateDescriptor(const uint32_t &binding, const VkDescriptorType &descriptorType, const VkShaderStageFlags &stage, const uint32_t &count);
@@ -5,15 +5,10 @@
 namespace acid
 {
 	VertexBuffer::VertexBuffer(const uint64_t &elementSize, const size_t &vertexCount, const void *newData) :
-		Buffer(elementSize * vertexCount, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT),
+		Buffer(elementSize * vertexCount, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT),
 		m_vertexCount(static_cast<uint32_t>(vertexCount))
 	{
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
-
-		// Copies the vertex data to the buffer.
-		void *data;
-		vkMapMemory(logicalDevice, m_bufferMemory, 0, m_size, 0, &data);
-		memcpy(data, newData, static_cast<size_t>(m_size));
-		vkUnmapMemory(logicalDevice, m_bufferMemory);
+		// Copies the vertex data to device local memory, the frame drawing it first is submitted after the copy.
+		Upload(newData, m_size);
 	}
 }
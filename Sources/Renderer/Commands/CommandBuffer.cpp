@@ -5,18 +5,23 @@
 
 namespace acid
 {
-	CommandBuffer::CommandBuffer(const bool &begin, const VkQueueFlagBits &queueType, const VkCommandBufferLevel &bufferLevel) :
+	CommandBuffer::CommandBuffer(const bool &begin, const VkQueueFlagBits &queueType, const VkCommandBufferLevel &bufferLevel, VkCommandPool commandPool) :
+		m_commandPool(commandPool),
 		m_queueType(queueType),
 		m_bufferLevel(bufferLevel),
 		m_commandBuffer(VK_NULL_HANDLE),
 		m_running(false)
 	{
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
-		auto commandPool = Renderer::Get()->GetCommandPool();
+
+		if (m_commandPool == VK_NULL_HANDLE)
+		{
+			m_commandPool = Renderer::Get()->GetCommandPool();
+		}
 
 		VkCommandBufferAllocateInfo commandBufferAllocateInfo = {};
 		commandBufferAllocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-		commandBufferAllocateInfo.commandPool = commandPool;
+		commandBufferAllocateInfo.commandPool = m_commandPool;
 		commandBufferAllocateInfo.level = bufferLevel;
 		commandBufferAllocateInfo.commandBufferCount = 1;
 
@@ -31,16 +36,16 @@ namespace acid
 	CommandBuffer::~CommandBuffer()
 	{
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
-		auto commandPool = Renderer::Get()->GetCommandPool();
 
-		vkFreeCommandBuffers(logicalDevice, commandPool, 1, &m_commandBuffer);
+		vkFreeCommandBuffers(logicalDevice, m_commandPool, 1, &m_commandBuffer);
 	}
 
-	void CommandBuffer::Begin(const VkCommandBufferUsageFlags &usage)
+	void CommandBuffer::Begin(const VkCommandBufferUsageFlags &usage, const VkCommandBufferInheritanceInfo *inheritanceInfo)
 	{
 		VkCommandBufferBeginInfo beginInfo = {};
 		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
 		beginInfo.flags = usage;
+		beginInfo.pInheritanceInfo = inheritanceInfo;
 
 		Display::CheckVk(vkBeginCommandBuffer(m_commandBuffer, &beginInfo));
 		m_running = true;
@@ -85,7 +90,10 @@ namespace acid
 			Display::CheckVk(vkResetFences(logicalDevice, 1, &fence));
 		}
 
-		Display::CheckVk(vkQueueSubmit(queueSelected, 1, &submitInfo, fence));
+		{
+			std::lock_guard<std::mutex> lock(Display::Get()->GetQueueMutex());
+			Display::CheckVk(vkQueueSubmit(queueSelected, 1, &submitInfo, fence));
+		}
 
 		if (fence != VK_NULL_HANDLE)
 		{
@@ -98,6 +106,30 @@ namespace acid
 		}
 	}
 
+	void CommandBuffer::SubmitAsync(VkSemaphore waitSemaphore, const VkPipelineStageFlags &waitStage, VkSemaphore signalSemaphore, VkFence fence)
+	{
+		VkSubmitInfo submitInfo = {};
+		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submitInfo.commandBufferCount = 1;
+		submitInfo.pCommandBuffers = &m_commandBuffer;
+
+		if (waitSemaphore != VK_NULL_HANDLE)
+		{
+			submitInfo.waitSemaphoreCount = 1;
+			submitInfo.pWaitSemaphores = &waitSemaphore;
+			submitInfo.pWaitDstStageMask = &waitStage;
+		}
+
+		if (signalSemaphore != VK_NULL_HANDLE)
+		{
+			submitInfo.signalSemaphoreCount = 1;
+			submitInfo.pSignalSemaphores = &signalSemaphore;
+		}
+
+		std::lock_guard<std::mutex> lock(Display::Get()->GetQueueMutex());
+		Display::CheckVk(vkQueueSubmit(GetQueue(), 1, &submitInfo, fence));
+	}
+
 	VkQueue CommandBuffer::GetQueue() const
 	{
 		switch (m_queueType)
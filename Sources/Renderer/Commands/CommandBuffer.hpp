@@ -8,21 +8,44 @@ namespace acid
 	class ACID_EXPORT CommandBuffer
 	{
 	private:
+		VkCommandPool m_commandPool;
 		VkQueueFlagBits m_queueType;
 		VkCommandBufferLevel m_bufferLevel;
 		VkCommandBuffer m_commandBuffer;
 		bool m_running;
 	public:
-		explicit CommandBuffer(const bool &begin = true, const VkQueueFlagBits &queueType = VK_QUEUE_GRAPHICS_BIT, const VkCommandBufferLevel &bufferLevel = VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+		/// <summary>
+		/// Allocates a new command buffer.
+		/// </summary>
+		/// <param name="begin"> If recording begins straight away. </param>
+		/// <param name="queueType"> The queue the buffer is submitted to. </param>
+		/// <param name="bufferLevel"> If the buffer is primary or secondary. </param>
+		/// <param name="commandPool"> The pool to allocate from, the renderers shared pool if null. </param>
+		explicit CommandBuffer(const bool &begin = true, const VkQueueFlagBits &queueType = VK_QUEUE_GRAPHICS_BIT, const VkCommandBufferLevel &bufferLevel = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+			VkCommandPool commandPool = VK_NULL_HANDLE);
 
 		~CommandBuffer();
 
-		void Begin(const VkCommandBufferUsageFlags &usage = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+		/// <summary>
+		/// Begins recording into the buffer.
+		/// </summary>
+		/// <param name="usage"> How the buffer will be used. </param>
+		/// <param name="inheritanceInfo"> The renderpass state a secondary buffer continues, or null. </param>
+		void Begin(const VkCommandBufferUsageFlags &usage = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, const VkCommandBufferInheritanceInfo *inheritanceInfo = nullptr);
 
 		void End();
 
 		void Submit(VkSemaphore signalSemaphore = VK_NULL_HANDLE, VkFence fence = VK_NULL_HANDLE, const bool &createFence = true);
 
+		/// <summary>
+		/// Submits the buffer without waiting for it to finish.
+		/// </summary>
+		/// <param name="waitSemaphore"> A semaphore to wait on before the wait stage, or null. </param>
+		/// <param name="waitStage"> The pipeline stage that waits on the semaphore. </param>
+		/// <param name="signalSemaphore"> A semaphore to signal once the buffer finishes, or null. </param>
+		/// <param name="fence"> A fence to signal once the buffer finishes, or null. </param>
+		void SubmitAsync(VkSemaphore waitSemaphore, const VkPipelineStageFlags &waitStage, VkSemaphore signalSemaphore, VkFence fence);
+
 		bool IsRunning() const { return m_running; }
 
 		VkCommandBuffer GetCommandBuffer() const { return m_commandBuffer; }
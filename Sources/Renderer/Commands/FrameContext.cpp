@@ -0,0 +1,106 @@
+#include "FrameContext.hpp"
+
+#include "Display/Display.hpp"
+
+namespace acid
+{
+	FrameContext::FrameContext(const uint32_t &threadCount) :
+		m_commandPool(VK_NULL_HANDLE),
+		m_commandBuffer(nullptr),
+		m_imageAvailable(VK_NULL_HANDLE),
+		m_renderFinished(VK_NULL_HANDLE),
+		m_fence(VK_NULL_HANDLE),
+		m_threadCommands(std::vector<ThreadCommands>(threadCount)),
+		m_serial(0)
+	{
+		auto logicalDevice = Display::Get()->GetLogicalDevice();
+
+		// The whole pool is reset each frame, so its buffers never need resetting one at a time.
+		VkCommandPoolCreateInfo commandPoolCreateInfo = {};
+		commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+		commandPoolCreateInfo.queueFamilyIndex = Display::Get()->GetGraphicsFamily();
+		commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+		Display::CheckVk(vkCreateCommandPool(logicalDevice, &commandPoolCreateInfo, nullptr, &m_commandPool));
+
+		m_commandBuffer = std::make_unique<CommandBuffer>(false, VK_QUEUE_GRAPHICS_BIT, VK_COMMAND_BUFFER_LEVEL_PRIMARY, m_commandPool);
+
+		VkSemaphoreCreateInfo semaphoreCreateInfo = {};
+		semaphoreCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+
+		Display::CheckVk(vkCreateSemaphore(logicalDevice, &semaphoreCreateInfo, nullptr, &m_imageAvailable));
+		Display::CheckVk(vkCreateSemaphore(logicalDevice, &semaphoreCreateInfo, nullptr, &m_renderFinished));
+
+		// Starts signalled, there is nothing to wait for the first time the frame is used.
+		VkFenceCreateInfo fenceCreateInfo = {};
+		fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+		fenceCreateInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+
+		Display::CheckVk(vkCreateFence(logicalDevice, &fenceCreateInfo, nullptr, &m_fence));
+	}
+
+	FrameContext::~FrameContext()
+	{
+		auto logicalDevice = Display::Get()->GetLogicalDevice();
+
+		m_commandBuffer = nullptr;
+
+		for (auto &threadCommands : m_threadCommands)
+		{
+			threadCommands.m_commandBuffers.clear();
+
+			if (threadCommands.m_commandPool != VK_NULL_HANDLE)
+			{
+				vkDestroyCommandPool(logicalDevice, threadCommands.m_commandPool, nullptr);
+			}
+		}
+
+		vkDestroyFence(logicalDevice, m_fence, nullptr);
+		vkDestroySemaphore(logicalDevice, m_renderFinished, nullptr);
+		vkDestroySemaphore(logicalDevice, m_imageAvailable, nullptr);
+		vkDestroyCommandPool(logicalDevice, m_commandPool, nullptr);
+	}
+
+	void FrameContext::Wait()
+	{
+		auto logicalDevice = Display::Get()->GetLogicalDevice();
+
+		Display::CheckVk(vkWaitForFences(logicalDevice, 1, &m_fence, VK_TRUE, std::numeric_limits<uint64_t>::max()));
+		Display::CheckVk(vkResetCommandPool(logicalDevice, m_commandPool, 0));
+
+		// Resetting a pool resets every buffer allocated from it, so they are handed out again next frame.
+		for (auto &threadCommands : m_threadCommands)
+		{
+			if (threadCommands.m_used != 0)
+			{
+				Display::CheckVk(vkResetCommandPool(logicalDevice, threadCommands.m_commandPool, 0));
+				threadCommands.m_used = 0;
+			}
+		}
+	}
+
+	CommandBuffer *FrameContext::AcquireSecondary(const uint32_t &thread)
+	{
+		auto &threadCommands = m_threadCommands.at(thread);
+
+		if (threadCommands.m_commandPool == VK_NULL_HANDLE)
+		{
+			auto logicalDevice = Display::Get()->GetLogicalDevice();
+
+			VkCommandPoolCreateInfo commandPoolCreateInfo = {};
+			commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+			commandPoolCreateInfo.queueFamilyIndex = Display::Get()->GetGraphicsFamily();
+			commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+			Display::CheckVk(vkCreateCommandPool(logicalDevice, &commandPoolCreateInfo, nullptr, &threadCommands.m_commandPool));
+		}
+
+		if (threadCommands.m_used == threadCommands.m_commandBuffers.size())
+		{
+			threadCommands.m_commandBuffers.emplace_back(std::make_unique<CommandBuffer>(false, VK_QUEUE_GRAPHICS_BIT, VK_COMMAND_BUFFER_LEVEL_SECONDARY,
+				threadCommands.m_commandPool));
+		}
+
+		return threadCommands.m_commandBuffers[threadCommands.m_used++].get();
+	}
+}
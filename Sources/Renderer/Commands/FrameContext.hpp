@@ -0,0 +1,77 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "CommandBuffer.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// Everything one frame in flight needs to itself, so the CPU can record a frame while the GPU is still drawing the ones before it.
+	/// Each frame has its own command pool, command buffer, semaphores and fence, and the serial of the submission its fence signals for.
+	/// </summary>
+	class ACID_EXPORT FrameContext
+	{
+	private:
+		/// <summary>
+		/// Secondary command buffers recorded by one thread, command pools can only be used by one thread at a time.
+		/// </summary>
+		struct ThreadCommands
+		{
+			VkCommandPool m_commandPool = VK_NULL_HANDLE;
+			std::vector<std::unique_ptr<CommandBuffer>> m_commandBuffers;
+			uint32_t m_used = 0;
+		};
+
+		VkCommandPool m_commandPool;
+		std::unique_ptr<CommandBuffer> m_commandBuffer;
+		VkSemaphore m_imageAvailable;
+		VkSemaphore m_renderFinished;
+		VkFence m_fence;
+		std::vector<ThreadCommands> m_threadCommands;
+		uint64_t m_serial;
+	public:
+		/// <summary>
+		/// Creates a new frame context.
+		/// </summary>
+		/// <param name="threadCount"> The number of threads that may record secondary command buffers for the frame. </param>
+		explicit FrameContext(const uint32_t &threadCount = 1);
+
+		~FrameContext();
+
+		FrameContext(const FrameContext&) = delete;
+
+		FrameContext& operator=(const FrameContext&) = delete;
+
+		/// <summary>
+		/// Waits until the GPU has finished the last submission of this frame, then resets the command pool.
+		/// </summary>
+		void Wait();
+
+		/// <summary>
+		/// Gets a secondary command buffer to record into from a thread, the buffer is only valid until the frame is next waited on.
+		/// Every thread must use its own index, the pool for an index is created the first time it is used.
+		/// </summary>
+		/// <param name="thread"> The index of the recording thread, below the thread count. </param>
+		/// <returns> A secondary command buffer that has not begun recording. </returns>
+		CommandBuffer *AcquireSecondary(const uint32_t &thread);
+
+		VkCommandPool GetCommandPool() const { return m_commandPool; }
+
+		CommandBuffer *GetCommandBuffer() const { return m_commandBuffer.get(); }
+
+		VkSemaphore GetImageAvailable() const { return m_imageAvailable; }
+
+		VkSemaphore GetRenderFinished() const { return m_renderFinished; }
+
+		VkFence GetFence() const { return m_fence; }
+
+		/// <summary>
+		/// Gets the serial of the last submission of this frame, every submission up to it has finished once the frame is waited on.
+		/// </summary>
+		/// <returns> The submission serial, 0 before the frame is first submitted. </returns>
+		uint64_t GetSerial() const { return m_serial; }
+
+		void SetSerial(const uint64_t &serial) { m_serial = serial; }
+	};
+}
@@ -0,0 +1,306 @@
+#include "UploadQueue.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include "Display/Display.hpp"
+
+namespace acid
+{
+	const VkDeviceSize UploadQueue::RING_SIZE = 32 * 1024 * 1024;
+
+	static VkDeviceSize AlignUp(const VkDeviceSize &value, const VkDeviceSize &alignment)
+	{
+		return (value + alignment - 1) / alignment * alignment;
+	}
+
+	UploadQueue::UploadQueue(const VkPhysicalDevice &physicalDevice, const VkDevice &logicalDevice, MemoryAllocator *memoryAllocator, const VkQueue &queue, const uint32_t &queueFamily,
+		std::mutex &queueMutex) :
+		m_logicalDevice(logicalDevice),
+		m_memoryAllocator(memoryAllocator),
+		m_queue(queue),
+		m_queueMutex(&queueMutex),
+		m_commandPool(VK_NULL_HANDLE),
+		m_ring(StagingBuffer()),
+		m_ringSize(RING_SIZE),
+		m_ringHead(0),
+		m_ringTail(0),
+		m_copyAlignment(16),
+		m_recording(nullptr),
+		m_submitted(std::deque<std::unique_ptr<Batch>>()),
+		m_unused(std::vector<std::unique_ptr<Batch>>()),
+		m_nextValue(1),
+		m_completedValue(0)
+	{
+		VkPhysicalDeviceProperties physicalDeviceProperties;
+		vkGetPhysicalDeviceProperties(physicalDevice, &physicalDeviceProperties);
+
+		// A multiple of 16 is also a multiple of every texel size uploaded, and of the 4 bytes image copies need.
+		m_copyAlignment = std::max(m_copyAlignment, physicalDeviceProperties.limits.optimalBufferCopyOffsetAlignment);
+
+		// Batch command buffers are reset one at a time as they are reused.
+		VkCommandPoolCreateInfo commandPoolCreateInfo = {};
+		commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+		commandPoolCreateInfo.queueFamilyIndex = queueFamily;
+		commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+		Display::CheckVk(vkCreateCommandPool(m_logicalDevice, &commandPoolCreateInfo, nullptr, &m_commandPool));
+
+		m_ring = CreateStagingBuffer(m_ringSize);
+	}
+
+	UploadQueue::~UploadQueue()
+	{
+		WaitIdle();
+
+		for (auto &batch : m_unused)
+		{
+			vkDestroyFence(m_logicalDevice, batch->m_fence, nullptr);
+		}
+
+		// Destroying the pool frees the command buffers allocated from it.
+		vkDestroyCommandPool(m_logicalDevice, m_commandPool, nullptr);
+		DestroyStagingBuffer(m_ring);
+	}
+
+	UploadHandle UploadQueue::Upload(const void *data, const VkDeviceSize &size, const UploadCallback &record)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		Retire();
+
+		VkBuffer stagingBuffer = VK_NULL_HANDLE;
+		VkDeviceSize stagingOffset = 0;
+
+		if (data != nullptr && size != 0)
+		{
+			if (size > m_ringSize / 2)
+			{
+				auto staging = CreateStagingBuffer(size);
+				memcpy(staging.m_memory.m_mapped, data, static_cast<size_t>(size));
+				GetRecording().m_dedicated.emplace_back(staging);
+				stagingBuffer = staging.m_buffer;
+			}
+			else
+			{
+				// Only stalls once the ring is full, until the oldest batch frees its space.
+				while (!AllocateRing(size, stagingOffset))
+				{
+					if (m_submitted.empty())
+					{
+						SubmitRecording();
+					}
+
+					WaitOldest();
+				}
+
+				memcpy(m_ring.m_memory.m_mapped + stagingOffset, data, static_cast<size_t>(size));
+				stagingBuffer = m_ring.m_buffer;
+			}
+		}
+
+		auto &batch = GetRecording();
+		record(batch.m_commandBuffer, stagingBuffer, stagingOffset);
+		return batch.m_value;
+	}
+
+	void UploadQueue::Submit()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		Retire();
+		SubmitRecording();
+	}
+
+	bool UploadQueue::IsComplete(const UploadHandle &handle)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		Retire();
+		return handle <= m_completedValue;
+	}
+
+	void UploadQueue::Wait(const UploadHandle &handle)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if (m_recording != nullptr && handle >= m_recording->m_value)
+		{
+			SubmitRecording();
+		}
+
+		while (handle > m_completedValue && !m_submitted.empty())
+		{
+			WaitOldest();
+		}
+	}
+
+	void UploadQueue::WaitIdle()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		SubmitRecording();
+
+		while (!m_submitted.empty())
+		{
+			WaitOldest();
+		}
+	}
+
+	bool UploadQueue::AllocateRing(const VkDeviceSize &size, VkDeviceSize &offset)
+	{
+		VkDeviceSize start = AlignUp(m_ringHead, m_copyAlignment);
+
+		if (m_ringHead >= m_ringTail)
+		{
+			// The free space runs from the head to the end of the ring, then from the start of the ring to the tail.
+			if (start + size <= m_ringSize)
+			{
+				offset = start;
+				m_ringHead = start + size;
+				return true;
+			}
+
+			// The head never catches up to the tail, so a head equal to the tail always means the ring is empty.
+			if (size < m_ringTail)
+			{
+				offset = 0;
+				m_ringHead = size;
+				return true;
+			}
+
+			return false;
+		}
+
+		if (start + size < m_ringTail)
+		{
+			offset = start;
+			m_ringHead = start + size;
+			return true;
+		}
+
+		return false;
+	}
+
+	UploadQueue::StagingBuffer UploadQueue::CreateStagingBuffer(const VkDeviceSize &size)
+	{
+		VkBufferCreateInfo bufferCreateInfo = {};
+		bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+		bufferCreateInfo.size = size;
+		bufferCreateInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+		bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+		StagingBuffer stagingBuffer = {};
+		Display::CheckVk(vkCreateBuffer(m_logicalDevice, &bufferCreateInfo, nullptr, &stagingBuffer.m_buffer));
+		stagingBuffer.m_memory = m_memoryAllocator->AllocateBuffer(stagingBuffer.m_buffer, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+		return stagingBuffer;
+	}
+
+	void UploadQueue::DestroyStagingBuffer(const StagingBuffer &stagingBuffer)
+	{
+		vkDestroyBuffer(m_logicalDevice, stagingBuffer.m_buffer, nullptr);
+		m_memoryAllocator->Free(stagingBuffer.m_memory);
+	}
+
+	UploadQueue::Batch &UploadQueue::GetRecording()
+	{
+		if (m_recording != nullptr)
+		{
+			return *m_recording;
+		}
+
+		if (!m_unused.empty())
+		{
+			m_recording = std::move(m_unused.back());
+			m_unused.pop_back();
+		}
+		else
+		{
+			m_recording = std::make_unique<Batch>();
+
+			VkCommandBufferAllocateInfo commandBufferAllocateInfo = {};
+			commandBufferAllocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+			commandBufferAllocateInfo.commandPool = m_commandPool;
+			commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+			commandBufferAllocateInfo.commandBufferCount = 1;
+
+			Display::CheckVk(vkAllocateCommandBuffers(m_logicalDevice, &commandBufferAllocateInfo, &m_recording->m_commandBuffer));
+
+			VkFenceCreateInfo fenceCreateInfo = {};
+			fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+			Display::CheckVk(vkCreateFence(m_logicalDevice, &fenceCreateInfo, nullptr, &m_recording->m_fence));
+		}
+
+		m_recording->m_value = m_nextValue++;
+		m_recording->m_ringEnd = 0;
+
+		// Beginning a buffer from a pool created with the reset flag also resets it.
+		VkCommandBufferBeginInfo beginInfo = {};
+		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+		Display::CheckVk(vkBeginCommandBuffer(m_recording->m_commandBuffer, &beginInfo));
+		return *m_recording;
+	}
+
+	void UploadQueue::SubmitRecording()
+	{
+		if (m_recording == nullptr)
+		{
+			return;
+		}
+
+		// Uploads end in layouts read by fragment shaders, this makes them visible to every later stage too, such as vertex input and compute.
+		VkMemoryBarrier memoryBarrier = {};
+		memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		memoryBarrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+
+		vkCmdPipelineBarrier(m_recording->m_commandBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &memoryBarrier, 0, nullptr, 0, nullptr);
+
+		Display::CheckVk(vkEndCommandBuffer(m_recording->m_commandBuffer));
+
+		VkSubmitInfo submitInfo = {};
+		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submitInfo.commandBufferCount = 1;
+		submitInfo.pCommandBuffers = &m_recording->m_commandBuffer;
+
+		{
+			std::lock_guard<std::mutex> lock(*m_queueMutex);
+			Display::CheckVk(vkQueueSubmit(m_queue, 1, &submitInfo, m_recording->m_fence));
+		}
+
+		m_recording->m_ringEnd = m_ringHead;
+		m_submitted.emplace_back(std::move(m_recording));
+	}
+
+	void UploadQueue::WaitOldest()
+	{
+		if (m_submitted.empty())
+		{
+			return;
+		}
+
+		Display::CheckVk(vkWaitForFences(m_logicalDevice, 1, &m_submitted.front()->m_fence, VK_TRUE, std::numeric_limits<uint64_t>::max()));
+		Retire();
+	}
+
+	void UploadQueue::Retire()
+	{
+		// Batches finish in the order they were submitted, so the completed value only moves forward.
+		while (!m_submitted.empty() && vkGetFenceStatus(m_logicalDevice, m_submitted.front()->m_fence) == VK_SUCCESS)
+		{
+			auto batch = std::move(m_submitted.front());
+			m_submitted.pop_front();
+
+			m_ringTail = batch->m_ringEnd;
+			m_completedValue = batch->m_value;
+
+			for (auto &staging : batch->m_dedicated)
+			{
+				DestroyStagingBuffer(staging);
+			}
+
+			batch->m_dedicated.clear();
+			Display::CheckVk(vkResetFences(m_logicalDevice, 1, &batch->m_fence));
+			m_unused.emplace_back(std::move(batch));
+		}
+	}
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <vulkan/vulkan.h>
+#include "Renderer/Memory/MemoryAllocator.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// The point on the upload timeline a resource's data is written by, 0 for a resource that was never uploaded.
+	/// </summary>
+	typedef uint64_t UploadHandle;
+
+	/// <summary>
+	/// Records the copy commands of an upload, given the buffer and offset the data was staged at.
+	/// </summary>
+	typedef std::function<void(const VkCommandBuffer &commandBuffer, const VkBuffer &stagingBuffer, const VkDeviceSize &stagingOffset)> UploadCallback;
+
+	/// <summary>
+	/// Copies data into device local buffers and images without waiting for the GPU.
+	/// Data is staged in a persistently mapped ring buffer, and the copies of many uploads are recorded into one batch that is submitted once per frame, before the frame itself.
+	/// Each batch is a point on a timeline, the handle returned by an upload is the batch it was recorded into, and a batch is complete once its fence has signalled.
+	/// </summary>
+	class ACID_EXPORT UploadQueue
+	{
+	private:
+		struct StagingBuffer
+		{
+			VkBuffer m_buffer;
+			MemoryAllocation m_memory;
+		};
+
+		struct Batch
+		{
+			VkCommandBuffer m_commandBuffer;
+			VkFence m_fence;
+			UploadHandle m_value;
+			/// Where the ring head was when the batch was submitted, ring space up to here is free once the batch completes.
+			VkDeviceSize m_ringEnd;
+			/// Uploads too large for the ring are staged in buffers of their own, destroyed once the batch completes.
+			std::vector<StagingBuffer> m_dedicated;
+		};
+
+		VkDevice m_logicalDevice;
+		MemoryAllocator *m_memoryAllocator;
+		VkQueue m_queue;
+		std::mutex *m_queueMutex;
+		VkCommandPool m_commandPool;
+
+		StagingBuffer m_ring;
+		VkDeviceSize m_ringSize;
+		VkDeviceSize m_ringHead;
+		VkDeviceSize m_ringTail;
+		VkDeviceSize m_copyAlignment;
+
+		std::unique_ptr<Batch> m_recording;
+		std::deque<std::unique_ptr<Batch>> m_submitted;
+		std::vector<std::unique_ptr<Batch>> m_unused;
+		UploadHandle m_nextValue;
+		UploadHandle m_completedValue;
+		std::mutex m_mutex;
+	public:
+		/// <summary>
+		/// The size of the staging ring, uploads larger than half of it get a staging buffer of their own.
+		/// </summary>
+		static const VkDeviceSize RING_SIZE;
+
+		/// <summary>
+		/// Creates a new upload queue.
+		/// </summary>
+		/// <param name="physicalDevice"> The physical device, its copy alignment is read once. </param>
+		/// <param name="logicalDevice"> The device to upload to. </param>
+		/// <param name="memoryAllocator"> The allocator the staging memory is taken from. </param>
+		/// <param name="queue"> The queue batches are submitted to, the same queue frames are submitted to. </param>
+		/// <param name="queueFamily"> The family of the queue. </param>
+		/// <param name="queueMutex"> The mutex held around every submission to the queue. </param>
+		UploadQueue(const VkPhysicalDevice &physicalDevice, const VkDevice &logicalDevice, MemoryAllocator *memoryAllocator, const VkQueue &queue, const uint32_t &queueFamily,
+			std::mutex &queueMutex);
+
+		~UploadQueue();
+
+		UploadQueue(const UploadQueue&) = delete;
+
+		UploadQueue& operator=(const UploadQueue&) = delete;
+
+		/// <summary>
+		/// Stages data and records the commands that copy it out of the staging buffer, can be called from any thread.
+		/// Commands are recorded while the queue is locked, so they must not upload again.
+		/// </summary>
+		/// <param name="data"> The data to stage, or null if the commands need no data. </param>
+		/// <param name="size"> The size of the data. </param>
+		/// <param name="record"> The function recording the copy commands. </param>
+		/// <returns> The handle to wait on before the data is read outside of the frames. </returns>
+		UploadHandle Upload(const void *data, const VkDeviceSize &size, const UploadCallback &record);
+
+		/// <summary>
+		/// Submits the batch being recorded, if it has any uploads. Frames are submitted to the same queue afterwards, so they read the uploaded data without waiting on the CPU.
+		/// </summary>
+		void Submit();
+
+		/// <summary>
+		/// Gets if an upload has finished on the GPU.
+		/// </summary>
+		/// <param name="handle"> The handle returned by the upload. </param>
+		/// <returns> If the upload has finished. </returns>
+		bool IsComplete(const UploadHandle &handle);
+
+		/// <summary>
+		/// Waits until an upload has finished on the GPU, submitting it first if it is still being recorded.
+		/// Only needed when the data is read outside of the frames, such as reading it back to the host.
+		/// </summary>
+		/// <param name="handle"> The handle returned by the upload. </param>
+		void Wait(const UploadHandle &handle);
+
+		/// <summary>
+		/// Submits and waits on every upload so far.
+		/// </summary>
+		void WaitIdle();
+	private:
+		bool AllocateRing(const VkDeviceSize &size, VkDeviceSize &offset);
+
+		StagingBuffer CreateStagingBuffer(const VkDeviceSize &size);
+
+		void DestroyStagingBuffer(const StagingBuffer &stagingBuffer);
+
+		Batch &GetRecording();
+
+		void SubmitRecording();
+
+		void WaitOldest();
+
+		void Retire();
+	};
+}
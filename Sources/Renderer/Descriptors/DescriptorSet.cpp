@@ -1,10 +1,15 @@
 #include "DescriptorSet.hpp"
 
+#include <mutex>
 #include "Display/Display.hpp"
+#include "Renderer/Renderer.hpp"
 #include "IDescriptor.hpp"
 
 namespace acid
 {
+	/// Descriptor pools are shared by every set of a pipeline, and sets are allocated from the jobs recording a frame.
+	static std::mutex POOL_MUTEX;
+
 	DescriptorSet::DescriptorSet(const IPipeline &pipeline) :
 		m_pipelineLayout(pipeline.GetPipelineLayout()),
 		m_pipelineBindPoint(pipeline.GetPipelineBindPoint()),
@@ -22,14 +27,22 @@ namespace acid
 		descriptorSetAllocateInfo.descriptorSetCount = 1;
 		descriptorSetAllocateInfo.pSetLayouts = layouts;
 
+		std::lock_guard<std::mutex> lock(POOL_MUTEX);
 		Display::CheckVk(vkAllocateDescriptorSets(logicalDevice, &descriptorSetAllocateInfo, &m_descriptorSet));
 	}
 
 	DescriptorSet::~DescriptorSet()
 	{
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
-
-		Display::CheckVk(vkFreeDescriptorSets(logicalDevice, m_descriptorPool, 1, &m_descriptorSet));
+		auto descriptorPool = m_descriptorPool;
+		auto descriptorSet = m_descriptorSet;
+
+		// Frames still in flight may have the set bound, pipelines run what was deferred before destroying their pool.
+		Renderer::Defer([logicalDevice, descriptorPool, descriptorSet]()
+		{
+			std::lock_guard<std::mutex> lock(POOL_MUTEX);
+			Display::CheckVk(vkFreeDescriptorSets(logicalDevice, descriptorPool, 1, &descriptorSet));
+		});
 	}
 
 	void DescriptorSet::Update(const std::vector<VkWriteDescriptorSet> &descriptorWrites)
@@ -1,21 +1,27 @@
 #include "DescriptorsHandler.hpp"
 
+#include "Renderer/Renderer.hpp"
+
 namespace acid
 {
 	DescriptorsHandler::DescriptorsHandler() :
 		m_shaderProgram(nullptr),
-		m_descriptorSet(nullptr),
+		m_descriptorSets(std::vector<std::unique_ptr<DescriptorSet>>()),
 		m_descriptors(std::vector<IDescriptor *>()),
-		m_changed(false)
+		m_changedFrames(0)
 	{
 	}
 
 	DescriptorsHandler::DescriptorsHandler(const IPipeline &pipeline) :
 		m_shaderProgram(pipeline.GetShaderProgram()),
-		m_descriptorSet(std::make_unique<DescriptorSet>(pipeline)),
+		m_descriptorSets(std::vector<std::unique_ptr<DescriptorSet>>()),
 		m_descriptors(std::vector<IDescriptor *>(m_shaderProgram->GetLastDescriptorBinding() + 1)),
-		m_changed(true)
+		m_changedFrames(UINT32_MAX)
 	{
+		for (uint32_t i = 0; i < Renderer::MAX_FRAMES_IN_FLIGHT; i++)
+		{
+			m_descriptorSets.emplace_back(std::make_unique<DescriptorSet>(pipeline));
+		}
 	}
 
 	void DescriptorsHandler::Push(const std::string &descriptorName, IDescriptor *descriptor)
@@ -42,7 +48,7 @@ namespace acid
 		if (m_descriptors.at(location) != descriptor)
 		{
 			m_descriptors.at(location) = descriptor;
-			m_changed = true;
+			m_changedFrames = UINT32_MAX;
 		}
 	}
 
@@ -86,13 +92,23 @@ namespace acid
 
 			m_shaderProgram = pipeline.GetShaderProgram();
 			m_descriptors.resize(m_shaderProgram->GetLastDescriptorBinding() + 1);
-			m_descriptorSet = std::make_unique<DescriptorSet>(pipeline);
-			m_changed = false;
+			m_descriptorSets.clear();
+
+			for (uint32_t i = 0; i < Renderer::MAX_FRAMES_IN_FLIGHT; i++)
+			{
+				m_descriptorSets.emplace_back(std::make_unique<DescriptorSet>(pipeline));
+			}
+
+			m_changedFrames = 0;
 			return false;
 		}
 
-		if (m_changed)
+		uint32_t frameIndex = Renderer::Get()->GetFrameIndex();
+		uint32_t frameBit = 1 << frameIndex;
+
+		if ((m_changedFrames & frameBit) != 0)
 		{
+			auto &descriptorSet = *m_descriptorSets[frameIndex];
 			std::vector<VkWriteDescriptorSet> descriptorWrites = {};
 
 			for (uint32_t i = 0; i < m_descriptors.size(); i++)
@@ -100,12 +116,12 @@ namespace acid
 				if (m_descriptors.at(i) != nullptr)
 				{
 					VkDescriptorType descriptorType = m_shaderProgram->GetDescriptorType(i);
-					descriptorWrites.emplace_back(m_descriptors[i]->GetWriteDescriptor(i, descriptorType, *m_descriptorSet));
+					descriptorWrites.emplace_back(m_descriptors[i]->GetWriteDescriptor(i, descriptorType, descriptorSet));
 				}
 			}
 
-			m_descriptorSet->Update(descriptorWrites);
-			m_changed = false;
+			descriptorSet.Update(descriptorWrites);
+			m_changedFrames &= ~frameBit;
 		}
 
 		return true;
@@ -113,6 +129,16 @@ namespace acid
 
 	void DescriptorsHandler::BindDescriptor(const CommandBuffer &commandBuffer)
 	{
-		m_descriptorSet->BindDescriptor(commandBuffer);
+		m_descriptorSets[Renderer::Get()->GetFrameIndex()]->BindDescriptor(commandBuffer);
+	}
+
+	DescriptorSet *DescriptorsHandler::GetDescriptorSet() const
+	{
+		if (m_descriptorSets.empty())
+		{
+			return nullptr;
+		}
+
+		return m_descriptorSets[Renderer::Get()->GetFrameIndex()].get();
 	}
 }
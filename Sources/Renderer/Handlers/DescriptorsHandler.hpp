@@ -16,9 +16,11 @@ namespace acid
 	{
 	private:
 		ShaderProgram *m_shaderProgram;
-		std::unique_ptr<DescriptorSet> m_descriptorSet;
+		/// One set per frame in flight, a set can not be written while a frame on the GPU has it bound.
+		std::vector<std::unique_ptr<DescriptorSet>> m_descriptorSets;
 		std::vector<IDescriptor *> m_descriptors;
-		bool m_changed;
+		/// Bit i is set while the set for frame i has not been written with the latest descriptors.
+		uint32_t m_changedFrames;
 	public:
 		DescriptorsHandler();
 
@@ -46,6 +48,6 @@ namespace acid
 
 		void BindDescriptor(const CommandBuffer &commandBuffer);
 
-		DescriptorSet *GetDescriptorSet() const { return m_descriptorSet.get(); }
+		DescriptorSet *GetDescriptorSet() const;
 	};
 }
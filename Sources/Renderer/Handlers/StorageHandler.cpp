@@ -1,5 +1,7 @@
 #include "StorageHandler.hpp"
 
+#include "Renderer/Renderer.hpp"
+
 namespace acid
 {
 	StorageHandler::StorageHandler(const bool &multipipeline) :
@@ -7,7 +9,7 @@ namespace acid
 		m_uniformBlock(nullptr),
 		m_storageBuffer(nullptr),
 		m_data(nullptr),
-		m_changed(false)
+		m_changedFrames(0)
 	{
 	}
 
@@ -16,7 +18,7 @@ namespace acid
 		m_uniformBlock(uniformBlock),
 		m_storageBuffer(std::make_unique<StorageBuffer>(static_cast<VkDeviceSize>(m_uniformBlock->GetSize()))),
 		m_data(malloc(static_cast<size_t>(m_uniformBlock->GetSize()))),
-		m_changed(true)
+		m_changedFrames(UINT32_MAX)
 	{
 	}
 
@@ -34,14 +36,16 @@ namespace acid
 			m_uniformBlock = uniformBlock;
 			m_storageBuffer = std::make_unique<StorageBuffer>(static_cast<VkDeviceSize>(m_uniformBlock->GetSize()));
 			m_data = malloc(static_cast<size_t>(m_uniformBlock->GetSize()));
-			m_changed = false;
+			m_changedFrames = 0;
 			return false;
 		}
 
-		if (m_changed)
+		uint32_t frameBit = 1 << Renderer::Get()->GetFrameIndex();
+
+		if ((m_changedFrames & frameBit) != 0)
 		{
 			m_storageBuffer->Update(m_data);
-			m_changed = false;
+			m_changedFrames &= ~frameBit;
 		}
 
 		return true;
@@ -16,7 +16,8 @@ namespace acid
 		UniformBlock *m_uniformBlock;
 		std::unique_ptr<StorageBuffer> m_storageBuffer;
 		void *m_data; // TODO: Convert to unique_ptr
-		bool m_changed;
+		/// Bit i is set while the copy for frame i has not been given the latest data.
+		uint32_t m_changedFrames;
 	public:
 		explicit StorageHandler(const bool &multipipeline = false);
 
@@ -28,7 +29,7 @@ namespace acid
 		void Push(const T &object, const size_t &offset, const size_t &size)
 		{
 			memcpy((char *) m_data + offset, &object, size);
-			m_changed = true;
+			m_changedFrames = UINT32_MAX;
 		}
 
 		template<typename T>
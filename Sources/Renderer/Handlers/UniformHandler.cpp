@@ -1,5 +1,7 @@
 #include "UniformHandler.hpp"
 
+#include "Renderer/Renderer.hpp"
+
 namespace acid
 {
 	UniformHandler::UniformHandler(const bool &multipipeline) :
@@ -7,7 +9,7 @@ namespace acid
 		m_uniformBlock(nullptr),
 		m_uniformBuffer(nullptr),
 		m_data(nullptr),
-		m_changed(false)
+		m_changedFrames(0)
 	{
 	}
 
@@ -16,7 +18,7 @@ namespace acid
 		m_uniformBlock(uniformBlock),
 		m_uniformBuffer(std::make_unique<UniformBuffer>(static_cast<VkDeviceSize>(m_uniformBlock->GetSize()))),
 		m_data(malloc(static_cast<size_t>(m_uniformBlock->GetSize()))),
-		m_changed(true)
+		m_changedFrames(UINT32_MAX)
 	{
 	}
 
@@ -27,6 +29,8 @@ namespace acid
 
 	bool UniformHandler::Update(UniformBlock *uniformBlock)
 	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
 		if ((m_multipipeline && m_uniformBlock == nullptr) || (!m_multipipeline && m_uniformBlock != uniformBlock))
 		{
 			free(m_data);
@@ -34,14 +38,16 @@ namespace acid
 			m_uniformBlock = uniformBlock;
 			m_uniformBuffer = std::make_unique<UniformBuffer>(static_cast<VkDeviceSize>(m_uniformBlock->GetSize()));
 			m_data = malloc(static_cast<size_t>(m_uniformBlock->GetSize()));
-			m_changed = false;
+			m_changedFrames = 0;
 			return false;
 		}
 
-		if (m_changed)
+		uint32_t frameBit = 1 << Renderer::Get()->GetFrameIndex();
+
+		if ((m_changedFrames & frameBit) != 0)
 		{
 			m_uniformBuffer->Update(m_data);
-			m_changed = false;
+			m_changedFrames &= ~frameBit;
 		}
 
 		return true;
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
 #include "Renderer/Buffers/UniformBuffer.hpp"
 
 namespace acid
@@ -16,7 +17,10 @@ namespace acid
 		UniformBlock *m_uniformBlock;
 		std::unique_ptr<UniformBuffer> m_uniformBuffer;
 		void *m_data; // TODO: Convert to unique_ptr
-		bool m_changed;
+		/// Bit i is set while the copy for frame i has not been given the latest data.
+		uint32_t m_changedFrames;
+		/// A handler shared between objects, like a scene handler, is updated by every job recording those objects.
+		std::mutex m_mutex;
 	public:
 		explicit UniformHandler(const bool &multipipeline = false);
 
@@ -28,7 +32,7 @@ namespace acid
 		void Push(const T &object, const size_t &offset, const size_t &size)
 		{
 			memcpy((char *) m_data + offset, &object, size);
-			m_changed = true;
+			m_changedFrames = UINT32_MAX;
 		}
 
 		template<typename T>
@@ -33,6 +33,23 @@ namespace acid
 		/// <param name="camera"> The camera to be used when rendering. </param>
 		virtual void Render(const CommandBuffer &commandBuffer, const Vector4 &clipPlane, const ICamera &camera) = 0;
 
+		/// <summary>
+		/// Called on the main thread each frame before the renderer is recorded, lets the renderer split its recording into jobs.
+		/// When any renderer in a subpass has jobs the subpass is recorded into secondary command buffers, jobs on worker threads and the other renderers on the main thread.
+		/// </summary>
+		/// <param name="clipPlane"> The current clip plane. </param>
+		/// <param name="camera"> The camera to be used when rendering. </param>
+		/// <returns> The number of jobs passed to <seealso cref="#RenderJob"/>, or zero to be recorded with <seealso cref="#Render"/>. </returns>
+		virtual uint32_t PrepareJobs(const Vector4 &clipPlane, const ICamera &camera) { return 0; }
+
+		/// <summary>
+		/// Records one of the jobs from <seealso cref="#PrepareJobs"/>, jobs are called from any thread at once so may only change state of their own.
+		/// The command buffers are executed in job order.
+		/// </summary>
+		/// <param name="commandBuffer"> The command buffer to record into. </param>
+		/// <param name="job"> The index of the job. </param>
+		virtual void RenderJob(const CommandBuffer &commandBuffer, const uint32_t &job) {}
+
 		GraphicsStage GetGraphicsStage() const { return m_graphicsStage; }
 
 		bool IsEnabled() const { return m_enabled; };
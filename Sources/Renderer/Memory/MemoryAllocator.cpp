@@ -0,0 +1,464 @@
+#include "MemoryAllocator.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include "Display/Display.hpp"
+
+namespace acid
+{
+	const VkDeviceSize MemoryAllocator::BLOCK_SIZE = 64 * 1024 * 1024;
+	const VkDeviceSize MemoryAllocator::SLAB_SIZE = 1024 * 1024;
+	const VkDeviceSize MemoryAllocator::SLAB_MIN_SIZE = 256;
+	const VkDeviceSize MemoryAllocator::SLAB_MAX_SIZE = 64 * 1024;
+
+	static VkDeviceSize AlignUp(const VkDeviceSize &value, const VkDeviceSize &alignment)
+	{
+		return (value + alignment - 1) / alignment * alignment;
+	}
+
+	static uint32_t SizeClass(const VkDeviceSize &slotSize)
+	{
+		uint32_t sizeClass = 0;
+
+		for (VkDeviceSize size = MemoryAllocator::SLAB_MIN_SIZE; size < slotSize; size <<= 1)
+		{
+			sizeClass++;
+		}
+
+		return sizeClass;
+	}
+
+	MemoryAllocator::MemoryAllocator(const VkPhysicalDevice &physicalDevice, const VkDevice &logicalDevice) :
+		m_logicalDevice(logicalDevice),
+		m_memoryProperties({}),
+		m_nonCoherentAtomSize(1),
+		m_pools(std::vector<std::unique_ptr<Pool>>()),
+		m_dedicatedCount(0),
+		m_dedicatedBytes(0),
+		m_allocationCount(0),
+		m_usedBytes(0)
+	{
+		vkGetPhysicalDeviceMemoryProperties(physicalDevice, &m_memoryProperties);
+
+		VkPhysicalDeviceProperties physicalDeviceProperties;
+		vkGetPhysicalDeviceProperties(physicalDevice, &physicalDeviceProperties);
+		m_nonCoherentAtomSize = std::max(physicalDeviceProperties.limits.nonCoherentAtomSize, static_cast<VkDeviceSize>(1));
+
+		// One pool for buffers and linear images and one for optimal images, for each memory type.
+		m_pools.resize(m_memoryProperties.memoryTypeCount * 2);
+	}
+
+	MemoryAllocator::~MemoryAllocator()
+	{
+	}
+
+	MemoryAllocation MemoryAllocator::Allocate(const VkMemoryRequirements &memoryRequirements, const VkMemoryPropertyFlags &properties, const bool &linear)
+	{
+		uint32_t memoryType = FindMemoryType(memoryRequirements.memoryTypeBits, properties);
+		VkMemoryPropertyFlags typeProperties = m_memoryProperties.memoryTypes[memoryType].propertyFlags;
+		VkDeviceSize size = memoryRequirements.size;
+		VkDeviceSize alignment = std::max(memoryRequirements.alignment, static_cast<VkDeviceSize>(1));
+
+		// Flushes of memory that is not coherent cover whole atoms, so no two allocations may share an atom.
+		if ((typeProperties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0 && (typeProperties & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == 0)
+		{
+			alignment = std::max(alignment, m_nonCoherentAtomSize);
+			size = AlignUp(size, m_nonCoherentAtomSize);
+		}
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		auto &pool = GetPool(memoryType, linear);
+		MemoryAllocation allocation = {};
+		allocation.m_size = size;
+		allocation.m_pool = memoryType * 2 + (linear ? 1 : 0);
+
+		if (size > pool.m_blockSize / 2)
+		{
+			// Large resources get memory of their own rather than leaving most of a block unused.
+			VkMemoryAllocateInfo memoryAllocateInfo = {};
+			memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+			memoryAllocateInfo.allocationSize = size;
+			memoryAllocateInfo.memoryTypeIndex = memoryType;
+
+			if (vkAllocateMemory(m_logicalDevice, &memoryAllocateInfo, nullptr, &allocation.m_memory) != VK_SUCCESS)
+			{
+				Log::Error("Failed to allocate %llu bytes of dedicated memory\n", static_cast<unsigned long long>(size));
+				return {};
+			}
+
+			if (pool.m_mapped)
+			{
+				void *data;
+				Display::CheckVk(vkMapMemory(m_logicalDevice, allocation.m_memory, 0, VK_WHOLE_SIZE, 0, &data));
+				allocation.m_mapped = static_cast<char *>(data);
+			}
+
+			m_dedicatedCount++;
+			m_dedicatedBytes += size;
+		}
+		else if (size <= SLAB_MAX_SIZE && alignment <= SLAB_MAX_SIZE)
+		{
+			// Slots are a power of two no smaller than the alignment, and slabs start on a slot boundary, so every slot is aligned.
+			VkDeviceSize slotSize = SLAB_MIN_SIZE;
+
+			while (slotSize < size || slotSize < alignment)
+			{
+				slotSize <<= 1;
+			}
+
+			auto &slabs = pool.m_slabs[SizeClass(slotSize)];
+			MemorySlab *slab = nullptr;
+
+			for (auto it = slabs.rbegin(); it != slabs.rend(); ++it)
+			{
+				if (!(*it)->m_freeSlots.empty())
+				{
+					slab = it->get();
+					break;
+				}
+			}
+
+			if (slab == nullptr)
+			{
+				MemoryBlock *block;
+				VkDeviceSize offset;
+
+				if (!AllocateRange(pool, SLAB_SIZE, slotSize, block, offset))
+				{
+					return {};
+				}
+
+				auto created = std::make_unique<MemorySlab>();
+				created->m_block = block;
+				created->m_offset = offset;
+				created->m_slotSize = slotSize;
+				created->m_slotCount = static_cast<uint32_t>(SLAB_SIZE / slotSize);
+
+				// Slots are handed out from the back, lowest offset first.
+				for (uint32_t i = created->m_slotCount; i > 0; i--)
+				{
+					created->m_freeSlots.emplace_back(i - 1);
+				}
+
+				slab = created.get();
+				slabs.emplace_back(std::move(created));
+			}
+
+			uint32_t slot = slab->m_freeSlots.back();
+			slab->m_freeSlots.pop_back();
+
+			allocation.m_memory = slab->m_block->GetMemory();
+			allocation.m_offset = slab->m_offset + slot * slab->m_slotSize;
+			allocation.m_block = slab->m_block;
+			allocation.m_slab = slab;
+		}
+		else
+		{
+			MemoryBlock *block;
+			VkDeviceSize offset;
+
+			if (!AllocateRange(pool, size, alignment, block, offset))
+			{
+				return {};
+			}
+
+			allocation.m_memory = block->GetMemory();
+			allocation.m_offset = offset;
+			allocation.m_block = block;
+		}
+
+		if (allocation.m_block != nullptr && allocation.m_block->GetMapped() != nullptr)
+		{
+			allocation.m_mapped = allocation.m_block->GetMapped() + allocation.m_offset;
+		}
+
+		m_allocationCount++;
+		m_usedBytes += allocation.m_size;
+		return allocation;
+	}
+
+	MemoryAllocation MemoryAllocator::AllocateBuffer(const VkBuffer &buffer, const VkMemoryPropertyFlags &properties)
+	{
+		VkMemoryRequirements memoryRequirements;
+		vkGetBufferMemoryRequirements(m_logicalDevice, buffer, &memoryRequirements);
+
+		auto allocation = Allocate(memoryRequirements, properties, true);
+
+		if (allocation.m_memory == VK_NULL_HANDLE)
+		{
+			Log::Error("Could not give a buffer of %llu bytes memory, it is left unbound\n", static_cast<unsigned long long>(memoryRequirements.size));
+			return allocation;
+		}
+
+		Display::CheckVk(vkBindBufferMemory(m_logicalDevice, buffer, allocation.m_memory, allocation.m_offset));
+		return allocation;
+	}
+
+	MemoryAllocation MemoryAllocator::AllocateImage(const VkImage &image, const VkMemoryPropertyFlags &properties, const bool &linear)
+	{
+		VkMemoryRequirements memoryRequirements;
+		vkGetImageMemoryRequirements(m_logicalDevice, image, &memoryRequirements);
+
+		auto allocation = Allocate(memoryRequirements, properties, linear);
+
+		if (allocation.m_memory == VK_NULL_HANDLE)
+		{
+			Log::Error("Could not give an image of %llu bytes memory, it is left unbound\n", static_cast<unsigned long long>(memoryRequirements.size));
+			return allocation;
+		}
+
+		Display::CheckVk(vkBindImageMemory(m_logicalDevice, image, allocation.m_memory, allocation.m_offset));
+		return allocation;
+	}
+
+	void MemoryAllocator::Free(const MemoryAllocation &allocation)
+	{
+		if (allocation.m_memory == VK_NULL_HANDLE)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		m_allocationCount--;
+		m_usedBytes -= allocation.m_size;
+
+		if (allocation.m_block == nullptr)
+		{
+			vkFreeMemory(m_logicalDevice, allocation.m_memory, nullptr);
+			m_dedicatedCount--;
+			m_dedicatedBytes -= allocation.m_size;
+			return;
+		}
+
+		auto &pool = *m_pools[allocation.m_pool];
+
+		if (allocation.m_slab == nullptr)
+		{
+			allocation.m_block->Free(allocation.m_offset);
+			ReleaseBlock(pool, allocation.m_block, true);
+			return;
+		}
+
+		auto slab = allocation.m_slab;
+		slab->m_freeSlots.emplace_back(static_cast<uint32_t>((allocation.m_offset - slab->m_offset) / slab->m_slotSize));
+
+		if (slab->m_freeSlots.size() != slab->m_slotCount)
+		{
+			return;
+		}
+
+		// One empty slab is kept for each size class, so a resource recreated every frame does not take a range from a block each time.
+		auto &slabs = pool.m_slabs[SizeClass(slab->m_slotSize)];
+		bool otherEmpty = std::any_of(slabs.begin(), slabs.end(), [slab](const std::unique_ptr<MemorySlab> &other)
+		{
+			return other.get() != slab && other->m_freeSlots.size() == other->m_slotCount;
+		});
+
+		if (otherEmpty)
+		{
+			auto block = slab->m_block;
+			block->Free(slab->m_offset);
+			slabs.erase(std::remove_if(slabs.begin(), slabs.end(), [slab](const std::unique_ptr<MemorySlab> &other)
+			{
+				return other.get() == slab;
+			}), slabs.end());
+			ReleaseBlock(pool, block, true);
+		}
+	}
+
+	void MemoryAllocator::Flush(const MemoryAllocation &allocation) const
+	{
+		if (allocation.m_mapped == nullptr)
+		{
+			return;
+		}
+
+		uint32_t memoryType = allocation.m_pool / 2;
+
+		if ((m_memoryProperties.memoryTypes[memoryType].propertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0)
+		{
+			return;
+		}
+
+		VkMappedMemoryRange mappedMemoryRange = {};
+		mappedMemoryRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+		mappedMemoryRange.memory = allocation.m_memory;
+		mappedMemoryRange.offset = allocation.m_offset;
+		mappedMemoryRange.size = allocation.m_size;
+		Display::CheckVk(vkFlushMappedMemoryRanges(m_logicalDevice, 1, &mappedMemoryRange));
+	}
+
+	VkDeviceSize MemoryAllocator::ReleaseEmpty()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		VkDeviceSize released = 0;
+
+		for (auto &pool : m_pools)
+		{
+			if (pool == nullptr)
+			{
+				continue;
+			}
+
+			for (auto &slabs : pool->m_slabs)
+			{
+				slabs.erase(std::remove_if(slabs.begin(), slabs.end(), [](const std::unique_ptr<MemorySlab> &slab)
+				{
+					if (slab->m_freeSlots.size() != slab->m_slotCount)
+					{
+						return false;
+					}
+
+					slab->m_block->Free(slab->m_offset);
+					return true;
+				}), slabs.end());
+			}
+
+			for (auto &block : pool->m_blocks)
+			{
+				if (block->IsEmpty())
+				{
+					released += block->GetSize();
+				}
+			}
+
+			pool->m_blocks.erase(std::remove_if(pool->m_blocks.begin(), pool->m_blocks.end(), [](const std::unique_ptr<MemoryBlock> &block)
+			{
+				return block->IsEmpty();
+			}), pool->m_blocks.end());
+		}
+
+		return released;
+	}
+
+	MemoryStatistics MemoryAllocator::GetStatistics() const
+	{
+		MemoryStatistics statistics = {};
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			for (auto &pool : m_pools)
+			{
+				if (pool == nullptr)
+				{
+					continue;
+				}
+
+				for (auto &block : pool->m_blocks)
+				{
+					statistics.m_blockCount++;
+					statistics.m_reservedBytes += block->GetSize();
+					statistics.m_largestFreeRange = std::max(statistics.m_largestFreeRange, block->GetLargestFree());
+				}
+
+				for (auto &slabs : pool->m_slabs)
+				{
+					statistics.m_slabCount += static_cast<uint32_t>(slabs.size());
+				}
+			}
+
+			statistics.m_dedicatedCount = m_dedicatedCount;
+			statistics.m_allocationCount = m_allocationCount;
+			statistics.m_reservedBytes += m_dedicatedBytes;
+			statistics.m_usedBytes = m_usedBytes;
+		}
+
+		return statistics;
+	}
+
+	uint32_t MemoryAllocator::FindMemoryType(const uint32_t &typeFilter, const VkMemoryPropertyFlags &requiredProperties) const
+	{
+		for (uint32_t i = 0; i < m_memoryProperties.memoryTypeCount; i++)
+		{
+			uint32_t memoryTypeBits = 1 << i;
+			bool isRequiredMemoryType = typeFilter & memoryTypeBits;
+
+			VkMemoryPropertyFlags properties = m_memoryProperties.memoryTypes[i].propertyFlags;
+			bool hasRequiredProperties = (properties & requiredProperties) == requiredProperties;
+
+			if (isRequiredMemoryType && hasRequiredProperties)
+			{
+				return i;
+			}
+		}
+
+		assert(false && "Failed to find a valid memory type for buffer!");
+		return 0;
+	}
+
+	MemoryAllocator::Pool &MemoryAllocator::GetPool(const uint32_t &memoryType, const bool &linear)
+	{
+		auto &pool = m_pools[memoryType * 2 + (linear ? 1 : 0)];
+
+		if (pool == nullptr)
+		{
+			VkMemoryPropertyFlags properties = m_memoryProperties.memoryTypes[memoryType].propertyFlags;
+			VkDeviceSize heapSize = m_memoryProperties.memoryHeaps[m_memoryProperties.memoryTypes[memoryType].heapIndex].size;
+
+			pool = std::make_unique<Pool>();
+			pool->m_memoryType = memoryType;
+			pool->m_mapped = (properties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0;
+			// Small heaps, like the device local host visible heap on many desktop GPUs, are not filled by a few blocks.
+			pool->m_blockSize = std::max(std::min(BLOCK_SIZE, AlignUp(heapSize / 8, SLAB_SIZE)), 4 * SLAB_SIZE);
+			pool->m_slabs.resize(SizeClass(SLAB_MAX_SIZE) + 1);
+		}
+
+		return *pool;
+	}
+
+	bool MemoryAllocator::AllocateRange(Pool &pool, const VkDeviceSize &size, const VkDeviceSize &alignment, MemoryBlock *&block, VkDeviceSize &offset)
+	{
+		for (auto &candidate : pool.m_blocks)
+		{
+			if (candidate->GetSize() - candidate->GetUsed() >= size && candidate->Allocate(size, alignment, offset))
+			{
+				block = candidate.get();
+				return true;
+			}
+		}
+
+		pool.m_blocks.emplace_back(std::make_unique<MemoryBlock>(m_logicalDevice, pool.m_memoryType, pool.m_blockSize, pool.m_mapped));
+
+		// A block the device had no memory for is dropped straight away.
+		if (pool.m_blocks.back()->GetMemory() == VK_NULL_HANDLE || !pool.m_blocks.back()->Allocate(size, alignment, offset))
+		{
+			Log::Error("Failed to allocate %llu bytes from a new memory block\n", static_cast<unsigned long long>(size));
+			pool.m_blocks.pop_back();
+			return false;
+		}
+
+		block = pool.m_blocks.back().get();
+		return true;
+	}
+
+	void MemoryAllocator::ReleaseBlock(Pool &pool, MemoryBlock *block, const bool &keepOne)
+	{
+		if (!block->IsEmpty())
+		{
+			return;
+		}
+
+		// An empty block is kept while it is the only one, so freeing and allocating again does not go to the driver each time.
+		if (keepOne)
+		{
+			bool otherEmpty = std::any_of(pool.m_blocks.begin(), pool.m_blocks.end(), [block](const std::unique_ptr<MemoryBlock> &other)
+			{
+				return other.get() != block && other->IsEmpty();
+			});
+
+			if (!otherEmpty)
+			{
+				return;
+			}
+		}
+
+		pool.m_blocks.erase(std::remove_if(pool.m_blocks.begin(), pool.m_blocks.end(), [block](const std::unique_ptr<MemoryBlock> &other)
+		{
+			return other.get() == block;
+		}), pool.m_blocks.end());
+	}
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <vulkan/vulkan.h>
+#include "MemoryBlock.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// A range of a memory block split into equal slots, small allocations of one size class are taken from it without a search.
+	/// </summary>
+	struct MemorySlab
+	{
+		MemoryBlock *m_block;
+		VkDeviceSize m_offset;
+		VkDeviceSize m_slotSize;
+		uint32_t m_slotCount;
+		std::vector<uint32_t> m_freeSlots;
+	};
+
+	/// <summary>
+	/// A range of device memory handed out by the <seealso cref="MemoryAllocator"/>.
+	/// </summary>
+	struct MemoryAllocation
+	{
+		VkDeviceMemory m_memory = VK_NULL_HANDLE;
+		VkDeviceSize m_offset = 0;
+		VkDeviceSize m_size = 0;
+		/// The start of the range in host memory, null if the memory is not host visible.
+		char *m_mapped = nullptr;
+		/// Where the range was taken from, a memory allocated for this range alone has no block.
+		MemoryBlock *m_block = nullptr;
+		MemorySlab *m_slab = nullptr;
+		uint32_t m_pool = 0;
+	};
+
+	struct MemoryStatistics
+	{
+		uint32_t m_blockCount;
+		uint32_t m_slabCount;
+		uint32_t m_dedicatedCount;
+		uint32_t m_allocationCount;
+		/// Device memory taken from the driver, in blocks and dedicated allocations.
+		VkDeviceSize m_reservedBytes;
+		/// Memory handed out to resources.
+		VkDeviceSize m_usedBytes;
+		/// The largest range free in any one block.
+		VkDeviceSize m_largestFreeRange;
+	};
+
+	/// <summary>
+	/// Sub-allocates device memory so resources share a few large allocations instead of each calling vkAllocateMemory.
+	/// Small allocations come from size class slabs, larger ones from blocks with a TLSF allocator, and very large ones get memory of their own.
+	/// Buffers and linear images are kept in other blocks to optimal images, so the buffer image granularity never has to be respected.
+	/// </summary>
+	class ACID_EXPORT MemoryAllocator
+	{
+	private:
+		struct Pool
+		{
+			uint32_t m_memoryType;
+			bool m_mapped;
+			VkDeviceSize m_blockSize;
+			std::vector<std::unique_ptr<MemoryBlock>> m_blocks;
+			/// Slabs for each size class, from <seealso cref="#SLAB_MIN_SIZE"/> up to <seealso cref="#SLAB_MAX_SIZE"/>.
+			std::vector<std::vector<std::unique_ptr<MemorySlab>>> m_slabs;
+		};
+
+		VkDevice m_logicalDevice;
+		VkPhysicalDeviceMemoryProperties m_memoryProperties;
+		VkDeviceSize m_nonCoherentAtomSize;
+
+		std::vector<std::unique_ptr<Pool>> m_pools;
+		uint32_t m_dedicatedCount;
+		VkDeviceSize m_dedicatedBytes;
+		uint32_t m_allocationCount;
+		VkDeviceSize m_usedBytes;
+		mutable std::mutex m_mutex;
+	public:
+		/// <summary>
+		/// The size of the blocks allocations are taken from, smaller on devices where this is a large part of the heap.
+		/// </summary>
+		static const VkDeviceSize BLOCK_SIZE;
+
+		/// <summary>
+		/// The size of a slab, and the smallest and largest size classes taken from slabs.
+		/// </summary>
+		static const VkDeviceSize SLAB_SIZE;
+		static const VkDeviceSize SLAB_MIN_SIZE;
+		static const VkDeviceSize SLAB_MAX_SIZE;
+
+		/// <summary>
+		/// Creates a new memory allocator.
+		/// </summary>
+		/// <param name="physicalDevice"> The physical device, its memory properties are read once. </param>
+		/// <param name="logicalDevice"> The device to allocate from. </param>
+		MemoryAllocator(const VkPhysicalDevice &physicalDevice, const VkDevice &logicalDevice);
+
+		~MemoryAllocator();
+
+		/// <summary>
+		/// Allocates memory for a resource.
+		/// </summary>
+		/// <param name="memoryRequirements"> The requirements of the resource. </param>
+		/// <param name="properties"> The memory properties needed. </param>
+		/// <param name="linear"> If the resource is a buffer or linear image rather than an optimal image. </param>
+		/// <returns> The allocation, with no memory if the device ran out. </returns>
+		MemoryAllocation Allocate(const VkMemoryRequirements &memoryRequirements, const VkMemoryPropertyFlags &properties, const bool &linear);
+
+		/// <summary>
+		/// Allocates memory for a buffer and binds it, a buffer that could not be given memory is reported and left unbound.
+		/// </summary>
+		/// <param name="buffer"> The buffer. </param>
+		/// <param name="properties"> The memory properties needed. </param>
+		/// <returns> The allocation, with no memory if the device ran out. </returns>
+		MemoryAllocation AllocateBuffer(const VkBuffer &buffer, const VkMemoryPropertyFlags &properties);
+
+		/// <summary>
+		/// Allocates memory for an image and binds it, an image that could not be given memory is reported and left unbound.
+		/// </summary>
+		/// <param name="image"> The image. </param>
+		/// <param name="properties"> The memory properties needed. </param>
+		/// <param name="linear"> If the image has linear tiling. </param>
+		/// <returns> The allocation, with no memory if the device ran out. </returns>
+		MemoryAllocation AllocateImage(const VkImage &image, const VkMemoryPropertyFlags &properties, const bool &linear);
+
+		/// <summary>
+		/// Gives an allocation back, the resource using it must already be destroyed.
+		/// </summary>
+		/// <param name="allocation"> The allocation. </param>
+		void Free(const MemoryAllocation &allocation);
+
+		/// <summary>
+		/// Makes host writes to an allocation visible to the device, only needed if the memory is not host coherent.
+		/// </summary>
+		/// <param name="allocation"> The allocation. </param>
+		void Flush(const MemoryAllocation &allocation) const;
+
+		/// <summary>
+		/// Gives back the memory of empty slabs and blocks that are kept to avoid allocating them again.
+		/// This does not defragment, live allocations are never moved as that would need every owner to rebind its resource,
+		/// so a block with a single allocation left stays reserved.
+		/// </summary>
+		/// <returns> The bytes of device memory given back to the driver. </returns>
+		VkDeviceSize ReleaseEmpty();
+
+		/// <summary>
+		/// Gets the memory used, reserved and free.
+		/// </summary>
+		/// <returns> The statistics. </returns>
+		MemoryStatistics GetStatistics() const;
+
+		/// <summary>
+		/// Finds a memory type from the memory properties read when the allocator was created.
+		/// </summary>
+		/// <param name="typeFilter"> The bits of the memory types allowed. </param>
+		/// <param name="requiredProperties"> The memory properties needed. </param>
+		/// <returns> The memory type index. </returns>
+		uint32_t FindMemoryType(const uint32_t &typeFilter, const VkMemoryPropertyFlags &requiredProperties) const;
+	private:
+		Pool &GetPool(const uint32_t &memoryType, const bool &linear);
+
+		bool AllocateRange(Pool &pool, const VkDeviceSize &size, const VkDeviceSize &alignment, MemoryBlock *&block, VkDeviceSize &offset);
+
+		void ReleaseBlock(Pool &pool, MemoryBlock *block, const bool &keepOne);
+	};
+}
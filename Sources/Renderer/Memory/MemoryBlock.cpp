@@ -0,0 +1,333 @@
+#include "MemoryBlock.hpp"
+
+#include "Display/Display.hpp"
+
+namespace acid
+{
+	/// Each power of two size class is split into this many linear steps.
+	static const uint32_t SECOND_LEVEL_LOG2 = 5;
+	static const uint32_t SECOND_LEVEL_COUNT = 1 << SECOND_LEVEL_LOG2;
+	static const uint32_t FIRST_LEVEL_COUNT = 64;
+	/// Ranges are kept to multiples of this size so the smallest ranges still land in a size class with linear steps.
+	static const VkDeviceSize MIN_RANGE_SIZE = SECOND_LEVEL_COUNT;
+	static const uint32_t NONE = UINT32_MAX;
+
+	static uint32_t HighestBit(uint64_t value)
+	{
+		uint32_t bit = 0;
+
+		while (value >>= 1)
+		{
+			bit++;
+		}
+
+		return bit;
+	}
+
+	static uint32_t LowestBit(uint64_t value)
+	{
+		uint32_t bit = 0;
+
+		while ((value & 1) == 0)
+		{
+			value >>= 1;
+			bit++;
+		}
+
+		return bit;
+	}
+
+	static VkDeviceSize AlignUp(const VkDeviceSize &value, const VkDeviceSize &alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	static void MapSize(const VkDeviceSize &size, uint32_t &firstLevel, uint32_t &secondLevel)
+	{
+		firstLevel = HighestBit(size);
+		secondLevel = static_cast<uint32_t>(size >> (firstLevel - SECOND_LEVEL_LOG2)) - SECOND_LEVEL_COUNT;
+	}
+
+	MemoryBlock::MemoryBlock(const VkDevice &logicalDevice, const uint32_t &memoryType, const VkDeviceSize &size, const bool &mapped) :
+		m_logicalDevice(logicalDevice),
+		m_memory(VK_NULL_HANDLE),
+		m_size(size),
+		m_mapped(nullptr),
+		m_ranges(std::vector<Range>()),
+		m_unusedRanges(std::vector<uint32_t>()),
+		m_allocated(std::unordered_map<VkDeviceSize, uint32_t>()),
+		m_used(0),
+		m_firstLevelBitmap(0),
+		m_secondLevelBitmaps(std::vector<uint32_t>(FIRST_LEVEL_COUNT, 0)),
+		m_freeHeads(std::vector<uint32_t>(FIRST_LEVEL_COUNT * SECOND_LEVEL_COUNT, NONE))
+	{
+		VkMemoryAllocateInfo memoryAllocateInfo = {};
+		memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		memoryAllocateInfo.allocationSize = m_size;
+		memoryAllocateInfo.memoryTypeIndex = memoryType;
+
+		// Running out of device memory leaves the block with no free ranges, so nothing is ever taken from it.
+		if (vkAllocateMemory(m_logicalDevice, &memoryAllocateInfo, nullptr, &m_memory) != VK_SUCCESS)
+		{
+			m_memory = VK_NULL_HANDLE;
+			return;
+		}
+
+		if (mapped)
+		{
+			void *data;
+			Display::CheckVk(vkMapMemory(m_logicalDevice, m_memory, 0, VK_WHOLE_SIZE, 0, &data));
+			m_mapped = static_cast<char *>(data);
+		}
+
+		// The whole block starts as a single free range.
+		uint32_t index = CreateRange();
+		m_ranges[index] = Range{0, m_size, NONE, NONE, NONE, NONE, true};
+		InsertFree(index);
+	}
+
+	MemoryBlock::~MemoryBlock()
+	{
+		// Freeing the memory also unmaps it.
+		vkFreeMemory(m_logicalDevice, m_memory, nullptr);
+	}
+
+	bool MemoryBlock::Allocate(const VkDeviceSize &size, const VkDeviceSize &alignment, VkDeviceSize &offset)
+	{
+		VkDeviceSize rangeSize = AlignUp(std::max(size, MIN_RANGE_SIZE), MIN_RANGE_SIZE);
+		VkDeviceSize rangeAlignment = std::max(alignment, MIN_RANGE_SIZE);
+
+		// Looks for room to align the start as well, the padding is given back below.
+		// The search is rounded up to the next size class so any range in the class found is large enough.
+		VkDeviceSize search = rangeSize + rangeAlignment - MIN_RANGE_SIZE;
+		search += (static_cast<VkDeviceSize>(1) << (HighestBit(search) - SECOND_LEVEL_LOG2)) - 1;
+
+		if (search > m_size)
+		{
+			return false;
+		}
+
+		uint32_t firstLevel;
+		uint32_t secondLevel;
+		MapSize(search, firstLevel, secondLevel);
+		uint32_t index = FindFree(firstLevel, secondLevel);
+
+		if (index == NONE)
+		{
+			return false;
+		}
+
+		RemoveFree(index);
+
+		VkDeviceSize alignedOffset = AlignUp(m_ranges[index].m_offset, rangeAlignment);
+		VkDeviceSize padding = alignedOffset - m_ranges[index].m_offset;
+
+		if (padding != 0)
+		{
+			// The previous range is never free, free neighbours are always merged, so the padding stays its own range.
+			uint32_t front = CreateRange();
+			auto &range = m_ranges[index];
+			m_ranges[front] = Range{range.m_offset, padding, range.m_previous, index, NONE, NONE, true};
+
+			if (range.m_previous != NONE)
+			{
+				m_ranges[range.m_previous].m_next = front;
+			}
+
+			range.m_previous = front;
+			range.m_offset += padding;
+			range.m_size -= padding;
+			InsertFree(front);
+		}
+
+		if (m_ranges[index].m_size - rangeSize >= MIN_RANGE_SIZE)
+		{
+			uint32_t back = CreateRange();
+			auto &range = m_ranges[index];
+			m_ranges[back] = Range{range.m_offset + rangeSize, range.m_size - rangeSize, index, range.m_next, NONE, NONE, true};
+
+			if (range.m_next != NONE)
+			{
+				m_ranges[range.m_next].m_previous = back;
+			}
+
+			range.m_next = back;
+			range.m_size = rangeSize;
+			InsertFree(back);
+		}
+
+		auto &range = m_ranges[index];
+		range.m_free = false;
+		m_used += range.m_size;
+		m_allocated.emplace(range.m_offset, index);
+		offset = range.m_offset;
+		return true;
+	}
+
+	void MemoryBlock::Free(const VkDeviceSize &offset)
+	{
+		auto it = m_allocated.find(offset);
+
+		if (it == m_allocated.end())
+		{
+			Log::Error("Memory block range at %i was not allocated\n", static_cast<int32_t>(offset));
+			return;
+		}
+
+		uint32_t index = it->second;
+		m_allocated.erase(it);
+		m_used -= m_ranges[index].m_size;
+		m_ranges[index].m_free = true;
+
+		uint32_t next = m_ranges[index].m_next;
+
+		if (next != NONE && m_ranges[next].m_free)
+		{
+			RemoveFree(next);
+			m_ranges[index].m_size += m_ranges[next].m_size;
+			m_ranges[index].m_next = m_ranges[next].m_next;
+
+			if (m_ranges[index].m_next != NONE)
+			{
+				m_ranges[m_ranges[index].m_next].m_previous = index;
+			}
+
+			ReleaseRange(next);
+		}
+
+		uint32_t previous = m_ranges[index].m_previous;
+
+		if (previous != NONE && m_ranges[previous].m_free)
+		{
+			RemoveFree(previous);
+			m_ranges[previous].m_size += m_ranges[index].m_size;
+			m_ranges[previous].m_next = m_ranges[index].m_next;
+
+			if (m_ranges[previous].m_next != NONE)
+			{
+				m_ranges[m_ranges[previous].m_next].m_previous = previous;
+			}
+
+			ReleaseRange(index);
+			index = previous;
+		}
+
+		InsertFree(index);
+	}
+
+	VkDeviceSize MemoryBlock::GetLargestFree() const
+	{
+		if (m_firstLevelBitmap == 0)
+		{
+			return 0;
+		}
+
+		// Ranges in the highest non empty class can differ in size, so that one list is walked.
+		uint32_t firstLevel = HighestBit(m_firstLevelBitmap);
+		uint32_t secondLevel = HighestBit(m_secondLevelBitmaps[firstLevel]);
+		VkDeviceSize largest = 0;
+
+		for (uint32_t index = m_freeHeads[firstLevel * SECOND_LEVEL_COUNT + secondLevel]; index != NONE; index = m_ranges[index].m_nextFree)
+		{
+			largest = std::max(largest, m_ranges[index].m_size);
+		}
+
+		return largest;
+	}
+
+	uint32_t MemoryBlock::FindFree(uint32_t firstLevel, uint32_t secondLevel) const
+	{
+		uint32_t secondLevelMap = m_secondLevelBitmaps[firstLevel] & (~0u << secondLevel);
+
+		if (secondLevelMap == 0)
+		{
+			uint64_t firstLevelMap = firstLevel + 1 < FIRST_LEVEL_COUNT ? m_firstLevelBitmap & (~static_cast<uint64_t>(0) << (firstLevel + 1)) : 0;
+
+			if (firstLevelMap == 0)
+			{
+				return NONE;
+			}
+
+			firstLevel = LowestBit(firstLevelMap);
+			secondLevelMap = m_secondLevelBitmaps[firstLevel];
+		}
+
+		secondLevel = LowestBit(secondLevelMap);
+		return m_freeHeads[firstLevel * SECOND_LEVEL_COUNT + secondLevel];
+	}
+
+	void MemoryBlock::InsertFree(const uint32_t &index)
+	{
+		uint32_t firstLevel;
+		uint32_t secondLevel;
+		MapSize(m_ranges[index].m_size, firstLevel, secondLevel);
+
+		auto &head = m_freeHeads[firstLevel * SECOND_LEVEL_COUNT + secondLevel];
+		m_ranges[index].m_free = true;
+		m_ranges[index].m_previousFree = NONE;
+		m_ranges[index].m_nextFree = head;
+
+		if (head != NONE)
+		{
+			m_ranges[head].m_previousFree = index;
+		}
+
+		head = index;
+		m_firstLevelBitmap |= static_cast<uint64_t>(1) << firstLevel;
+		m_secondLevelBitmaps[firstLevel] |= 1u << secondLevel;
+	}
+
+	void MemoryBlock::RemoveFree(const uint32_t &index)
+	{
+		uint32_t firstLevel;
+		uint32_t secondLevel;
+		MapSize(m_ranges[index].m_size, firstLevel, secondLevel);
+
+		auto &range = m_ranges[index];
+
+		if (range.m_previousFree != NONE)
+		{
+			m_ranges[range.m_previousFree].m_nextFree = range.m_nextFree;
+		}
+		else
+		{
+			m_freeHeads[firstLevel * SECOND_LEVEL_COUNT + secondLevel] = range.m_nextFree;
+		}
+
+		if (range.m_nextFree != NONE)
+		{
+			m_ranges[range.m_nextFree].m_previousFree = range.m_previousFree;
+		}
+
+		range.m_previousFree = NONE;
+		range.m_nextFree = NONE;
+
+		if (m_freeHeads[firstLevel * SECOND_LEVEL_COUNT + secondLevel] == NONE)
+		{
+			m_secondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+
+			if (m_secondLevelBitmaps[firstLevel] == 0)
+			{
+				m_firstLevelBitmap &= ~(static_cast<uint64_t>(1) << firstLevel);
+			}
+		}
+	}
+
+	uint32_t MemoryBlock::CreateRange()
+	{
+		if (!m_unusedRanges.empty())
+		{
+			uint32_t index = m_unusedRanges.back();
+			m_unusedRanges.pop_back();
+			return index;
+		}
+
+		m_ranges.emplace_back();
+		return static_cast<uint32_t>(m_ranges.size() - 1);
+	}
+
+	void MemoryBlock::ReleaseRange(const uint32_t &index)
+	{
+		m_unusedRanges.emplace_back(index);
+	}
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+#include <vulkan/vulkan.h>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// A single device memory allocation shared between many resources, using a two level segregated fit (TLSF) allocator.
+	/// Free ranges are kept in lists by size class with a bitmap over the lists, so a fitting range is found and a freed range merged with its neighbours in constant time.
+	/// </summary>
+	class ACID_EXPORT MemoryBlock
+	{
+	private:
+		struct Range
+		{
+			VkDeviceSize m_offset;
+			VkDeviceSize m_size;
+			/// The ranges next to this one in memory.
+			uint32_t m_previous;
+			uint32_t m_next;
+			/// The ranges next to this one in its free list.
+			uint32_t m_previousFree;
+			uint32_t m_nextFree;
+			bool m_free;
+		};
+
+		VkDevice m_logicalDevice;
+		VkDeviceMemory m_memory;
+		VkDeviceSize m_size;
+		char *m_mapped;
+
+		std::vector<Range> m_ranges;
+		std::vector<uint32_t> m_unusedRanges;
+		std::unordered_map<VkDeviceSize, uint32_t> m_allocated;
+		VkDeviceSize m_used;
+
+		uint64_t m_firstLevelBitmap;
+		std::vector<uint32_t> m_secondLevelBitmaps;
+		std::vector<uint32_t> m_freeHeads;
+	public:
+		/// <summary>
+		/// Allocates a new block of device memory.
+		/// </summary>
+		/// <param name="logicalDevice"> The device to allocate from. </param>
+		/// <param name="memoryType"> The memory type index. </param>
+		/// <param name="size"> The size of the block. </param>
+		/// <param name="mapped"> If the memory is host visible and should stay mapped for the life of the block. </param>
+		MemoryBlock(const VkDevice &logicalDevice, const uint32_t &memoryType, const VkDeviceSize &size, const bool &mapped);
+
+		~MemoryBlock();
+
+		MemoryBlock(const MemoryBlock&) = delete;
+
+		MemoryBlock& operator=(const MemoryBlock&) = delete;
+
+		/// <summary>
+		/// Takes a range from the block.
+		/// </summary>
+		/// <param name="size"> The size of the range. </param>
+		/// <param name="alignment"> The alignment of the start of the range, a power of two. </param>
+		/// <param name="offset"> The offset of the range in the block. </param>
+		/// <returns> If the block had room for the range. </returns>
+		bool Allocate(const VkDeviceSize &size, const VkDeviceSize &alignment, VkDeviceSize &offset);
+
+		/// <summary>
+		/// Gives a range back to the block, it is merged with any free neighbours.
+		/// </summary>
+		/// <param name="offset"> The offset returned when the range was allocated. </param>
+		void Free(const VkDeviceSize &offset);
+
+		VkDeviceMemory GetMemory() const { return m_memory; }
+
+		VkDeviceSize GetSize() const { return m_size; }
+
+		char *GetMapped() const { return m_mapped; }
+
+		VkDeviceSize GetUsed() const { return m_used; }
+
+		uint32_t GetAllocationCount() const { return static_cast<uint32_t>(m_allocated.size()); }
+
+		bool IsEmpty() const { return m_allocated.empty(); }
+
+		/// <summary>
+		/// Gets the size of the largest free range, the largest allocation that would fit without alignment.
+		/// </summary>
+		/// <returns> The largest free range. </returns>
+		VkDeviceSize GetLargestFree() const;
+	private:
+		uint32_t FindFree(uint32_t firstLevel, uint32_t secondLevel) const;
+
+		void InsertFree(const uint32_t &index);
+
+		void RemoveFree(const uint32_t &index);
+
+		uint32_t CreateRange();
+
+		void ReleaseRange(const uint32_t &index);
+	};
+}
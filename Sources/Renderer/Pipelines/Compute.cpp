@@ -41,6 +41,7 @@ namespace acid
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 
 		Display::CheckVk(vkDeviceWaitIdle(logicalDevice));
+		Renderer::RunDeferred();
 
 		vkDestroyShaderModule(logicalDevice, m_shaderModule, nullptr);
 
@@ -119,7 +120,10 @@ namespace acid
 
 		for (auto &type : m_shaderProgram->GetDescriptors())
 		{
-			poolSizes.emplace_back(type.GetPoolSize());
+			// Sized so every set the pool can hold can use each descriptor.
+			auto poolSize = type.GetPoolSize();
+			poolSize.descriptorCount *= 256 * Renderer::MAX_FRAMES_IN_FLIGHT;
+			poolSizes.emplace_back(poolSize);
 		}
 
 		VkDescriptorPoolCreateInfo descriptorPoolCreateInfo = {};
@@ -127,7 +131,7 @@ namespace acid
 		descriptorPoolCreateInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
 		descriptorPoolCreateInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
 		descriptorPoolCreateInfo.pPoolSizes = poolSizes.data();
-		descriptorPoolCreateInfo.maxSets = 256; // Arbitrary number.
+		descriptorPoolCreateInfo.maxSets = 256 * Renderer::MAX_FRAMES_IN_FLIGHT; // Arbitrary number.
 
 		Display::CheckVk(vkCreateDescriptorPool(logicalDevice, &descriptorPoolCreateInfo, nullptr, &m_descriptorPool));
 	}
@@ -74,6 +74,7 @@ namespace acid
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 
 		Display::CheckVk(vkDeviceWaitIdle(logicalDevice));
+		Renderer::RunDeferred();
 
 		for (auto &shaderModule : m_modules)
 		{
@@ -173,7 +174,10 @@ namespace acid
 
 		for (auto &type : m_shaderProgram->GetDescriptors())
 		{
-			poolSizes.emplace_back(type.GetPoolSize());
+			// Sized so every set the pool can hold can use each descriptor.
+			auto poolSize = type.GetPoolSize();
+			poolSize.descriptorCount *= 1024 * Renderer::MAX_FRAMES_IN_FLIGHT;
+			poolSizes.emplace_back(poolSize);
 		}
 
 		VkDescriptorPoolCreateInfo descriptorPoolCreateInfo = {};
@@ -181,7 +185,7 @@ namespace acid
 		descriptorPoolCreateInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
 		descriptorPoolCreateInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
 		descriptorPoolCreateInfo.pPoolSizes = poolSizes.data();
-		descriptorPoolCreateInfo.maxSets = 1024; // TODO: Arbitrary number.
+		descriptorPoolCreateInfo.maxSets = 1024 * Renderer::MAX_FRAMES_IN_FLIGHT; // TODO: Arbitrary number.
 
 		Display::CheckVk(vkCreateDescriptorPool(logicalDevice, &descriptorPoolCreateInfo, nullptr, &m_descriptorPool));
 	}
@@ -1,25 +1,62 @@
 #include "Renderer.hpp"
 
 #include <cassert>
+#include "Buffers/Buffer.hpp"
+#include "Commands/UploadQueue.hpp"
+#include "Memory/MemoryAllocator.hpp"
 #include "Helpers/FileSystem.hpp"
 #include "Scenes/Scenes.hpp"
 #include "IRenderer.hpp"
 
 namespace acid
 {
+	const uint32_t Renderer::MAX_FRAMES_IN_FLIGHT = 2;
+
+	/// Uploads still being recorded may write to what is about to be destroyed, so they are submitted and waited on first.
+	static void WaitUploads()
+	{
+		auto display = Engine::Get() != nullptr ? Display::Get() : nullptr;
+
+		if (display != nullptr && display->GetUploadQueue() != nullptr)
+		{
+			display->GetUploadQueue()->WaitIdle();
+		}
+	}
+
+	static void CmdSetViewport(VkCommandBuffer commandBuffer, const RenderStage &renderStage)
+	{
+		VkViewport viewport = {};
+		viewport.x = 0.0f;
+		viewport.y = 0.0f;
+		viewport.width = static_cast<float>(renderStage.GetWidth());
+		viewport.height = static_cast<float>(renderStage.GetHeight());
+		viewport.minDepth = 0.0f;
+		viewport.maxDepth = 1.0f;
+		vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+
+		VkRect2D scissor = {};
+		scissor.offset.x = 0;
+		scissor.offset.y = 0;
+		scissor.extent.width = renderStage.GetWidth();
+		scissor.extent.height = renderStage.GetHeight();
+		vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+	}
+
 	Renderer::Renderer() :
 		m_managerRender(nullptr),
 		m_rendererRegister(RendererRegister()),
 		m_renderStages(std::vector<std::unique_ptr<RenderStage>>()),
 		m_swapchain(nullptr),
-		m_fenceSwapchainImage(VK_NULL_HANDLE),
 		m_activeSwapchainImage(UINT32_MAX),
+		m_imagesInFlight(std::vector<VkFence>()),
 		m_pipelineCache(VK_NULL_HANDLE),
-		m_semaphore(VK_NULL_HANDLE),
 		m_commandPool(VK_NULL_HANDLE),
-		m_commandBuffer(nullptr)
+		m_frames(std::vector<std::unique_ptr<FrameContext>>()),
+		m_frameIndex(0),
+		m_submitSerial(0),
+		m_deferred(std::deque<std::pair<uint64_t, std::function<void()>>>()),
+		m_readbacks(std::vector<ReadbackCallback>())
 	{
-		CreateFences();
 		CreateCommandPool();
 		CreatePipelineCache();
 	}
@@ -27,14 +64,15 @@ namespace acid
 	Renderer::~Renderer()
 	{
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
-		auto graphicsQueue = Display::Get()->GetGraphicsQueue();
 
-		Display::CheckVk(vkQueueWaitIdle(graphicsQueue));
+		Display::CheckVk(vkDeviceWaitIdle(logicalDevice));
 
-		vkDestroyPipelineCache(logicalDevice, m_pipelineCache, nullptr);
+		// Without frames anything destroyed after this is destroyed straight away.
+		WaitUploads();
+		RunDeferred(std::numeric_limits<uint64_t>::max());
+		m_frames.clear();
 
-		vkDestroyFence(logicalDevice, m_fenceSwapchainImage, nullptr);
-		vkDestroySemaphore(logicalDevice, m_semaphore, nullptr);
+		vkDestroyPipelineCache(logicalDevice, m_pipelineCache, nullptr);
 		vkDestroyCommandPool(logicalDevice, m_commandPool, nullptr);
 	}
 
@@ -64,11 +102,34 @@ namespace acid
 			return;
 		}
 
+		// Waits for the GPU to finish the last use of this frame, usually long done, rather than for the whole queue.
+		auto &frame = m_frames[m_frameIndex];
+		frame->Wait();
+		RunDeferred(frame->GetSerial());
+		frame->GetCommandBuffer()->Begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+
 		std::optional<uint32_t> renderpass = {};
 		uint32_t subpass = 0;
+		VkSubpassContents subpassContents = VK_SUBPASS_CONTENTS_INLINE;
+		std::vector<uint32_t> jobCounts;
 
 		for (auto &[key, renderers] : stages)
 		{
+			// Renderers split their work before the subpass starts, as a subpass is either recorded inline or from secondary command buffers.
+			jobCounts.assign(renderers.size(), 0);
+			bool hasJobs = false;
+
+			for (std::size_t i = 0; i < renderers.size(); i++)
+			{
+				if (renderers[i]->IsEnabled())
+				{
+					jobCounts[i] = renderers[i]->PrepareJobs(clipPlane, *camera);
+					hasJobs |= jobCounts[i] != 0;
+				}
+			}
+
+			VkSubpassContents contents = hasJobs ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE;
+
 			if (renderpass != key.GetRenderpass())
 			{
 				// Ends the previous renderpass.
@@ -81,10 +142,13 @@ namespace acid
 				subpass = 0;
 
 				// Starts the next renderpass.
-				auto startResult = StartRenderpass(*renderpass);
+				subpassContents = key.GetSubpass() == 0 ? contents : VK_SUBPASS_CONTENTS_INLINE;
+				auto startResult = StartRenderpass(*renderpass, subpassContents);
 
 				if (!startResult)
 				{
+					// The frame is dropped, its fence is left signalled so the next use does not wait.
+					frame->GetCommandBuffer()->End();
 					return;
 				}
 			}
@@ -103,26 +167,50 @@ namespace acid
 
 				for (uint32_t d = 0; d < difference; d++)
 				{
-					Renderer::Get()->NextSubpass();
+					// Skipped subpasses are left empty.
+					subpassContents = d == difference - 1 ? contents : VK_SUBPASS_CONTENTS_INLINE;
+					NextSubpass(subpassContents);
 				}
 
 				subpass = key.GetSubpass();
 			}
 
+			if (subpassContents == VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS)
+			{
+				RecordSecondary(*renderStage, subpass, renderers, jobCounts, clipPlane, *camera);
+				continue;
+			}
+
 			// Renders subpass renderers.
-			for (auto &renderer : renderers)
+			for (std::size_t i = 0; i < renderers.size(); i++)
 			{
-				if (!renderer->IsEnabled())
+				if (!renderers[i]->IsEnabled())
+				{
+					continue;
+				}
+
+				if (jobCounts[i] == 0)
 				{
+					renderers[i]->Render(*frame->GetCommandBuffer(), clipPlane, *camera);
 					continue;
 				}
 
-				renderer->Render(*m_commandBuffer, clipPlane, *camera);
+				// A subpass that could not be started for secondary command buffers still records every job, in order.
+				for (uint32_t job = 0; job < jobCounts[i]; job++)
+				{
+					renderers[i]->RenderJob(*frame->GetCommandBuffer(), job);
+				}
 			}
 		}
 
 		// Ends the last renderpass.
 		EndRenderpass(*renderpass);
+
+		// Without a swapchain stage nothing is presented, but the frame is still submitted.
+		if (frame->GetCommandBuffer()->IsRunning())
+		{
+			SubmitFrame(false);
+		}
 	}
 
 	void Renderer::CreateRenderpass(const std::vector<RenderpassCreate> &renderpassCreates)
@@ -137,6 +225,7 @@ namespace acid
 
 		m_renderStages.clear();
 		m_swapchain = std::make_unique<Swapchain>(displayExtent);
+		m_imagesInFlight = std::vector<VkFence>(m_swapchain->GetImageCount(), VK_NULL_HANDLE);
 
 		for (auto &renderpassCreate : renderpassCreates)
 		{
@@ -166,9 +255,12 @@ namespace acid
 
 		Log::Out("Saving screenshot to: '%s'\n", filename.c_str());
 
+		// The last frame may still be drawing into the image.
+		Display::CheckVk(vkDeviceWaitIdle(logicalDevice));
+
 		VkImage srcImage = Renderer::Get()->GetSwapchain()->GetImages().at(Renderer::Get()->GetActiveSwapchainImage());
 		VkImage dstImage;
-		VkDeviceMemory dstImageMemory;
+		MemoryAllocation dstImageMemory;
 		bool supportsBlit = Texture::CopyImage(srcImage, dstImage, dstImageMemory, width, height, true, 0, 1);
 
 		// Get layout of the image (including row pitch).
@@ -181,10 +273,8 @@ namespace acid
 		// Creates the screenshot image file.
 		FileSystem::Create(filename);
 
-		// Map image memory so we can start copying from it.
-		char *data;
-		vkMapMemory(logicalDevice, dstImageMemory, 0, VK_WHOLE_SIZE, 0, (void **) &data);
-		data += subResourceLayout.offset;
+		// The image memory stays mapped, so copying starts straight from it.
+		char *data = dstImageMemory.m_mapped + subResourceLayout.offset;
 
 		// If source is BGR (destination is always RGB) and we can't use blit (which does automatic conversion), we'll have to manually swizzle color components
 		bool colourSwizzle = false;
@@ -219,9 +309,8 @@ namespace acid
 		Texture::WritePixels(filename, pixels.get(), width, height, 4);
 
 		// Clean up resources.
-		vkUnmapMemory(logicalDevice, dstImageMemory);
-		vkFreeMemory(logicalDevice, dstImageMemory, nullptr);
 		vkDestroyImage(logicalDevice, dstImage, nullptr);
+		Display::Get()->GetMemoryAllocator()->Free(dstImageMemory);
 
 #if defined(ACID_VERBOSE)
 		auto debugEnd = Engine::GetTime();
@@ -229,6 +318,23 @@ namespace acid
 #endif
 	}
 
+	void Renderer::CaptureScreenshotAsync(const std::string &filename)
+	{
+		Log::Out("Saving screenshot to: '%s'\n", filename.c_str());
+
+		ReadbackFrame([filename](const uint8_t *pixels, const uint32_t &width, const uint32_t &height)
+		{
+			// Encoding the image is slow, so it is written from a copy on a worker thread.
+			auto copy = std::make_shared<std::vector<uint8_t>>(pixels, pixels + width * height * 4);
+
+			Engine::Get()->GetThreadPool()->Schedule([filename, copy, width, height]()
+			{
+				FileSystem::Create(filename);
+				Texture::WritePixels(filename, copy->data(), width, height, 4);
+			});
+		});
+	}
+
 	RenderStage *Renderer::GetRenderStage(const uint32_t &index) const
 	{
 		if (m_renderStages.empty() || m_renderStages.size() < index)
@@ -254,23 +360,59 @@ namespace acid
 		return nullptr;
 	}
 
-	void Renderer::CreateFences()
+	void Renderer::Defer(std::function<void()> &&function)
 	{
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
+		auto renderer = Engine::Get() != nullptr ? Renderer::Get() : nullptr;
+
+		if (renderer == nullptr || renderer->m_frames.empty())
+		{
+			WaitUploads();
+			function();
+			return;
+		}
 
-		VkFenceCreateInfo fenceCreateInfo = {};
-		fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-		vkCreateFence(logicalDevice, &fenceCreateInfo, nullptr, &m_fenceSwapchainImage);
+		// The next submission may still use what is being destroyed, and every submission before it finishes first.
+		std::lock_guard<std::mutex> lock(renderer->m_deferredMutex);
+		renderer->m_deferred.emplace_back(renderer->m_submitSerial + 1, std::move(function));
 	}
 
-	void Renderer::CreateCommandPool()
+	void Renderer::RunDeferred()
 	{
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
+		auto renderer = Engine::Get() != nullptr ? Renderer::Get() : nullptr;
+
+		if (renderer == nullptr)
+		{
+			return;
+		}
+
+		WaitUploads();
+		renderer->RunDeferred(std::numeric_limits<uint64_t>::max());
+	}
+
+	void Renderer::RunDeferred(const uint64_t &completedSerial)
+	{
+		// Functions may defer more work, which waits for a later submission.
+		std::vector<std::function<void()>> deferred;
 
-		VkSemaphoreCreateInfo semaphoreCreateInfo = {};
-		semaphoreCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+		{
+			std::lock_guard<std::mutex> lock(m_deferredMutex);
 
-		Display::CheckVk(vkCreateSemaphore(logicalDevice, &semaphoreCreateInfo, nullptr, &m_semaphore));
+			while (!m_deferred.empty() && m_deferred.front().first <= completedSerial)
+			{
+				deferred.emplace_back(std::move(m_deferred.front().second));
+				m_deferred.pop_front();
+			}
+		}
+
+		for (auto &function : deferred)
+		{
+			function();
+		}
+	}
+
+	void Renderer::CreateCommandPool()
+	{
+		auto logicalDevice = Display::Get()->GetLogicalDevice();
 
 		VkCommandPoolCreateInfo commandPoolCreateInfo = {};
 		commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
@@ -279,7 +421,13 @@ namespace acid
 
 		Display::CheckVk(vkCreateCommandPool(logicalDevice, &commandPoolCreateInfo, nullptr, &m_commandPool));
 
-		m_commandBuffer = std::make_unique<CommandBuffer>(false);
+		// Every worker and the thread recording the frame gets its own pools for secondary command buffers.
+		uint32_t threadCount = Engine::Get()->GetThreadPool()->GetThreadCount() + 1;
+
+		for (uint32_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++)
+		{
+			m_frames.emplace_back(std::make_unique<FrameContext>(threadCount));
+		}
 	}
 
 	void Renderer::CreatePipelineCache()
@@ -294,12 +442,13 @@ namespace acid
 
 	void Renderer::RecreatePass(const uint32_t &i)
 	{
-		auto graphicsQueue = Display::Get()->GetGraphicsQueue();
+		auto logicalDevice = Display::Get()->GetLogicalDevice();
 		auto renderStage = GetRenderStage(i);
 
 		VkExtent2D displayExtent = {Display::Get()->GetWidth(), Display::Get()->GetHeight()};
 
-		Display::CheckVk(vkQueueWaitIdle(graphicsQueue));
+		// Recreating is rare, so every frame in flight is simply waited for.
+		Display::CheckVk(vkDeviceWaitIdle(logicalDevice));
 
 		if (renderStage->HasSwapchain() && !m_swapchain->IsSameExtent(displayExtent))
 		{
@@ -307,12 +456,13 @@ namespace acid
 			Log::Out("Resizing swapchain: Old (%i, %i), New (%i, %i)\n", m_swapchain->GetExtent().width, m_swapchain->GetExtent().height, displayExtent.width, displayExtent.height);
 #endif
 			m_swapchain = std::make_unique<Swapchain>(displayExtent);
+			m_imagesInFlight = std::vector<VkFence>(m_swapchain->GetImageCount(), VK_NULL_HANDLE);
 		}
 
 		renderStage->Rebuild(*m_swapchain);
 	}
 
-	bool Renderer::StartRenderpass(const uint32_t &i)
+	bool Renderer::StartRenderpass(const uint32_t &i, const VkSubpassContents &contents)
 	{
 		auto renderStage = GetRenderStage(i);
 
@@ -323,13 +473,17 @@ namespace acid
 		}
 
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
-		auto graphicsQueue = Display::Get()->GetGraphicsQueue();
+		auto &frame = m_frames[m_frameIndex];
+		auto commandBuffer = frame->GetCommandBuffer()->GetCommandBuffer();
 
-		Display::CheckVk(vkQueueWaitIdle(graphicsQueue));
-
-		if (renderStage->HasSwapchain())
+		if (renderStage->HasSwapchain() && m_swapchain->IsHeadless())
+		{
+			// Offscreen images are used in turn, there is nothing to acquire them from.
+			m_activeSwapchainImage = (m_activeSwapchainImage + 1) % m_swapchain->GetImageCount();
+		}
+		else if (renderStage->HasSwapchain())
 		{
-			VkResult acquireResult = vkAcquireNextImageKHR(logicalDevice, *m_swapchain->GetSwapchain(), std::numeric_limits<uint64_t>::max(), VK_NULL_HANDLE, m_fenceSwapchainImage, &m_activeSwapchainImage);
+			VkResult acquireResult = vkAcquireNextImageKHR(logicalDevice, *m_swapchain->GetSwapchain(), std::numeric_limits<uint64_t>::max(), frame->GetImageAvailable(), VK_NULL_HANDLE, &m_activeSwapchainImage);
 
 			if (acquireResult == VK_ERROR_OUT_OF_DATE_KHR)
 			{
@@ -341,15 +495,19 @@ namespace acid
 			{
 				assert(false && "Renderer failed to acquire swapchain image!");
 			}
-
-			Display::CheckVk(vkWaitForFences(logicalDevice, 1, &m_fenceSwapchainImage, VK_TRUE, std::numeric_limits<uint64_t>::max()));
-
-			Display::CheckVk(vkResetFences(logicalDevice, 1, &m_fenceSwapchainImage));
 		}
 
-		if (!m_commandBuffer->IsRunning())
+		if (renderStage->HasSwapchain())
 		{
-			m_commandBuffer->Begin(VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT);
+			// Images can come back out of order, or there can be fewer images than frames, so the image may still be drawn to by another frame.
+			VkFence imageInFlight = m_imagesInFlight[m_activeSwapchainImage];
+
+			if (imageInFlight != VK_NULL_HANDLE && imageInFlight != frame->GetFence())
+			{
+				Display::CheckVk(vkWaitForFences(logicalDevice, 1, &imageInFlight, VK_TRUE, std::numeric_limits<uint64_t>::max()));
+			}
+
+			m_imagesInFlight[m_activeSwapchainImage] = frame->GetFence();
 		}
 
 		VkRect2D renderArea = {};
@@ -368,23 +526,13 @@ namespace acid
 		renderPassBeginInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
 		renderPassBeginInfo.pClearValues = clearValues.data();
 
-		vkCmdBeginRenderPass(m_commandBuffer->GetCommandBuffer(), &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
+		vkCmdBeginRenderPass(commandBuffer, &renderPassBeginInfo, contents);
 
-		VkViewport viewport = {};
-		viewport.x = 0.0f;
-		viewport.y = 0.0f;
-		viewport.width = static_cast<float>(renderStage->GetWidth());
-		viewport.height = static_cast<float>(renderStage->GetHeight());
-		viewport.minDepth = 0.0f;
-		viewport.maxDepth = 1.0f;
-		vkCmdSetViewport(m_commandBuffer->GetCommandBuffer(), 0, 1, &viewport);
-
-		VkRect2D scissor = {};
-		scissor.offset.x = 0;
-		scissor.offset.y = 0;
-		scissor.extent.width = renderStage->GetWidth();
-		scissor.extent.height = renderStage->GetHeight();
-		vkCmdSetScissor(m_commandBuffer->GetCommandBuffer(), 0, 1, &scissor);
+		// Only commands from secondary buffers may be recorded in a subpass started for them, they set their own viewport.
+		if (contents == VK_SUBPASS_CONTENTS_INLINE)
+		{
+			CmdSetViewport(commandBuffer, *renderStage);
+		}
 
 		return true;
 	}
@@ -393,18 +541,29 @@ namespace acid
 	{
 		auto renderStage = GetRenderStage(i);
 		auto presentQueue = Display::Get()->GetPresentQueue();
+		auto &frame = m_frames[m_frameIndex];
 
-		vkCmdEndRenderPass(m_commandBuffer->GetCommandBuffer());
+		vkCmdEndRenderPass(frame->GetCommandBuffer()->GetCommandBuffer());
 
 		if (!renderStage->HasSwapchain())
 		{
 			return;
 		}
 
-		m_commandBuffer->End();
-		m_commandBuffer->Submit(m_semaphore, VK_NULL_HANDLE, false);
+		if (!m_readbacks.empty())
+		{
+			RecordReadbacks();
+		}
+
+		if (m_swapchain->IsHeadless())
+		{
+			SubmitFrame(false);
+			return;
+		}
+
+		SubmitFrame(true);
 
-		std::vector<VkSemaphore> waitSemaphores = {m_semaphore};
+		std::vector<VkSemaphore> waitSemaphores = {frame->GetRenderFinished()};
 
 		VkResult presentResult = VK_RESULT_MAX_ENUM;
 
@@ -417,7 +576,12 @@ namespace acid
 		presentInfo.pImageIndices = &m_activeSwapchainImage;
 		presentInfo.pResults = &presentResult;
 
-		VkResult queuePresentResult = vkQueuePresentKHR(presentQueue, &presentInfo);
+		VkResult queuePresentResult;
+
+		{
+			std::lock_guard<std::mutex> lock(Display::Get()->GetQueueMutex());
+			queuePresentResult = vkQueuePresentKHR(presentQueue, &presentInfo);
+		}
 
 		if (queuePresentResult == VK_ERROR_OUT_OF_DATE_KHR || queuePresentResult == VK_SUBOPTIMAL_KHR)
 		{
@@ -426,11 +590,225 @@ namespace acid
 		}
 
 		Display::CheckVk(presentResult);
-		Display::CheckVk(vkQueueWaitIdle(presentQueue));
 	}
 
-	void Renderer::NextSubpass()
+	void Renderer::SubmitFrame(const bool &present)
+	{
+		auto logicalDevice = Display::Get()->GetLogicalDevice();
+		auto &frame = m_frames[m_frameIndex];
+		auto commandBuffer = frame->GetCommandBuffer();
+		VkFence fence = frame->GetFence();
+
+		commandBuffer->End();
+
+		// Counted before the uploads are submitted, so a deferral tagged with this frame comes after any upload recorded before it, and that upload is in the batch below.
+		{
+			std::lock_guard<std::mutex> lock(m_deferredMutex);
+			frame->SetSerial(++m_submitSerial);
+		}
+
+		// Uploads recorded so far are submitted first, the frame then reads them in queue order without the CPU waiting on them.
+		// The frame's fence also covers them, so deferrals waiting on this frame wait on these uploads too.
+		Display::Get()->GetUploadQueue()->Submit();
+
+		// Only reset once a submission will signal it again, a dropped frame leaves its fence signalled.
+		Display::CheckVk(vkResetFences(logicalDevice, 1, &fence));
+
+		if (present)
+		{
+			commandBuffer->SubmitAsync(frame->GetImageAvailable(), VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, frame->GetRenderFinished(), fence);
+		}
+		else
+		{
+			commandBuffer->SubmitAsync(VK_NULL_HANDLE, 0, VK_NULL_HANDLE, fence);
+		}
+
+		// The CPU moves on to the next frame while the GPU works on this one.
+		m_frameIndex = (m_frameIndex + 1) % MAX_FRAMES_IN_FLIGHT;
+	}
+
+	void Renderer::NextSubpass(const VkSubpassContents &contents)
+	{
+		vkCmdNextSubpass(GetCommandBuffer()->GetCommandBuffer(), contents);
+	}
+
+	void Renderer::RecordSecondary(const RenderStage &renderStage, const uint32_t &subpass, const std::vector<std::unique_ptr<IRenderer>> &renderers,
+		const std::vector<uint32_t> &jobCounts, const Vector4 &clipPlane, const ICamera &camera)
+	{
+		auto threadPool = Engine::Get()->GetThreadPool();
+
+		VkCommandBufferInheritanceInfo inheritanceInfo = {};
+		inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+		inheritanceInfo.renderPass = renderStage.GetRenderpass()->GetRenderpass();
+		inheritanceInfo.subpass = subpass;
+		inheritanceInfo.framebuffer = renderStage.GetActiveFramebuffer(m_activeSwapchainImage);
+
+		// Each renderer gets a slot for every job, or one slot if it is recorded on this thread, so buffers are executed in renderer order.
+		std::vector<CommandBuffer *> commandBuffers;
+		auto root = threadPool->CreateJob(nullptr);
+
+		for (std::size_t i = 0; i < renderers.size(); i++)
+		{
+			if (!renderers[i]->IsEnabled())
+			{
+				continue;
+			}
+
+			if (jobCounts[i] == 0)
+			{
+				commandBuffers.emplace_back(nullptr);
+				continue;
+			}
+
+			for (uint32_t job = 0; job < jobCounts[i]; job++)
+			{
+				commandBuffers.emplace_back(nullptr);
+				auto renderer = renderers[i].get();
+				auto slot = commandBuffers.size() - 1;
+				threadPool->Schedule([this, &inheritanceInfo, &renderStage, &commandBuffers, renderer, slot, job]()
+				{
+					auto commandBuffer = BeginSecondary(inheritanceInfo, renderStage);
+					renderer->RenderJob(*commandBuffer, job);
+					commandBuffer->End();
+					commandBuffers[slot] = commandBuffer;
+				}, root);
+			}
+		}
+
+		// The slots are all added before any job runs, so the vector is not resized while jobs write to it.
+		threadPool->Run(root);
+
+		// Renderers without jobs are recorded here while the workers record the rest.
+		std::size_t slot = 0;
+
+		for (std::size_t i = 0; i < renderers.size(); i++)
+		{
+			if (!renderers[i]->IsEnabled())
+			{
+				continue;
+			}
+
+			if (jobCounts[i] != 0)
+			{
+				slot += jobCounts[i];
+				continue;
+			}
+
+			auto commandBuffer = BeginSecondary(inheritanceInfo, renderStage);
+			renderers[i]->Render(*commandBuffer, clipPlane, camera);
+			commandBuffer->End();
+			commandBuffers[slot++] = commandBuffer;
+		}
+
+		threadPool->Wait(root);
+
+		std::vector<VkCommandBuffer> secondaryBuffers;
+		secondaryBuffers.reserve(commandBuffers.size());
+
+		for (auto &commandBuffer : commandBuffers)
+		{
+			secondaryBuffers.emplace_back(commandBuffer->GetCommandBuffer());
+		}
+
+		vkCmdExecuteCommands(GetCommandBuffer()->GetCommandBuffer(), static_cast<uint32_t>(secondaryBuffers.size()), secondaryBuffers.data());
+	}
+
+	CommandBuffer *Renderer::BeginSecondary(const VkCommandBufferInheritanceInfo &inheritanceInfo, const RenderStage &renderStage)
+	{
+		// Threads outside of the pool, the one recording the frame, use the pool after the workers.
+		auto threadPool = Engine::Get()->GetThreadPool();
+		int32_t workerIndex = threadPool->GetWorkerIndex();
+		uint32_t thread = workerIndex != -1 ? static_cast<uint32_t>(workerIndex) : threadPool->GetThreadCount();
+
+		auto commandBuffer = m_frames[m_frameIndex]->AcquireSecondary(thread);
+		commandBuffer->Begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT, &inheritanceInfo);
+
+		// Dynamic state is not inherited from the primary buffer.
+		CmdSetViewport(commandBuffer->GetCommandBuffer(), renderStage);
+		return commandBuffer;
+	}
+
+	void Renderer::RecordReadbacks()
 	{
-		vkCmdNextSubpass(m_commandBuffer->GetCommandBuffer(), VK_SUBPASS_CONTENTS_INLINE);
+		auto surfaceFormat = Display::Get()->GetSurfaceFormat();
+		auto commandBuffer = GetCommandBuffer()->GetCommandBuffer();
+		VkImage image = m_swapchain->GetImages().at(m_activeSwapchainImage);
+		VkExtent2D extent = m_swapchain->GetExtent();
+		VkImageLayout presentLayout = Swapchain::GetPresentLayout();
+
+		// The copy is part of the frame, so nothing waits on the GPU until the frame's fence is next waited on.
+		auto buffer = std::make_shared<Buffer>(static_cast<VkDeviceSize>(extent.width) * extent.height * 4, VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+		VkImageSubresourceRange subresourceRange = {};
+		subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		subresourceRange.baseMipLevel = 0;
+		subresourceRange.levelCount = 1;
+		subresourceRange.baseArrayLayer = 0;
+		subresourceRange.layerCount = 1;
+
+		Texture::InsertImageMemoryBarrier(commandBuffer, image, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, presentLayout,
+			VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, subresourceRange);
+
+		VkBufferImageCopy region = {};
+		region.bufferOffset = 0;
+		region.bufferRowLength = 0;
+		region.bufferImageHeight = 0;
+		region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		region.imageSubresource.mipLevel = 0;
+		region.imageSubresource.baseArrayLayer = 0;
+		region.imageSubresource.layerCount = 1;
+		region.imageOffset = {0, 0, 0};
+		region.imageExtent = {extent.width, extent.height, 1};
+		vkCmdCopyImageToBuffer(commandBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, buffer->GetBuffer(), 1, &region);
+
+		Texture::InsertImageMemoryBarrier(commandBuffer, image, VK_ACCESS_TRANSFER_READ_BIT, 0, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+			presentLayout, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, subresourceRange);
+
+		VkBufferMemoryBarrier bufferMemoryBarrier = {};
+		bufferMemoryBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+		bufferMemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		bufferMemoryBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+		bufferMemoryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		bufferMemoryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		bufferMemoryBarrier.buffer = buffer->GetBuffer();
+		bufferMemoryBarrier.offset = 0;
+		bufferMemoryBarrier.size = VK_WHOLE_SIZE;
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &bufferMemoryBarrier, 0, nullptr);
+
+		// Copying an image to a buffer does not convert formats, so BGR surfaces are swizzled on the host.
+		std::vector<VkFormat> formatsBGR = {VK_FORMAT_B8G8R8A8_SRGB, VK_FORMAT_B8G8R8A8_UNORM, VK_FORMAT_B8G8R8A8_SNORM};
+		bool colourSwizzle = std::find(formatsBGR.begin(), formatsBGR.end(), surfaceFormat.format) != formatsBGR.end();
+
+		Defer([buffer, extent, colourSwizzle, callbacks = std::move(m_readbacks)]()
+		{
+			void *data;
+			buffer->MapMemory(&data);
+			auto source = static_cast<const uint8_t *>(data);
+
+			std::vector<uint8_t> pixels(static_cast<std::size_t>(buffer->GetSize()));
+
+			if (colourSwizzle)
+			{
+				for (std::size_t i = 0; i < pixels.size(); i += 4)
+				{
+					pixels[i] = source[i + 2];
+					pixels[i + 1] = source[i + 1];
+					pixels[i + 2] = source[i];
+					pixels[i + 3] = source[i + 3];
+				}
+			}
+			else
+			{
+				std::memcpy(pixels.data(), source, pixels.size());
+			}
+
+			for (auto &callback : callbacks)
+			{
+				callback(pixels.data(), extent.width, extent.height);
+			}
+		});
+
+		m_readbacks.clear();
 	}
 }
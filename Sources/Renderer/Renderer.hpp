@@ -1,8 +1,11 @@
 #pragma once
 
+#include <deque>
+#include <mutex>
 #include <vulkan/vulkan.h>
 #include "Engine/Engine.hpp"
 #include "Commands/CommandBuffer.hpp"
+#include "Commands/FrameContext.hpp"
 #include "Swapchain/DepthStencil.hpp"
 #include "Swapchain/Swapchain.hpp"
 #include "IManagerRender.hpp"
@@ -11,6 +14,11 @@
 
 namespace acid
 {
+	/// <summary>
+	/// Receives the pixels of a frame read back from the swapchain, as tightly packed RGBA bytes that are only valid during the call.
+	/// </summary>
+	typedef std::function<void(const uint8_t *pixels, const uint32_t &width, const uint32_t &height)> ReadbackCallback;
+
 	class ACID_EXPORT Renderer :
 		public IModule
 	{
@@ -22,16 +30,30 @@ namespace acid
 		std::vector<std::unique_ptr<RenderStage>> m_renderStages;
 
 		std::unique_ptr<Swapchain> m_swapchain;
-		VkFence m_fenceSwapchainImage;
 		uint32_t m_activeSwapchainImage;
+		/// The fence of the frame last drawn to each swapchain image, so an image is not drawn to again while in use.
+		std::vector<VkFence> m_imagesInFlight;
 
 		VkPipelineCache m_pipelineCache;
 
-		VkSemaphore m_semaphore;
 		VkCommandPool m_commandPool;
 
-		std::unique_ptr<CommandBuffer> m_commandBuffer;
+		std::vector<std::unique_ptr<FrameContext>> m_frames;
+		uint32_t m_frameIndex;
+		/// The serial of the last frame submitted, frames are counted from 1.
+		uint64_t m_submitSerial;
+
+		/// Functions waiting on the GPU, each with the serial of the submission that has to finish first. Serials only grow, so the oldest are at the front.
+		std::deque<std::pair<uint64_t, std::function<void()>>> m_deferred;
+		std::mutex m_deferredMutex;
+
+		std::vector<ReadbackCallback> m_readbacks;
 	public:
+		/// <summary>
+		/// The number of frames the CPU may record ahead of the GPU.
+		/// </summary>
+		static const uint32_t MAX_FRAMES_IN_FLIGHT;
+
 		/// <summary>
 		/// Gets this engine instance.
 		/// </summary>
@@ -52,6 +74,18 @@ namespace acid
 		///	<param name="filename"> The file to save the screenshot to. </param>
 		void CaptureScreenshot(const std::string &filename);
 
+		/// <summary>
+		/// Takes a screenshot of the next frame without stalling the GPU, the image is written on a worker thread.
+		/// </summary>
+		///	<param name="filename"> The file to save the screenshot to. </param>
+		void CaptureScreenshotAsync(const std::string &filename);
+
+		/// <summary>
+		/// Copies the next frame out of the swapchain image as part of that frame, the callback runs on the main thread once the GPU has finished it.
+		/// </summary>
+		/// <param name="callback"> The function to receive the pixels. </param>
+		void ReadbackFrame(ReadbackCallback &&callback) { m_readbacks.emplace_back(std::move(callback)); }
+
 		/// <summary>
 		/// Gets the renderer manager.
 		/// </summary>
@@ -110,26 +144,65 @@ namespace acid
 
 		Swapchain *GetSwapchain() const { return m_swapchain.get(); }
 
+		/// <summary>
+		/// Gets the pool shared by one time command buffers, frames record from their own pools.
+		/// </summary>
+		/// <returns> The shared command pool. </returns>
 		VkCommandPool GetCommandPool() const { return m_commandPool; }
 
-		CommandBuffer *GetCommandBuffer() const { return m_commandBuffer.get(); }
+		/// <summary>
+		/// Gets the command buffer the current frame is recorded into.
+		/// </summary>
+		/// <returns> The frame command buffer. </returns>
+		CommandBuffer *GetCommandBuffer() const { return m_frames[m_frameIndex]->GetCommandBuffer(); }
+
+		/// <summary>
+		/// Gets the index of the frame being recorded, resources written every frame keep one copy per index.
+		/// </summary>
+		/// <returns> The frame index, below <seealso cref="#MAX_FRAMES_IN_FLIGHT"/>. </returns>
+		uint32_t GetFrameIndex() const { return m_frameIndex; }
+
+		/// <summary>
+		/// Runs a function once the GPU has finished every frame that may use what was recorded so far, used to destroy resources that can still be in flight.
+		/// It waits on the next frame to be submitted, which also covers a frame being recorded and every upload recorded so far, and runs once that frame's context is next waited on.
+		/// If there is no renderer the function runs straight away.
+		/// </summary>
+		/// <param name="function"> The function to run. </param>
+		static void Defer(std::function<void()> &&function);
+
+		/// <summary>
+		/// Runs every deferred function now, after waiting on the uploads still being recorded, only called once the device is idle.
+		/// </summary>
+		static void RunDeferred();
 
 		uint32_t GetActiveSwapchainImage() const { return m_activeSwapchainImage; }
 
 		VkPipelineCache GetPipelineCache() const { return m_pipelineCache; }
 	private:
-		void CreateFences();
-
 		void CreateCommandPool();
 
 		void CreatePipelineCache();
 
+		void RunDeferred(const uint64_t &completedSerial);
+
 		void RecreatePass(const uint32_t &i);
 
-		bool StartRenderpass(const uint32_t &i);
+		bool StartRenderpass(const uint32_t &i, const VkSubpassContents &contents);
 
 		void EndRenderpass(const uint32_t &i);
 
-		void NextSubpass();
+		void SubmitFrame(const bool &present);
+
+		void NextSubpass(const VkSubpassContents &contents);
+
+		/// <summary>
+		/// Records a subpass from secondary command buffers, renderer jobs are recorded on worker threads and the other renderers on this thread.
+		/// </summary>
+		void RecordSecondary(const RenderStage &renderStage, const uint32_t &subpass, const std::vector<std::unique_ptr<IRenderer>> &renderers,
+			const std::vector<uint32_t> &jobCounts, const Vector4 &clipPlane, const ICamera &camera);
+
+		CommandBuffer *BeginSecondary(const VkCommandBufferInheritanceInfo &inheritanceInfo, const RenderStage &renderStage);
+
+		void RecordReadbacks();
 	};
 }
@@ -2,6 +2,7 @@
 
 #include "Display/Display.hpp"
 #include "Renderer/Swapchain/DepthStencil.hpp"
+#include "Renderer/Swapchain/Swapchain.hpp"
 
 namespace acid
 {
@@ -37,7 +38,7 @@ namespace acid
 				attachment.format = depthStencil.GetFormat();
 				break;
 			case ATTACHMENT_TYPE_SWAPCHAIN:
-				attachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+				attachment.finalLayout = Swapchain::GetPresentLayout();
 				attachment.format = surfaceFormat;
 				break;
 			}
@@ -13,6 +13,7 @@ namespace acid
 		uint32_t m_width, m_height;
 
 		VkImage m_image;
+		MemoryAllocation m_imageMemory;
 		VkImageView m_imageView;
 		VkSampler m_sampler;
 		VkFormat m_format;
@@ -11,6 +11,7 @@ namespace acid
 		m_swapchainImageCount(0),
 		m_swapchainImages(std::vector<VkImage>()),
 		m_swapchainImageViews(std::vector<VkImageView>()),
+		m_offscreenMemories(std::vector<MemoryAllocation>()),
 		m_extent({})
 	{
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
@@ -23,6 +24,24 @@ namespace acid
 
 		m_extent = extent;
 
+		if (Display::Get()->IsHeadless())
+		{
+			// One image per frame in flight, so a frame never waits on an image another frame is drawing to.
+			m_swapchainImageCount = Renderer::MAX_FRAMES_IN_FLIGHT;
+			m_swapchainImages.resize(m_swapchainImageCount);
+			m_swapchainImageViews.resize(m_swapchainImageCount);
+			m_offscreenMemories.resize(m_swapchainImageCount);
+
+			for (uint32_t i = 0; i < m_swapchainImageCount; i++)
+			{
+				Texture::CreateImage(m_swapchainImages[i], m_offscreenMemories[i], extent.width, extent.height, VK_IMAGE_TYPE_2D, VK_SAMPLE_COUNT_1_BIT, 1, surfaceFormat.format,
+					VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 1);
+				Texture::CreateImageView(m_swapchainImages[i], m_swapchainImageViews[i], VK_IMAGE_VIEW_TYPE_2D, surfaceFormat.format, VK_IMAGE_ASPECT_COLOR_BIT, 1, 0, 1);
+			}
+
+			return;
+		}
+
 		uint32_t physicalPresentModeCount = 0;
 		vkGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, &physicalPresentModeCount, nullptr);
 		std::vector<VkPresentModeKHR> physicalPresentModes(physicalPresentModeCount);
@@ -112,6 +131,23 @@ namespace acid
 			vkDestroyImageView(logicalDevice, imageView, nullptr);
 		}
 
+		if (IsHeadless())
+		{
+			for (uint32_t i = 0; i < m_swapchainImageCount; i++)
+			{
+				vkDestroyImage(logicalDevice, m_swapchainImages[i], nullptr);
+				Display::Get()->GetMemoryAllocator()->Free(m_offscreenMemories[i]);
+			}
+
+			return;
+		}
+
 		vkDestroySwapchainKHR(logicalDevice, m_swapchain, nullptr);
 	}
+
+	VkImageLayout Swapchain::GetPresentLayout()
+	{
+		// The present layout only exists with the swapchain extension, which headless displays do not enable.
+		return Display::Get()->IsHeadless() ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+	}
 }
@@ -1,10 +1,14 @@
 ﻿#pragma once
 
 #include <vector>
+#include "Renderer/Memory/MemoryAllocator.hpp"
 #include "Renderer/Renderpass/RenderpassCreate.hpp"
 
 namespace acid
 {
+	/// <summary>
+	/// The images drawn to by swapchain attachments. With a headless display these are offscreen images handed out in turn, there is nothing to present to.
+	/// </summary>
 	class ACID_EXPORT Swapchain
 	{
 	private:
@@ -13,6 +17,7 @@ namespace acid
 		uint32_t m_swapchainImageCount;
 		std::vector<VkImage> m_swapchainImages;
 		std::vector<VkImageView> m_swapchainImageViews;
+		std::vector<MemoryAllocation> m_offscreenMemories;
 
 		VkExtent2D m_extent;
 	public:
@@ -31,5 +36,17 @@ namespace acid
 		VkExtent2D GetExtent() const { return m_extent; }
 
 		bool IsSameExtent(const VkExtent2D &extent2D) { return m_extent.width == extent2D.width && m_extent.height == extent2D.height; }
+
+		/// <summary>
+		/// Gets if the images are offscreen images rather than images of a presentable swapchain.
+		/// </summary>
+		/// <returns> If the swapchain is headless. </returns>
+		bool IsHeadless() const { return m_swapchain == VK_NULL_HANDLE; }
+
+		/// <summary>
+		/// Gets the layout swapchain images are left in once drawn, ready to be presented or, when headless, copied from.
+		/// </summary>
+		/// <returns> The layout of drawn images. </returns>
+		static VkImageLayout GetPresentLayout();
 	};
 }
@@ -1,85 +1,139 @@
 #include "Resources.hpp"
 
-#include <algorithm>
-
 namespace acid
 {
 	Resources::Resources() :
-		m_resources(std::vector<std::shared_ptr<IResource>>()),
+		m_shards(),
+		m_pendingLoads(0),
 		m_timerPurge(Timer(Time::Seconds(5.0f)))
 	{
 	}
 
+	Resources::~Resources()
+	{
+		auto threadPool = Engine::Get()->GetThreadPool();
+
+		// Loads still running call back into the shards, so they are finished before the shards are destroyed.
+		while (m_pendingLoads > 0)
+		{
+			if (!threadPool->RunPending())
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
 	void Resources::Update()
 	{
 		if (m_timerPurge.IsPassedTime())
 		{
 			m_timerPurge.ResetStartTime();
 
-			for (auto it = m_resources.begin(); it != m_resources.end();)
+			for (auto &shard : m_shards)
 			{
-				if ((*it).use_count() <= 1)
+				std::lock_guard<std::mutex> lock(shard.m_mutex);
+
+				for (auto it = shard.m_resources.begin(); it != shard.m_resources.end();)
 				{
+					if ((*it).second.use_count() <= 1)
+					{
 #if defined(ACID_VERBOSE)
-					Log::Out("Resource '%s' erased\n", (*it)->GetFilename().c_str());
+						Log::Out("Resource '%s' erased\n", (*it).first.c_str());
 #endif
-					it = m_resources.erase(it);
-					continue;
-				}
+						it = shard.m_resources.erase(it);
+						continue;
+					}
 
-				++it;
+					++it;
+				}
 			}
 		}
 	}
 
 	std::shared_ptr<IResource> Resources::Get(const std::string &filename)
 	{
-		for (auto &resource : m_resources)
+		auto &shard = GetShard(filename);
+		std::lock_guard<std::mutex> lock(shard.m_mutex);
+		auto it = shard.m_resources.find(filename);
+
+		if (it == shard.m_resources.end())
 		{
-			if (resource != nullptr && resource->GetFilename() == filename)
-			{
-				return resource;
-			}
+			return nullptr;
 		}
 
-		return nullptr;
+		return (*it).second;
 	}
 
-	void Resources::Add(const std::shared_ptr<IResource> &resource)
+	bool Resources::Add(const std::shared_ptr<IResource> &resource)
 	{
-		if (std::find(m_resources.begin(), m_resources.end(), resource) != m_resources.end())
+		if (resource == nullptr)
+		{
+			return false;
+		}
+
+		auto filename = resource->GetFilename();
+		auto &shard = GetShard(filename);
+		std::lock_guard<std::mutex> lock(shard.m_mutex);
+		auto result = shard.m_resources.emplace(filename, resource);
+
+		if (!result.second && (*result.first).second != resource)
 		{
-			return;
+			Log::Error("Resource '%s' is already cached, the new resource is not cached\n", filename.c_str());
+			return false;
 		}
 
-		m_resources.emplace_back(resource);
+		return true;
 	}
 
 	bool Resources::Remove(const std::shared_ptr<IResource> &resource)
 	{
-		for (auto it = m_resources.begin(); it != m_resources.end(); ++it)
+		if (resource == nullptr)
 		{
-			if (*it == resource)
-			{
-				m_resources.erase(it);
-				return true;
-			}
+			return false;
 		}
 
-		return false;
+		auto filename = resource->GetFilename();
+		auto &shard = GetShard(filename);
+		std::lock_guard<std::mutex> lock(shard.m_mutex);
+		auto it = shard.m_resources.find(filename);
+
+		if (it == shard.m_resources.end() || (*it).second != resource)
+		{
+			return false;
+		}
+
+		shard.m_resources.erase(it);
+		return true;
 	}
 
 	bool Resources::Remove(const std::string &filename)
 	{
-		for (auto it = m_resources.begin(); it != m_resources.end(); ++it)
+		auto &shard = GetShard(filename);
+		std::lock_guard<std::mutex> lock(shard.m_mutex);
+		return shard.m_resources.erase(filename) != 0;
+	}
+
+	Resources::Shard &Resources::GetShard(const std::string &filename)
+	{
+		return m_shards[std::hash<std::string>()(filename) % SHARD_COUNT];
+	}
+
+	void Resources::FinishLoad(const std::string &filename, const std::shared_ptr<IResource> &resource)
+	{
+		auto &shard = GetShard(filename);
+
 		{
-			if ((*it)->GetFilename() == filename)
+			std::lock_guard<std::mutex> lock(shard.m_mutex);
+
+			if (resource != nullptr)
 			{
-				m_resources.erase(it);
-				return true;
+				shard.m_resources.emplace(filename, resource);
 			}
+
+			shard.m_loading.erase(filename);
 		}
 
-		return false;
+		// Counted down once the shard is unlocked, the destructor may destroy the shard as soon as this reaches zero.
+		m_pendingLoads--;
 	}
 }
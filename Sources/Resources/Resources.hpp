@@ -1,21 +1,50 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
 #include <memory>
-#include <vector>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
 #include "Engine/Engine.hpp"
+#include "Helpers/TypeInfo.hpp"
 #include "Maths/Timer.hpp"
 #include "IResource.hpp"
 
 namespace acid
 {
 	/// <summary>
-	/// A module used for managing resources.
+	/// A module used for managing resources. Resources are stored in hashed shards keyed by filename,
+	/// each shard has its own lock so resources can be found and added from any thread.
 	/// </summary>
 	class ACID_EXPORT Resources :
 		public IModule
 	{
 	private:
-		std::vector<std::shared_ptr<IResource>> m_resources;
+		/// <summary>
+		/// A in-flight asynchronous load, the future is type erased and checked against the loaded type id.
+		/// </summary>
+		struct PendingLoad
+		{
+			TypeId m_typeId;
+			std::shared_ptr<void> m_future;
+		};
+
+		struct Shard
+		{
+			std::mutex m_mutex;
+			std::unordered_map<std::string, std::shared_ptr<IResource>> m_resources;
+			std::unordered_map<std::string, PendingLoad> m_loading;
+		};
+
+		static const uint32_t SHARD_COUNT = 16;
+
+		std::array<Shard, SHARD_COUNT> m_shards;
+		std::atomic<uint32_t> m_pendingLoads;
 		Timer m_timerPurge;
 	public:
 		/// <summary>
@@ -26,14 +55,124 @@ namespace acid
 
 		Resources();
 
+		~Resources();
+
+		Resources(const Resources&) = delete;
+
+		Resources& operator=(const Resources&) = delete;
+
 		void Update() override;
 
 		std::shared_ptr<IResource> Get(const std::string &filename);
 
-		void Add(const std::shared_ptr<IResource> &resource);
+		/// <summary>
+		/// Adds a resource to the cache, a different resource already cached under the same filename is kept and the new one is not cached.
+		/// </summary>
+		/// <param name="resource"> The resource to add. </param>
+		/// <returns> If the resource was added, or was already cached. </returns>
+		bool Add(const std::shared_ptr<IResource> &resource);
 
 		bool Remove(const std::shared_ptr<IResource> &resource);
 
 		bool Remove(const std::string &filename);
+
+		/// <summary>
+		/// Loads a resource on the engines thread pool, loads of a filename that is already loading share the same future.
+		/// A filename cached or loading as another type gives a null resource.
+		/// </summary>
+		/// <param name="filename"> The resource filename. </param>
+		/// <param name="create"> The function that creates the resource, called from a worker thread. </param>
+		/// <param name="T"> The resource type. </param>
+		/// <returns> The future resource. </returns>
+		template<typename T>
+		std::shared_future<std::shared_ptr<T>> Load(const std::string &filename, const std::function<std::shared_ptr<T>()> &create)
+		{
+			auto &shard = GetShard(filename);
+			std::unique_lock<std::mutex> lock(shard.m_mutex);
+
+			if (auto it = shard.m_resources.find(filename); it != shard.m_resources.end())
+			{
+				std::promise<std::shared_ptr<T>> loaded;
+				loaded.set_value(std::dynamic_pointer_cast<T>((*it).second));
+				return loaded.get_future().share();
+			}
+
+			if (auto it = shard.m_loading.find(filename); it != shard.m_loading.end())
+			{
+				if ((*it).second.m_typeId == TypeInfo::GetTypeId<T>())
+				{
+					return *std::static_pointer_cast<std::shared_future<std::shared_ptr<T>>>((*it).second.m_future);
+				}
+
+				// Loading it again would lose track of the first load, so this load fails the same way a cached resource of another type does.
+				Log::Error("Resource '%s' is already loading as a different type\n", filename.c_str());
+				std::promise<std::shared_ptr<T>> failed;
+				failed.set_value(nullptr);
+				return failed.get_future().share();
+			}
+
+			auto promise = std::make_shared<std::promise<std::shared_ptr<T>>>();
+			auto future = std::make_shared<std::shared_future<std::shared_ptr<T>>>(promise->get_future().share());
+			shard.m_loading[filename] = {TypeInfo::GetTypeId<T>(), future};
+			m_pendingLoads++;
+			lock.unlock();
+
+			Engine::Get()->GetThreadPool()->Schedule([this, filename, create, promise]()
+			{
+				try
+				{
+					auto result = create();
+					FinishLoad(filename, std::static_pointer_cast<IResource>(result));
+					promise->set_value(result);
+				}
+				catch (...)
+				{
+					FinishLoad(filename, nullptr);
+					promise->set_exception(std::current_exception());
+				}
+			});
+			return *future;
+		}
+
+		/// <summary>
+		/// Loads a resource constructed from its filename on the engines thread pool.
+		/// </summary>
+		/// <param name="filename"> The resource filename. </param>
+		/// <param name="T"> The resource type. </param>
+		/// <returns> The future resource. </returns>
+		template<typename T>
+		std::shared_future<std::shared_ptr<T>> Load(const std::string &filename)
+		{
+			return Load<T>(filename, [filename]()
+			{
+				return std::make_shared<T>(filename);
+			});
+		}
+
+		/// <summary>
+		/// Waits for a load to finish, running other jobs on the calling thread meanwhile, so a worker waiting on a load never holds up the pool.
+		/// </summary>
+		/// <param name="future"> The future returned by <seealso cref="#Load"/>. </param>
+		/// <param name="T"> The resource type. </param>
+		/// <returns> The loaded resource. </returns>
+		template<typename T>
+		std::shared_ptr<T> Wait(const std::shared_future<std::shared_ptr<T>> &future)
+		{
+			auto threadPool = Engine::Get()->GetThreadPool();
+
+			while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+			{
+				if (!threadPool->RunPending())
+				{
+					std::this_thread::yield();
+				}
+			}
+
+			return future.get();
+		}
+	private:
+		Shard &GetShard(const std::string &filename);
+
+		void FinishLoad(const std::string &filename, const std::shared_ptr<IResource> &resource);
 	};
 }
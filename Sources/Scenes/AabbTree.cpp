@@ -0,0 +1,361 @@
+#include "AabbTree.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace acid
+{
+	const int32_t AabbTree::NULL_NODE = -1;
+
+	AabbTree::AabbTree(const float &margin) :
+		m_nodes(std::vector<Node>()),
+		m_root(NULL_NODE),
+		m_freeList(NULL_NODE),
+		m_margin(margin)
+	{
+	}
+
+	int32_t AabbTree::Insert(GameObject *object, const Vector3 &min, const Vector3 &max)
+	{
+		int32_t leaf = AllocateNode();
+		auto &node = m_nodes[leaf];
+		node.m_min = min - m_margin;
+		node.m_max = max + m_margin;
+		node.m_tightMin = min;
+		node.m_tightMax = max;
+		node.m_object = object;
+		node.m_height = 0;
+		InsertLeaf(leaf);
+		return leaf;
+	}
+
+	void AabbTree::Remove(const int32_t &proxy)
+	{
+		RemoveLeaf(proxy);
+		FreeNode(proxy);
+	}
+
+	bool AabbTree::Move(const int32_t &proxy, const Vector3 &min, const Vector3 &max)
+	{
+		auto &node = m_nodes[proxy];
+		node.m_tightMin = min;
+		node.m_tightMax = max;
+
+		if (node.m_min <= min && max <= node.m_max)
+		{
+			return false;
+		}
+
+		RemoveLeaf(proxy);
+		m_nodes[proxy].m_min = min - m_margin;
+		m_nodes[proxy].m_max = max + m_margin;
+		InsertLeaf(proxy);
+		return true;
+	}
+
+	void AabbTree::Clear()
+	{
+		m_nodes.clear();
+		m_root = NULL_NODE;
+		m_freeList = NULL_NODE;
+	}
+
+	bool AabbTree::BoxIntersects(const Vector3 &minA, const Vector3 &maxA, const Vector3 &minB, const Vector3 &maxB)
+	{
+		return minA.m_x <= maxB.m_x && maxA.m_x >= minB.m_x &&
+			minA.m_y <= maxB.m_y && maxA.m_y >= minB.m_y &&
+			minA.m_z <= maxB.m_z && maxA.m_z >= minB.m_z;
+	}
+
+	bool AabbTree::SphereIntersects(const Vector3 &min, const Vector3 &max, const Vector3 &centre, const float &radius)
+	{
+		float distanceSquared = 0.0f;
+
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			float closest = std::clamp(centre[i], min[i], max[i]);
+			distanceSquared += (centre[i] - closest) * (centre[i] - closest);
+		}
+
+		return distanceSquared <= radius * radius;
+	}
+
+	bool AabbTree::RayIntersects(const Vector3 &min, const Vector3 &max, const Vector3 &origin, const Vector3 &direction, const float &distance)
+	{
+		float near = 0.0f;
+		float far = distance;
+
+		// Slab test, a zero direction component gives infinite slab distances.
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			if (direction[i] == 0.0f)
+			{
+				if (origin[i] < min[i] || origin[i] > max[i])
+				{
+					return false;
+				}
+
+				continue;
+			}
+
+			float inverse = 1.0f / direction[i];
+			float t0 = (min[i] - origin[i]) * inverse;
+			float t1 = (max[i] - origin[i]) * inverse;
+
+			if (t0 > t1)
+			{
+				std::swap(t0, t1);
+			}
+
+			near = std::max(near, t0);
+			far = std::min(far, t1);
+
+			if (near > far)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	int32_t AabbTree::AllocateNode()
+	{
+		if (m_freeList == NULL_NODE)
+		{
+			m_nodes.emplace_back();
+			m_freeList = static_cast<int32_t>(m_nodes.size()) - 1;
+			m_nodes[m_freeList].m_parent = NULL_NODE;
+		}
+
+		int32_t index = m_freeList;
+		m_freeList = m_nodes[index].m_parent;
+
+		auto &node = m_nodes[index];
+		node.m_object = nullptr;
+		node.m_parent = NULL_NODE;
+		node.m_left = NULL_NODE;
+		node.m_right = NULL_NODE;
+		node.m_height = 0;
+		return index;
+	}
+
+	void AabbTree::FreeNode(const int32_t &index)
+	{
+		// Free nodes are linked through their parent index.
+		m_nodes[index].m_parent = m_freeList;
+		m_nodes[index].m_height = -1;
+		m_freeList = index;
+	}
+
+	void AabbTree::InsertLeaf(const int32_t &leaf)
+	{
+		if (m_root == NULL_NODE)
+		{
+			m_root = leaf;
+			m_nodes[leaf].m_parent = NULL_NODE;
+			return;
+		}
+
+		Vector3 leafMin = m_nodes[leaf].m_min;
+		Vector3 leafMax = m_nodes[leaf].m_max;
+
+		// Finds the best sibling using the surface area heuristic.
+		int32_t index = m_root;
+
+		while (!m_nodes[index].IsLeaf())
+		{
+			auto &node = m_nodes[index];
+			float area = SurfaceArea(node.m_min, node.m_max);
+			float combinedArea = SurfaceArea(Vector3::MinVector(node.m_min, leafMin), Vector3::MaxVector(node.m_max, leafMax));
+
+			// Cost of creating a new parent for this node and the new leaf.
+			float cost = 2.0f * combinedArea;
+
+			// Minimum cost of pushing the leaf further down the tree.
+			float inheritanceCost = 2.0f * (combinedArea - area);
+
+			auto childCost = [&](const int32_t &child)
+			{
+				auto &childNode = m_nodes[child];
+				float childArea = SurfaceArea(Vector3::MinVector(childNode.m_min, leafMin), Vector3::MaxVector(childNode.m_max, leafMax));
+
+				if (childNode.IsLeaf())
+				{
+					return childArea + inheritanceCost;
+				}
+
+				return childArea - SurfaceArea(childNode.m_min, childNode.m_max) + inheritanceCost;
+			};
+
+			float costLeft = childCost(node.m_left);
+			float costRight = childCost(node.m_right);
+
+			if (cost < costLeft && cost < costRight)
+			{
+				break;
+			}
+
+			index = costLeft < costRight ? node.m_left : node.m_right;
+		}
+
+		int32_t sibling = index;
+		int32_t oldParent = m_nodes[sibling].m_parent;
+		int32_t newParent = AllocateNode();
+		m_nodes[newParent].m_parent = oldParent;
+		m_nodes[newParent].m_left = sibling;
+		m_nodes[newParent].m_right = leaf;
+		m_nodes[sibling].m_parent = newParent;
+		m_nodes[leaf].m_parent = newParent;
+		CombineChildren(newParent);
+
+		if (oldParent == NULL_NODE)
+		{
+			m_root = newParent;
+		}
+		else if (m_nodes[oldParent].m_left == sibling)
+		{
+			m_nodes[oldParent].m_left = newParent;
+		}
+		else
+		{
+			m_nodes[oldParent].m_right = newParent;
+		}
+
+		Refit(oldParent);
+	}
+
+	void AabbTree::RemoveLeaf(const int32_t &leaf)
+	{
+		if (leaf == m_root)
+		{
+			m_root = NULL_NODE;
+			return;
+		}
+
+		int32_t parent = m_nodes[leaf].m_parent;
+		int32_t grandParent = m_nodes[parent].m_parent;
+		int32_t sibling = m_nodes[parent].m_left == leaf ? m_nodes[parent].m_right : m_nodes[parent].m_left;
+
+		if (grandParent == NULL_NODE)
+		{
+			m_root = sibling;
+			m_nodes[sibling].m_parent = NULL_NODE;
+			FreeNode(parent);
+			return;
+		}
+
+		if (m_nodes[grandParent].m_left == parent)
+		{
+			m_nodes[grandParent].m_left = sibling;
+		}
+		else
+		{
+			m_nodes[grandParent].m_right = sibling;
+		}
+
+		m_nodes[sibling].m_parent = grandParent;
+		FreeNode(parent);
+		Refit(grandParent);
+	}
+
+	void AabbTree::Refit(int32_t index)
+	{
+		while (index != NULL_NODE)
+		{
+			index = Balance(index);
+			CombineChildren(index);
+			index = m_nodes[index].m_parent;
+		}
+	}
+
+	int32_t AabbTree::Balance(const int32_t &index)
+	{
+		int32_t iA = index;
+
+		if (m_nodes[iA].IsLeaf() || m_nodes[iA].m_height < 2)
+		{
+			return iA;
+		}
+
+		int32_t iB = m_nodes[iA].m_left;
+		int32_t iC = m_nodes[iA].m_right;
+		int32_t balance = m_nodes[iC].m_height - m_nodes[iB].m_height;
+
+		// Rotates the taller child up, the shorter grandchild is given to A.
+		auto rotate = [&](const int32_t &iUp, const bool &upIsRight)
+		{
+			int32_t iF = m_nodes[iUp].m_left;
+			int32_t iG = m_nodes[iUp].m_right;
+
+			m_nodes[iUp].m_left = iA;
+			m_nodes[iUp].m_parent = m_nodes[iA].m_parent;
+			m_nodes[iA].m_parent = iUp;
+
+			int32_t upParent = m_nodes[iUp].m_parent;
+
+			if (upParent == NULL_NODE)
+			{
+				m_root = iUp;
+			}
+			else if (m_nodes[upParent].m_left == iA)
+			{
+				m_nodes[upParent].m_left = iUp;
+			}
+			else
+			{
+				m_nodes[upParent].m_right = iUp;
+			}
+
+			int32_t iKeep = m_nodes[iF].m_height > m_nodes[iG].m_height ? iF : iG;
+			int32_t iGive = iKeep == iF ? iG : iF;
+
+			m_nodes[iUp].m_right = iKeep;
+			m_nodes[iGive].m_parent = iA;
+
+			if (upIsRight)
+			{
+				m_nodes[iA].m_right = iGive;
+			}
+			else
+			{
+				m_nodes[iA].m_left = iGive;
+			}
+
+			CombineChildren(iA);
+			CombineChildren(iUp);
+			return iUp;
+		};
+
+		if (balance > 1)
+		{
+			return rotate(iC, true);
+		}
+
+		if (balance < -1)
+		{
+			return rotate(iB, false);
+		}
+
+		return iA;
+	}
+
+	void AabbTree::CombineChildren(const int32_t &index)
+	{
+		auto &node = m_nodes[index];
+		auto &left = m_nodes[node.m_left];
+		auto &right = m_nodes[node.m_right];
+		node.m_min = Vector3::MinVector(left.m_min, right.m_min);
+		node.m_max = Vector3::MaxVector(left.m_max, right.m_max);
+		node.m_tightMin = node.m_min;
+		node.m_tightMax = node.m_max;
+		node.m_height = 1 + std::max(left.m_height, right.m_height);
+	}
+
+	float AabbTree::SurfaceArea(const Vector3 &min, const Vector3 &max)
+	{
+		Vector3 size = max - min;
+		return 2.0f * (size.m_x * size.m_y + size.m_y * size.m_z + size.m_z * size.m_x);
+	}
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <vector>
+#include "Maths/Vector3.hpp"
+
+namespace acid
+{
+	class GameObject;
+
+	/// <summary>
+	/// A dynamic bounding volume hierarchy of axis aligned boxes. Leaves are stored with a fattened box,
+	/// so objects that move a little do not need to be reinserted.
+	/// </summary>
+	class ACID_EXPORT AabbTree
+	{
+	private:
+		struct Node
+		{
+			Vector3 m_min;
+			Vector3 m_max;
+			Vector3 m_tightMin;
+			Vector3 m_tightMax;
+			GameObject *m_object;
+			int32_t m_parent;
+			int32_t m_left;
+			int32_t m_right;
+			int32_t m_height;
+
+			bool IsLeaf() const { return m_left == NULL_NODE; }
+		};
+
+		std::vector<Node> m_nodes;
+		int32_t m_root;
+		int32_t m_freeList;
+		float m_margin;
+	public:
+		static const int32_t NULL_NODE;
+
+		/// <summary>
+		/// Creates a new AABB tree.
+		/// </summary>
+		/// <param name="margin"> How far leaf boxes are fattened on each side. </param>
+		explicit AabbTree(const float &margin = 1.0f);
+
+		/// <summary>
+		/// Inserts a object into the tree.
+		/// </summary>
+		/// <param name="object"> The object. </param>
+		/// <param name="min"> The objects minimum bounds. </param>
+		/// <param name="max"> The objects maximum bounds. </param>
+		/// <returns> The proxy id used to move and remove the object. </returns>
+		int32_t Insert(GameObject *object, const Vector3 &min, const Vector3 &max);
+
+		/// <summary>
+		/// Removes a object from the tree.
+		/// </summary>
+		/// <param name="proxy"> The objects proxy id. </param>
+		void Remove(const int32_t &proxy);
+
+		/// <summary>
+		/// Updates the bounds of a object, the leaf is only reinserted if the bounds leave its fattened box.
+		/// </summary>
+		/// <param name="proxy"> The objects proxy id. </param>
+		/// <param name="min"> The objects minimum bounds. </param>
+		/// <param name="max"> The objects maximum bounds. </param>
+		/// <returns> If the leaf was reinserted. </returns>
+		bool Move(const int32_t &proxy, const Vector3 &min, const Vector3 &max);
+
+		/// <summary>
+		/// Removes all objects from the tree.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Finds every object whose box passes a test, subtrees whose box fails the test are skipped.
+		/// </summary>
+		/// <param name="overlaps"> A function taking a min and max that returns if the box overlaps the query. </param>
+		/// <param name="result"> The list to add found objects into. </param>
+		template<typename Overlaps>
+		void Query(const Overlaps &overlaps, std::vector<GameObject *> &result) const
+		{
+			if (m_root == NULL_NODE)
+			{
+				return;
+			}
+
+			std::vector<int32_t> stack;
+			stack.emplace_back(m_root);
+
+			while (!stack.empty())
+			{
+				auto &node = m_nodes[stack.back()];
+				stack.pop_back();
+
+				if (node.IsLeaf())
+				{
+					if (overlaps(node.m_tightMin, node.m_tightMax))
+					{
+						result.emplace_back(node.m_object);
+					}
+
+					continue;
+				}
+
+				if (overlaps(node.m_min, node.m_max))
+				{
+					stack.emplace_back(node.m_left);
+					stack.emplace_back(node.m_right);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Gets the height of the tree, zero when there is one leaf.
+		/// </summary>
+		/// <returns> The trees height. </returns>
+		int32_t GetHeight() const { return m_root == NULL_NODE ? 0 : m_nodes[m_root].m_height; }
+
+		/// <summary>
+		/// Gets if two boxes overlap.
+		/// </summary>
+		static bool BoxIntersects(const Vector3 &minA, const Vector3 &maxA, const Vector3 &minB, const Vector3 &maxB);
+
+		/// <summary>
+		/// Gets if a box overlaps a sphere.
+		/// </summary>
+		static bool SphereIntersects(const Vector3 &min, const Vector3 &max, const Vector3 &centre, const float &radius);
+
+		/// <summary>
+		/// Gets if a ray segment passes through a box.
+		/// </summary>
+		/// <param name="min"> The boxes minimum. </param>
+		/// <param name="max"> The boxes maximum. </param>
+		/// <param name="origin"> The rays origin. </param>
+		/// <param name="direction"> The rays normalized direction. </param>
+		/// <param name="distance"> The length of the ray. </param>
+		/// <returns> If the ray hits the box. </returns>
+		static bool RayIntersects(const Vector3 &min, const Vector3 &max, const Vector3 &origin, const Vector3 &direction, const float &distance);
+	private:
+		int32_t AllocateNode();
+
+		void FreeNode(const int32_t &index);
+
+		void InsertLeaf(const int32_t &leaf);
+
+		void RemoveLeaf(const int32_t &leaf);
+
+		void Refit(int32_t index);
+
+		int32_t Balance(const int32_t &index);
+
+		void CombineChildren(const int32_t &index);
+
+		static float SurfaceArea(const Vector3 &min, const Vector3 &max);
+	};
+}
@@ -25,11 +25,12 @@ namespace acid
 		/// </summary>
 		/// <param name="camera"> The scenes camera. </param>
 		/// <param name="selectorJoystick"> The joystick controlled UI selector. </param>
-		IScene(ICamera *camera, SelectorJoystick *selectorJoystick) :
+		/// <param name="structure"> The scenes object structure, if null a flat <seealso cref="SceneStructure"/> is used. </param>
+		IScene(ICamera *camera, SelectorJoystick *selectorJoystick, SceneStructure *structure = nullptr) :
 			m_camera(camera),
 			m_selectorJoystick(selectorJoystick),
 			m_physics(std::make_unique<ScenePhysics>()),
-			m_structure(std::make_unique<SceneStructure>()),
+			m_structure(structure != nullptr ? structure : new SceneStructure()),
 			m_started(false)
 		{
 		}
@@ -81,20 +81,49 @@ namespace acid
 		/// </summary>
 		/// <param name="centre"> The centre of the sphere. </param>
 		/// <param name="radius"> The spheres radius. </param>
-		/// <param name="result"> The list to store the data into.
-		/// </param>
 		/// <returns> The list of all object in range. </returns>
-	//	virtual std::vector<GameObject *> QuerySphere(const Vector3 &centre, const Vector3 &radius) = 0;
+		virtual std::vector<GameObject *> QuerySphere(const Vector3 &centre, const float &radius) = 0;
 
 		/// <summary>
 		/// Returns a set of all objects in a spatial objects contained in a cube.
 		/// </summary>
 		/// <param name="min"> The minimum point of the cube. </param>
 		/// <param name="max"> The maximum point of the cube. </param>
-		/// <param name="result"> The list to store the data into.
-		/// </param>
 		/// <returns> The list of all object in range. </returns>
-	//	virtual std::vector<GameObject *> QueryCube(const Vector3 &min, const Vector3 &max) = 0;
+		virtual std::vector<GameObject *> QueryCube(const Vector3 &min, const Vector3 &max) = 0;
+
+		/// <summary>
+		/// Returns a set of all objects in a spatial objects hit by a ray.
+		/// </summary>
+		/// <param name="origin"> The rays origin. </param>
+		/// <param name="direction"> The rays normalized direction. </param>
+		/// <param name="distance"> The length of the ray. </param>
+		/// <returns> The list of all object hit. </returns>
+		virtual std::vector<GameObject *> QueryRay(const Vector3 &origin, const Vector3 &direction, const float &distance) = 0;
+
+		/// <summary>
+		/// Called when a component is attached to a object in this structure.
+		/// </summary>
+		/// <param name="component"> The attached component. </param>
+		virtual void OnComponentAdd(IComponent *component)
+		{
+		}
+
+		/// <summary>
+		/// Called when a component is detached from a object in this structure, or its object is destroyed.
+		/// </summary>
+		/// <param name="component"> The detached component. </param>
+		virtual void OnComponentRemove(IComponent *component)
+		{
+		}
+
+		/// <summary>
+		/// Called when a object stored in this structure is being destroyed.
+		/// </summary>
+		/// <param name="object"> The destroyed object. </param>
+		virtual void OnObjectRemove(GameObject *object)
+		{
+		}
 
 		/// <summary>
 		/// If the structure contains the object.
@@ -1,22 +1,34 @@
 ﻿#include "SceneStructure.hpp"
 
 #include "Physics/Rigidbody.hpp"
+#include "AabbTree.hpp"
 
 namespace acid
 {
 	SceneStructure::SceneStructure() :
 		ISpatialStructure(),
+		m_componentIndex(),
 		m_objects(std::vector<std::unique_ptr<GameObject>>())
 	{
 	}
 
 	void SceneStructure::Add(GameObject *object)
 	{
+		for (auto &component : object->GetComponents())
+		{
+			m_componentIndex.Add(component.get());
+		}
+
 		m_objects.emplace_back(object);
 	}
 
 	void SceneStructure::Add(std::unique_ptr<GameObject> object)
 	{
+		for (auto &component : object->GetComponents())
+		{
+			m_componentIndex.Add(component.get());
+		}
+
 		m_objects.emplace_back(std::move(object));
 	}
 
@@ -45,6 +57,11 @@ namespace acid
 				continue;
 			}
 
+			for (auto &component : object->GetComponents())
+			{
+				m_componentIndex.Remove(component.get());
+			}
+
 			structure->Add(std::move(*it));
 			m_objects.erase(it);
 			return true;
@@ -91,6 +108,34 @@ namespace acid
 	}
 
 	std::vector<GameObject *> SceneStructure::QueryFrustum(const Frustum &range)
+	{
+		auto result = QueryAll();
+		auto visible = Rigidbody::CullObjects(range, result);
+		std::size_t written = 0;
+
+		for (std::size_t i = 0; i < result.size(); i++)
+		{
+			if (visible[i] != 0)
+			{
+				result[written++] = result[i];
+			}
+		}
+
+		result.resize(written);
+		return result;
+	}
+
+	void SceneStructure::OnComponentAdd(IComponent *component)
+	{
+		m_componentIndex.Add(component);
+	}
+
+	void SceneStructure::OnComponentRemove(IComponent *component)
+	{
+		m_componentIndex.Remove(component);
+	}
+
+	std::vector<GameObject *> SceneStructure::QuerySphere(const Vector3 &centre, const float &radius)
 	{
 		auto result = std::vector<GameObject *>();
 
@@ -101,9 +146,11 @@ namespace acid
 				continue;
 			}
 
-			auto rigidbody = (*it)->GetComponent<Rigidbody>();
+			Vector3 min = Vector3();
+			Vector3 max = Vector3();
+			GetBounds((*it).get(), min, max);
 
-			if (rigidbody == nullptr || rigidbody->InFrustum(range))
+			if (AabbTree::SphereIntersects(min, max, centre, radius))
 			{
 				result.emplace_back((*it).get());
 			}
@@ -112,15 +159,53 @@ namespace acid
 		return result;
 	}
 
-	/*std::vector<GameObject *> SceneStructure::QuerySphere(const Vector3 &centre, const Vector3 &radius)
+	std::vector<GameObject *> SceneStructure::QueryCube(const Vector3 &min, const Vector3 &max)
 	{
-		return std::vector<GameObject *>();
-	}*/
+		auto result = std::vector<GameObject *>();
+
+		for (auto it = m_objects.begin(); it != m_objects.end(); ++it)
+		{
+			if ((*it)->IsRemoved())
+			{
+				continue;
+			}
+
+			Vector3 objectMin = Vector3();
+			Vector3 objectMax = Vector3();
+			GetBounds((*it).get(), objectMin, objectMax);
 
-	/*std::vector<GameObject *> SceneStructure::QueryCube(const Vector3 &min, const Vector3 &max)
+			if (AabbTree::BoxIntersects(objectMin, objectMax, min, max))
+			{
+				result.emplace_back((*it).get());
+			}
+		}
+
+		return result;
+	}
+
+	std::vector<GameObject *> SceneStructure::QueryRay(const Vector3 &origin, const Vector3 &direction, const float &distance)
 	{
-		return std::vector<GameObject *>();
-	}*/
+		auto result = std::vector<GameObject *>();
+
+		for (auto it = m_objects.begin(); it != m_objects.end(); ++it)
+		{
+			if ((*it)->IsRemoved())
+			{
+				continue;
+			}
+
+			Vector3 min = Vector3();
+			Vector3 max = Vector3();
+			GetBounds((*it).get(), min, max);
+
+			if (AabbTree::RayIntersects(min, max, origin, direction, distance))
+			{
+				result.emplace_back((*it).get());
+			}
+		}
+
+		return result;
+	}
 
 	bool SceneStructure::Contains(GameObject *object)
 	{
@@ -134,4 +219,18 @@ namespace acid
 
 		return false;
 	}
+
+	bool SceneStructure::GetBounds(GameObject *object, Vector3 &min, Vector3 &max)
+	{
+		auto rigidbody = object->GetComponent<Rigidbody>();
+
+		if (rigidbody != nullptr && rigidbody->GetAabb(min, max))
+		{
+			return true;
+		}
+
+		min = object->GetTransform().GetPosition();
+		max = min;
+		return false;
+	}
 }
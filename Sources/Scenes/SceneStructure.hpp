@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <vector>
+#include "Objects/ComponentIndex.hpp"
 #include "Objects/GameObject.hpp"
 #include "Objects/IComponent.hpp"
 #include "Physics/Rigidbody.hpp"
@@ -16,6 +17,7 @@ namespace acid
 		public ISpatialStructure
 	{
 	private:
+		ComponentIndex m_componentIndex;
 		std::vector<std::unique_ptr<GameObject>> m_objects;
 	public:
 		/// <summary>
@@ -45,9 +47,15 @@ namespace acid
 
 		std::vector<GameObject *> QueryFrustum(const Frustum &range) override;
 
-	//	std::vector<GameObject *> QuerySphere(const Vector3 &centre, const Vector3 &radius) override;
+		std::vector<GameObject *> QuerySphere(const Vector3 &centre, const float &radius) override;
 
-	//	std::vector<GameObject *> QueryCube(const Vector3 &min, const Vector3 &max) override;
+		std::vector<GameObject *> QueryCube(const Vector3 &min, const Vector3 &max) override;
+
+		std::vector<GameObject *> QueryRay(const Vector3 &origin, const Vector3 &direction, const float &distance) override;
+
+		void OnComponentAdd(IComponent *component) override;
+
+		void OnComponentRemove(IComponent *component) override;
 
 		/// <summary>
 		/// Returns a set of all components of a type in the spatial structure.
@@ -55,22 +63,7 @@ namespace acid
 		/// <param name="allowDisabled"> If disabled components will be included in this query. </param>
 		/// <returns> The list specified by of all components that match the type. </returns>
 		template<typename T>
-		std::vector<T *> QueryComponents(const bool &allowDisabled = false)
-		{
-			auto result = std::vector<T *>();
-
-			for (auto it = m_objects.begin(); it != m_objects.end(); ++it)
-			{
-				auto component = (*it)->GetComponent<T>();
-
-				if (component != nullptr && (component->IsEnabled() || allowDisabled))
-				{
-					result.emplace_back(component);
-				}
-			}
-
-			return result;
-		}
+		std::vector<T *> QueryComponents(const bool &allowDisabled = false) { return m_componentIndex.Query<T>(allowDisabled); }
 
 		/// <summary>
 		/// Returns the first component of a type found in the spatial structure.
@@ -78,21 +71,18 @@ namespace acid
 		/// <param name="allowDisabled"> If disabled components will be included in this query. </param>
 		/// <returns> The first component of the type found. </returns>
 		template<typename T>
-		T *GetComponent(const bool &allowDisabled = false)
-		{
-			for (auto it = m_objects.begin(); it != m_objects.end(); ++it)
-			{
-				auto component = (*it)->GetComponent<T>();
-
-				if (component != nullptr && (component->IsEnabled() || allowDisabled))
-				{
-					return component;
-				}
-			}
-
-			return nullptr;
-		}
+		T *GetComponent(const bool &allowDisabled = false) { return m_componentIndex.GetFirst<T>(allowDisabled); }
 
 		bool Contains(GameObject *object) override;
+
+		/// <summary>
+		/// Gets the world space bounds a object is placed by, the rigidbody box if it has a created body, otherwise its position.
+		/// Objects without a box are never frustum culled.
+		/// </summary>
+		/// <param name="object"> The object. </param>
+		/// <param name="min"> The minimum point to write into. </param>
+		/// <param name="max"> The maximum point to write into. </param>
+		/// <returns> If the bounds are the rigidbody box. </returns>
+		static bool GetBounds(GameObject *object, Vector3 &min, Vector3 &max);
 	};
 }
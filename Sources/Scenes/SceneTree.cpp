@@ -0,0 +1,225 @@
+#include "SceneTree.hpp"
+
+#include <algorithm>
+#include "Physics/Collider.hpp"
+
+namespace acid
+{
+	static void EraseRemoved(std::vector<GameObject *> &objects)
+	{
+		objects.erase(std::remove_if(objects.begin(), objects.end(), [](GameObject *object)
+		{
+			return object->IsRemoved();
+		}), objects.end());
+	}
+
+	SceneTree::SceneTree(const float &margin) :
+		SceneStructure(),
+		m_tree(AabbTree(margin)),
+		m_proxies(std::unordered_map<GameObject *, Proxy>()),
+		m_unbounded(std::unordered_set<GameObject *>())
+	{
+	}
+
+	void SceneTree::Add(GameObject *object)
+	{
+		SceneStructure::Add(object);
+		Insert(object);
+	}
+
+	void SceneTree::Add(std::unique_ptr<GameObject> object)
+	{
+		auto objectPtr = object.get();
+		SceneStructure::Add(std::move(object));
+		Insert(objectPtr);
+	}
+
+	bool SceneTree::Move(GameObject *object, ISpatialStructure *structure)
+	{
+		Erase(object);
+		return SceneStructure::Move(object, structure);
+	}
+
+	void SceneTree::Clear()
+	{
+		m_tree.Clear();
+		m_proxies.clear();
+		m_unbounded.clear();
+		SceneStructure::Clear();
+	}
+
+	void SceneTree::Update()
+	{
+		SceneStructure::Update();
+
+		for (auto &[object, proxy] : m_proxies)
+		{
+			if (object->IsRemoved())
+			{
+				continue;
+			}
+
+			// A rigidbody that has not created its body yet is checked every update, until its box exists.
+			bool waiting = proxy.m_rigidbody != nullptr && !proxy.m_bounded;
+
+			if (!proxy.m_dirty && !waiting && object->GetTransform() == proxy.m_transform)
+			{
+				continue;
+			}
+
+			Vector3 min = Vector3();
+			Vector3 max = Vector3();
+			Refresh(object, proxy, min, max);
+			m_tree.Move(proxy.m_id, min, max);
+		}
+	}
+
+	std::vector<GameObject *> SceneTree::QueryFrustum(const Frustum &range)
+	{
+		auto found = std::vector<GameObject *>();
+		m_tree.Query([&range](const Vector3 &min, const Vector3 &max)
+		{
+			return range.CubeInFrustum(min, max);
+		}, found);
+
+		// Like the scene structure, objects without a box are always visible rather than culled as points.
+		auto result = std::vector<GameObject *>();
+
+		for (auto &object : found)
+		{
+			if (!object->IsRemoved() && m_unbounded.find(object) == m_unbounded.end())
+			{
+				result.emplace_back(object);
+			}
+		}
+
+		for (auto &object : m_unbounded)
+		{
+			if (!object->IsRemoved())
+			{
+				result.emplace_back(object);
+			}
+		}
+
+		return result;
+	}
+
+	std::vector<GameObject *> SceneTree::QuerySphere(const Vector3 &centre, const float &radius)
+	{
+		auto result = std::vector<GameObject *>();
+		m_tree.Query([&centre, &radius](const Vector3 &min, const Vector3 &max)
+		{
+			return AabbTree::SphereIntersects(min, max, centre, radius);
+		}, result);
+		EraseRemoved(result);
+		return result;
+	}
+
+	std::vector<GameObject *> SceneTree::QueryCube(const Vector3 &min, const Vector3 &max)
+	{
+		auto result = std::vector<GameObject *>();
+		m_tree.Query([&min, &max](const Vector3 &nodeMin, const Vector3 &nodeMax)
+		{
+			return AabbTree::BoxIntersects(nodeMin, nodeMax, min, max);
+		}, result);
+		EraseRemoved(result);
+		return result;
+	}
+
+	std::vector<GameObject *> SceneTree::QueryRay(const Vector3 &origin, const Vector3 &direction, const float &distance)
+	{
+		auto result = std::vector<GameObject *>();
+		m_tree.Query([&origin, &direction, &distance](const Vector3 &min, const Vector3 &max)
+		{
+			return AabbTree::RayIntersects(min, max, origin, direction, distance);
+		}, result);
+		EraseRemoved(result);
+		return result;
+	}
+
+	void SceneTree::OnComponentAdd(IComponent *component)
+	{
+		SceneStructure::OnComponentAdd(component);
+		MarkDirty(component);
+	}
+
+	void SceneTree::OnComponentRemove(IComponent *component)
+	{
+		SceneStructure::OnComponentRemove(component);
+		MarkDirty(component);
+	}
+
+	void SceneTree::OnObjectRemove(GameObject *object)
+	{
+		Erase(object);
+	}
+
+	void SceneTree::Insert(GameObject *object)
+	{
+		if (m_proxies.find(object) != m_proxies.end())
+		{
+			return;
+		}
+
+		Proxy proxy = {};
+		proxy.m_id = AabbTree::NULL_NODE;
+		proxy.m_dirty = true;
+
+		Vector3 min = Vector3();
+		Vector3 max = Vector3();
+		Refresh(object, proxy, min, max);
+		proxy.m_id = m_tree.Insert(object, min, max);
+		m_proxies.emplace(object, proxy);
+	}
+
+	void SceneTree::Erase(GameObject *object)
+	{
+		auto it = m_proxies.find(object);
+
+		if (it == m_proxies.end())
+		{
+			return;
+		}
+
+		m_tree.Remove((*it).second.m_id);
+		m_proxies.erase(it);
+		m_unbounded.erase(object);
+	}
+
+	void SceneTree::Refresh(GameObject *object, Proxy &proxy, Vector3 &min, Vector3 &max)
+	{
+		if (proxy.m_dirty)
+		{
+			proxy.m_rigidbody = object->GetComponent<Rigidbody>();
+			proxy.m_dirty = false;
+		}
+
+		proxy.m_transform = object->GetTransform();
+		proxy.m_bounded = proxy.m_rigidbody != nullptr && proxy.m_rigidbody->GetAabb(min, max);
+
+		if (proxy.m_bounded)
+		{
+			m_unbounded.erase(object);
+			return;
+		}
+
+		min = proxy.m_transform.GetPosition();
+		max = min;
+		m_unbounded.emplace(object);
+	}
+
+	void SceneTree::MarkDirty(IComponent *component)
+	{
+		if (dynamic_cast<Rigidbody *>(component) == nullptr && dynamic_cast<Collider *>(component) == nullptr)
+		{
+			return;
+		}
+
+		auto it = m_proxies.find(component->GetGameObject());
+
+		if (it != m_proxies.end())
+		{
+			(*it).second.m_dirty = true;
+		}
+	}
+}
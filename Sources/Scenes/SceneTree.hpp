@@ -0,0 +1,78 @@
+#pragma once
+
+#include <unordered_map>
+#include <unordered_set>
+#include "AabbTree.hpp"
+#include "SceneStructure.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// A scene structure that also keeps its objects in a dynamic AABB tree, so spatial queries only visit overlapping branches.
+	/// Object bounds are refreshed after an update moves the object or changes its physics components, and a leaf is only reinserted once it leaves its fattened box.
+	/// </summary>
+	class ACID_EXPORT SceneTree :
+		public SceneStructure
+	{
+	private:
+		struct Proxy
+		{
+			int32_t m_id;
+			Rigidbody *m_rigidbody;
+			/// The transform the bounds were last taken at.
+			Transform m_transform;
+			/// If the bounds are the rigidbody box, objects without a box are kept in the tree as points.
+			bool m_bounded;
+			/// Set when a rigidbody or collider is attached or detached, the rigidbody is found again on the next refresh.
+			bool m_dirty;
+		};
+
+		AabbTree m_tree;
+		std::unordered_map<GameObject *, Proxy> m_proxies;
+		std::unordered_set<GameObject *> m_unbounded;
+	public:
+		/// <summary>
+		/// Creates a new scene tree.
+		/// </summary>
+		/// <param name="margin"> How far object bounds are fattened, larger margins reinsert less often but give looser queries. </param>
+		explicit SceneTree(const float &margin = 1.0f);
+
+		void Add(GameObject *object) override;
+
+		void Add(std::unique_ptr<GameObject> object) override;
+
+		bool Move(GameObject *object, ISpatialStructure *structure) override;
+
+		void Clear() override;
+
+		void Update() override;
+
+		std::vector<GameObject *> QueryFrustum(const Frustum &range) override;
+
+		std::vector<GameObject *> QuerySphere(const Vector3 &centre, const float &radius) override;
+
+		std::vector<GameObject *> QueryCube(const Vector3 &min, const Vector3 &max) override;
+
+		std::vector<GameObject *> QueryRay(const Vector3 &origin, const Vector3 &direction, const float &distance) override;
+
+		void OnComponentAdd(IComponent *component) override;
+
+		void OnComponentRemove(IComponent *component) override;
+
+		void OnObjectRemove(GameObject *object) override;
+
+		/// <summary>
+		/// Gets the AABB tree backing this structure.
+		/// </summary>
+		/// <returns> The AABB tree. </returns>
+		const AabbTree &GetTree() const { return m_tree; }
+	private:
+		void Insert(GameObject *object);
+
+		void Erase(GameObject *object);
+
+		void Refresh(GameObject *object, Proxy &proxy, Vector3 &min, Vector3 &max);
+
+		void MarkDirty(IComponent *component);
+	};
+}
@@ -3,15 +3,46 @@
 #include <algorithm>
 #include "Engine/Log.hpp"
 #include "Network/Packet.hpp"
-#include "Serialize.hpp"
 
 namespace acid
 {
+	const uint32_t Metadata::INDEX_THRESHOLD = 8;
+	const uint32_t Metadata::MAX_PACKET_DEPTH = 128;
+
+	/// Calls a function with a name, and then with its spaces swapped for underscores if it has any, the form XML element names are saved in.
+	template<typename F>
+	static Metadata *WithNameForms(const std::string_view &name, const F &function)
+	{
+		if (auto result = function(name); result != nullptr || name.find(' ') == std::string_view::npos)
+		{
+			return result;
+		}
+
+		char buffer[128];
+		std::string longName;
+		char *underscored = buffer;
+
+		if (name.size() > sizeof(buffer))
+		{
+			longName.resize(name.size());
+			underscored = &longName[0];
+		}
+
+		for (std::size_t i = 0; i < name.size(); i++)
+		{
+			underscored[i] = name[i] == ' ' ? '_' : name[i];
+		}
+
+		return function(std::string_view(underscored, name.size()));
+	}
+
 	Metadata::Metadata(const std::string &name, const std::string &value, const std::map<std::string, std::string> &attributes) :
 		m_name(String::Trim(String::RemoveAll(name, '\"'))),
 		m_value(String::Trim(value)),
 		m_children(std::vector<std::unique_ptr<Metadata>>()),
-		m_attributes(attributes)
+		m_attributes(attributes),
+		m_parent(nullptr),
+		m_childIndex(nullptr)
 	{
 	}
 
@@ -19,8 +50,37 @@ namespace acid
 		m_name(String::Trim(String::RemoveAll(name, '\"'))),
 		m_value(String::Trim(value)),
 		m_children(std::vector<std::unique_ptr<Metadata>>()),
-		m_attributes(std::map<std::string, std::string>())
+		m_attributes(std::map<std::string, std::string>()),
+		m_parent(nullptr),
+		m_childIndex(nullptr)
+	{
+	}
+
+	void Metadata::SetName(const std::string &name)
 	{
+		if (m_parent == nullptr || m_parent->m_childIndex == nullptr)
+		{
+			m_name = name;
+			return;
+		}
+
+		// Parsers name each child right after adding it, the newest child comes after every other so its entry is updated in place.
+		if (m_parent->m_children.back().get() != this)
+		{
+			m_name = name;
+			m_parent->BuildIndex();
+			return;
+		}
+
+		auto &index = *m_parent->m_childIndex;
+
+		if (auto it = index.find(m_name); it != index.end() && (*it).second == this)
+		{
+			index.erase(it);
+		}
+
+		m_name = name;
+		index.emplace(m_name, this);
 	}
 
 	std::string Metadata::GetString() const
@@ -60,7 +120,18 @@ namespace acid
 			return child;
 		}*/
 
+		child->m_parent = this;
 		m_children.emplace_back(child);
+
+		if (m_childIndex != nullptr)
+		{
+			m_childIndex->emplace(child->m_name, child);
+		}
+		else if (m_children.size() >= INDEX_THRESHOLD)
+		{
+			BuildIndex();
+		}
+
 		return child;
 	}
 
@@ -71,6 +142,7 @@ namespace acid
 			if ((*it).get() == child)
 			{
 				m_children.erase(it);
+				BuildIndex();
 				return true;
 			}
 		}
@@ -78,6 +150,12 @@ namespace acid
 		return false;
 	}
 
+	void Metadata::ClearChildren()
+	{
+		m_children.clear();
+		m_childIndex.reset();
+	}
+
 	std::vector<Metadata *> Metadata::FindChildren(const std::string &name) const
 	{
 		auto result = std::vector<Metadata *>();
@@ -95,44 +173,82 @@ namespace acid
 
 	Metadata *Metadata::FindChild(const std::string &name, const bool &reportError) const
 	{
-		std::string nameNoSpaces = String::ReplaceAll(name, " ", "_");
+		Metadata *result = nullptr;
 
-		for (auto &child : m_children)
+		if (m_childIndex == nullptr)
 		{
-			if (child->m_name == name || child->m_name == nameNoSpaces)
+			result = WithNameForms(name, [this](const std::string_view &form)
 			{
-				return child.get();
-			}
+				return FindChildLinear(form);
+			});
+		}
+		else
+		{
+			result = WithNameForms(name, [this](const std::string_view &form)
+			{
+				auto it = m_childIndex->find(form);
+				return it == m_childIndex->end() ? nullptr : (*it).second;
+			});
 		}
 
-		if (reportError)
+		if (result == nullptr && reportError)
 		{
 			Log::Error("Could not find child in metadata by name '%s'\n", name.c_str());
 		}
 
+		return result;
+	}
+
+	Metadata *Metadata::FindChildLinear(const std::string_view &name) const
+	{
+		for (auto &child : m_children)
+		{
+			if (child->m_name == name)
+			{
+				return child.get();
+			}
+		}
+
 		return nullptr;
 	}
 
-	Metadata *Metadata::FindChildWithAttribute(const std::string &childName, const std::string &attribute, const std::string &value, const bool &reportError) const
+	void Metadata::BuildIndex()
 	{
-		auto children = FindChildren(childName);
+		if (m_children.size() < INDEX_THRESHOLD)
+		{
+			m_childIndex.reset();
+			return;
+		}
+
+		m_childIndex = std::make_unique<std::unordered_map<std::string_view, Metadata *>>(m_children.size());
 
-		if (children.empty())
+		for (auto &child : m_children)
 		{
-			return nullptr;
+			m_childIndex->emplace(child->m_name, child.get());
 		}
+	}
+
+	Metadata *Metadata::FindChildWithAttribute(const std::string &childName, const std::string &attribute, const std::string &value, const bool &reportError) const
+	{
+		bool foundName = false;
 
-		for (auto &child : children)
+		for (auto &child : m_children)
 		{
-			std::string attrib = child->FindAttribute(attribute);
+			if (child->m_name != childName)
+			{
+				continue;
+			}
+
+			foundName = true;
+			auto it = child->m_attributes.find(attribute);
 
-			if (attrib == value)
+			if (it != child->m_attributes.end() && (*it).second == value)
 			{
-				return child;
+				return child.get();
 			}
 		}
 
-		if (reportError)
+		if (foundName && reportError)
 		{
 			Log::Error("Could not find child in metadata '%s' with '%s'\n", childName.c_str(), attribute.c_str());
 		}
@@ -147,6 +263,7 @@ namespace acid
 		if (it == m_attributes.end())
 		{
 			m_attributes.emplace(attribute, value);
+			return;
 		}
 
 		(*it).second = value;
@@ -171,7 +288,7 @@ namespace acid
 
 		if (it == m_attributes.end())
 		{
-			return nullptr;
+			return "";
 		}
 
 		return (*it).second;
@@ -179,18 +296,66 @@ namespace acid
 
 	Packet &operator<<(Packet &packet, const Metadata &metadata)
 	{
-		return packet << Serialize::Encode(metadata);
+		// Written as a tree of length prefixed strings, so it can be read back without parsing any text.
+		packet << std::string_view(metadata.m_name) << std::string_view(metadata.m_value);
+		packet << static_cast<uint32_t>(metadata.m_attributes.size());
+
+		for (auto &[attribute, value] : metadata.m_attributes)
+		{
+			packet << std::string_view(attribute) << std::string_view(value);
+		}
+
+		packet << static_cast<uint32_t>(metadata.m_children.size());
+
+		for (auto &child : metadata.m_children)
+		{
+			packet << *child;
+		}
+
+		return packet;
 	}
 
 	Packet &operator>>(Packet &packet, Metadata &metadata)
 	{
-		std::string encoded;
-		packet >> encoded;
-		auto decoded = Serialize::Decode(encoded); // TODO: Remove this work around.
-		metadata.m_name = decoded.m_name;
-		metadata.m_value = decoded.m_value;
-		metadata.m_children = std::move(decoded.m_children);
-		metadata.m_attributes = decoded.m_attributes;
+		Metadata::Read(packet, metadata, 0);
 		return packet;
 	}
+
+	void Metadata::Read(Packet &packet, Metadata &metadata, const uint32_t &depth)
+	{
+		if (depth > MAX_PACKET_DEPTH)
+		{
+			Log::Error("Metadata in packet is nested deeper than %i\n", MAX_PACKET_DEPTH);
+			packet.Invalidate();
+			return;
+		}
+
+		std::string_view name;
+		std::string_view value;
+		packet >> name >> value;
+		metadata.SetName(std::string(name));
+		metadata.m_value = value;
+		metadata.m_attributes.clear();
+		metadata.ClearChildren();
+
+		uint32_t attributeCount = 0;
+		packet >> attributeCount;
+
+		for (uint32_t i = 0; i < attributeCount && packet; i++)
+		{
+			std::string_view attribute;
+			packet >> attribute >> value;
+			metadata.m_attributes.emplace(attribute, value);
+		}
+
+		uint32_t childCount = 0;
+		packet >> childCount;
+
+		for (uint32_t i = 0; i < childCount && packet; i++)
+		{
+			auto child = std::make_unique<Metadata>();
+			Read(packet, *child, depth + 1);
+			metadata.AddChild(child.release());
+		}
+	}
 }
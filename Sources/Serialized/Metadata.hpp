@@ -3,6 +3,8 @@
 #include <string>
 #include <map>
 #include <memory>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 #include "Engine/Exports.hpp"
 #include "Helpers/String.hpp"
@@ -17,10 +19,19 @@ namespace acid
 	class ACID_EXPORT Metadata
 	{
 	protected:
+		/// The number of children a node needs before it keeps a hash index of their names.
+		static const uint32_t INDEX_THRESHOLD;
+		/// The deepest a tree read from a packet may nest, packets come from the network so a malformed one must not exhaust the stack.
+		static const uint32_t MAX_PACKET_DEPTH;
+
 		std::string m_name;
 		std::string m_value;
 		std::vector<std::unique_ptr<Metadata>> m_children;
 		std::map<std::string, std::string> m_attributes;
+		Metadata *m_parent;
+
+		/// First child with each name, kept up to date as children are added, removed and renamed so lookups never write to the tree.
+		std::unique_ptr<std::unordered_map<std::string_view, Metadata *>> m_childIndex;
 	public:
 		Metadata(const std::string &name, const std::string &value, const std::map<std::string, std::string> &attributes);
 
@@ -30,11 +41,11 @@ namespace acid
 
 		Metadata& operator=(const Metadata&) = delete;
 
-		std::string GetName() const { return m_name; }
+		const std::string &GetName() const { return m_name; }
 
-		void SetName(const std::string &name) { m_name = name; }
+		void SetName(const std::string &name);
 
-		std::string GetValue() const { return m_value; }
+		const std::string &GetValue() const { return m_value; }
 
 		void SetValue(const std::string &value) { m_value = value; }
 
@@ -46,7 +57,7 @@ namespace acid
 
 		uint32_t GetChildCount() const { return static_cast<uint32_t>(m_children.size()); }
 
-		void ClearChildren() { m_children.clear(); }
+		void ClearChildren();
 
 		Metadata *AddChild(Metadata *value);
 
@@ -92,8 +103,7 @@ namespace acid
 
 			if (child == nullptr)
 			{
-				child = new Metadata(name, "");
-				m_children.emplace_back(child);
+				child = AddChild(new Metadata(name, ""));
 			}
 
 			child->Set<T>(value);
@@ -135,7 +145,7 @@ namespace acid
 			}
 		}
 
-		std::map<std::string, std::string> GetAttributes() const { return m_attributes; }
+		const std::map<std::string, std::string> &GetAttributes() const { return m_attributes; }
 
 		uint32_t GetAttributeCount() const { return static_cast<uint32_t>(m_attributes.size()); }
 
@@ -150,5 +160,11 @@ namespace acid
 		ACID_EXPORT friend Packet &operator<<(Packet &packet, const Metadata &metadata);
 
 		ACID_EXPORT friend Packet &operator>>(Packet &packet, Metadata &metadata);
+	private:
+		Metadata *FindChildLinear(const std::string_view &name) const;
+
+		void BuildIndex();
+
+		static void Read(Packet &packet, Metadata &metadata, const uint32_t &depth);
 	};
 }
@@ -1,6 +1,7 @@
 #include "RendererShadows.hpp"
 
 #include "Models/VertexModel.hpp"
+#include "Physics/Rigidbody.hpp"
 #include "Scenes/Scenes.hpp"
 #include "ShadowRender.hpp"
 
@@ -30,6 +31,12 @@ namespace acid
 
 		auto sceneShadowRenders = Scenes::Get()->GetStructure()->QueryComponents<ShadowRender>();
 
+		// Casters are culled against the light's box, not the camera, as objects out of view can still cast shadows into it.
+		auto shadowBox = Shadows::Get()->GetShadowBox();
+		Frustum shadowFrustum = Frustum();
+		shadowFrustum.Update(shadowBox.GetLightSpaceTransform(), shadowBox.GetProjectionMatrix());
+		Rigidbody::CullComponents(shadowFrustum, sceneShadowRenders);
+
 		for (auto &shadowRender : sceneShadowRenders)
 		{
 			shadowRender->CmdRender(commandBuffer, m_pipeline, m_uniformScene);
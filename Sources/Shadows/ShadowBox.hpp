@@ -102,6 +102,8 @@ namespace acid
 		/// <returns> {@code true} if the sphere intersects the box. </returns>
 		bool IsInBox(const Vector3 &position, const float &radius) const;
 
+		Matrix4 GetProjectionMatrix() const { return m_projectionMatrix; }
+
 		Matrix4 GetProjectionViewMatrix() const { return m_projectionViewMatrix; }
 
 		/// <summary>
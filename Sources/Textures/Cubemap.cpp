@@ -5,6 +5,7 @@
 #include "Helpers/String.hpp"
 #include "Resources/Resources.hpp"
 #include "Renderer/Buffers/Buffer.hpp"
+#include "Renderer/Renderer.hpp"
 #include "Texture.hpp"
 
 namespace acid
@@ -46,42 +47,38 @@ namespace acid
 		m_width(0),
 		m_height(0),
 		m_image(VK_NULL_HANDLE),
-		m_deviceMemory(VK_NULL_HANDLE),
+		m_deviceMemory(MemoryAllocation()),
 		m_imageView(VK_NULL_HANDLE),
 		m_format(VK_FORMAT_R8G8B8A8_UNORM),
-		m_imageInfo({})
+		m_imageInfo({}),
+		m_upload(0)
 	{
 #if defined(ACID_VERBOSE)
 		auto debugStart = Engine::GetTime();
 #endif
 
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
-
 		auto pixels = Texture::LoadPixels(m_filename, m_fileSuffix, FILE_SIDES, &m_width, &m_height, &m_components);
 
 		m_mipLevels = mipmap ? Texture::GetMipLevels(m_width, m_height) : 1;
 
-		Buffer bufferStaging = Buffer(m_width * m_height * 4 * 6, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-
-		void *data;
-		vkMapMemory(logicalDevice, bufferStaging.GetBufferMemory(), 0, bufferStaging.GetSize(), 0, &data);
-		memcpy(data, pixels, bufferStaging.GetSize());
-		vkUnmapMemory(logicalDevice, bufferStaging.GetBufferMemory());
-
 		Texture::CreateImage(m_image, m_deviceMemory, m_width, m_height, VK_IMAGE_TYPE_2D, m_samples, m_mipLevels, m_format, VK_IMAGE_TILING_OPTIMAL,
 			VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 6);
-		Texture::TransitionImageLayout(m_image, m_format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_mipLevels, 0, 6);
-		Texture::CopyBufferToImage(bufferStaging.GetBuffer(), m_image, m_width, m_height, 0, 6);
 
-		if (mipmap)
+		// All six sides are copied in the same batch as other uploads, frames submitted after it sample the image without waiting here.
+		m_upload = Display::Get()->GetUploadQueue()->Upload(pixels, m_width * m_height * 4 * 6, [&](const VkCommandBuffer &commandBuffer, const VkBuffer &stagingBuffer, const VkDeviceSize &stagingOffset)
 		{
-			Texture::CreateMipmaps(m_image, m_width, m_height, m_imageLayout, m_mipLevels, 0, 6);
-		}
-		else
-		{
-			Texture::TransitionImageLayout(m_image, m_format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_imageLayout, m_mipLevels, 0, 6);
-		}
+			Texture::TransitionImageLayout(commandBuffer, m_image, m_format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_mipLevels, 0, 6);
+			Texture::CopyBufferToImage(commandBuffer, stagingBuffer, stagingOffset, m_image, m_width, m_height, 0, 6);
+
+			if (mipmap)
+			{
+				Texture::CreateMipmaps(commandBuffer, m_image, m_width, m_height, m_imageLayout, m_mipLevels, 0, 6);
+			}
+			else
+			{
+				Texture::TransitionImageLayout(commandBuffer, m_image, m_format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_imageLayout, m_mipLevels, 0, 6);
+			}
+		});
 
 		Texture::CreateImageSampler(m_sampler, m_filter, m_addressMode, m_anisotropic, m_mipLevels);
 		Texture::CreateImageView(m_image, m_imageView,VK_IMAGE_VIEW_TYPE_CUBE, m_format, VK_IMAGE_ASPECT_COLOR_BIT, m_mipLevels, 0, 6);
@@ -114,48 +111,42 @@ namespace acid
 		m_width(width),
 		m_height(height),
 		m_image(VK_NULL_HANDLE),
-		m_deviceMemory(VK_NULL_HANDLE),
+		m_deviceMemory(MemoryAllocation()),
 		m_imageView(VK_NULL_HANDLE),
 		m_format(VK_FORMAT_R8G8B8A8_UNORM),
-		m_imageInfo({})
+		m_imageInfo({}),
+		m_upload(0)
 	{
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
-
 		m_mipLevels = mipmap ? Texture::GetMipLevels(m_width, m_height) : 1;
 
 		Texture::CreateImage(m_image, m_deviceMemory, m_width, m_height, VK_IMAGE_TYPE_2D, m_samples, m_mipLevels, m_format, VK_IMAGE_TILING_OPTIMAL,
 			usage | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 6);
 
-		if (pixels != nullptr || mipmap)
-		{
-			Texture::TransitionImageLayout(m_image, m_format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_mipLevels, 0, 6);
-		}
-
-		if (pixels != nullptr)
+		m_upload = Display::Get()->GetUploadQueue()->Upload(pixels, m_width * m_height * 4 * 6, [&](const VkCommandBuffer &commandBuffer, const VkBuffer &stagingBuffer, const VkDeviceSize &stagingOffset)
 		{
-			Buffer bufferStaging = Buffer(width * height * 4 * 6, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-			                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-
-			void *data;
-			Display::CheckVk(vkMapMemory(logicalDevice, bufferStaging.GetBufferMemory(), 0, bufferStaging.GetSize(), 0, &data));
-			memcpy(data, pixels, bufferStaging.GetSize());
-			vkUnmapMemory(logicalDevice, bufferStaging.GetBufferMemory());
-
-			Texture::CopyBufferToImage(bufferStaging.GetBuffer(), m_image, m_width, m_height, 0, 6);
-		}
-
-		if (mipmap)
-		{
-			Texture::CreateMipmaps(m_image, m_width, m_height, m_imageLayout, m_mipLevels, 0, 6);
-		}
-		else if (pixels != nullptr)
-		{
-			Texture::TransitionImageLayout(m_image, m_format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_imageLayout, m_mipLevels, 0, 6);
-		}
-		else
-		{
-			Texture::TransitionImageLayout(m_image, m_format, VK_IMAGE_LAYOUT_UNDEFINED, m_imageLayout, m_mipLevels, 0, 6);
-		}
+			if (pixels != nullptr || mipmap)
+			{
+				Texture::TransitionImageLayout(commandBuffer, m_image, m_format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_mipLevels, 0, 6);
+			}
+
+			if (pixels != nullptr)
+			{
+				Texture::CopyBufferToImage(commandBuffer, stagingBuffer, stagingOffset, m_image, m_width, m_height, 0, 6);
+			}
+
+			if (mipmap)
+			{
+				Texture::CreateMipmaps(commandBuffer, m_image, m_width, m_height, m_imageLayout, m_mipLevels, 0, 6);
+			}
+			else if (pixels != nullptr)
+			{
+				Texture::TransitionImageLayout(commandBuffer, m_image, m_format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_imageLayout, m_mipLevels, 0, 6);
+			}
+			else
+			{
+				Texture::TransitionImageLayout(commandBuffer, m_image, m_format, VK_IMAGE_LAYOUT_UNDEFINED, m_imageLayout, m_mipLevels, 0, 6);
+			}
+		});
 
 		Texture::CreateImageSampler(m_sampler, m_filter, m_addressMode, m_anisotropic, m_mipLevels);
 		Texture::CreateImageView(m_image, m_imageView, VK_IMAGE_VIEW_TYPE_CUBE, m_format, VK_IMAGE_ASPECT_COLOR_BIT, m_mipLevels, 0, 6);
@@ -168,11 +159,20 @@ namespace acid
 	Cubemap::~Cubemap()
 	{
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
-
-		vkDestroySampler(logicalDevice, m_sampler, nullptr);
-		vkDestroyImageView(logicalDevice, m_imageView, nullptr);
-		vkFreeMemory(logicalDevice, m_deviceMemory, nullptr);
-		vkDestroyImage(logicalDevice, m_image, nullptr);
+		auto memoryAllocator = Display::Get()->GetMemoryAllocator();
+		auto sampler = m_sampler;
+		auto imageView = m_imageView;
+		auto deviceMemory = m_deviceMemory;
+		auto image = m_image;
+
+		// Frames still in flight may sample from the image.
+		Renderer::Defer([logicalDevice, memoryAllocator, sampler, imageView, deviceMemory, image]()
+		{
+			vkDestroySampler(logicalDevice, sampler, nullptr);
+			vkDestroyImageView(logicalDevice, imageView, nullptr);
+			vkDestroyImage(logicalDevice, image, nullptr);
+			memoryAllocator->Free(deviceMemory);
+		});
 	}
 
 	DescriptorType Cubemap::CreateDescriptor(const uint32_t &binding, const VkDescriptorType &descriptorType, const VkShaderStageFlags &stage, const uint32_t &count)
@@ -210,7 +210,10 @@ namespace acid
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 
 		VkImage dstImage;
-		VkDeviceMemory dstImageMemory;
+		MemoryAllocation dstImageMemory;
+
+		// The copy is read on the host, so the upload writing the image must have finished first.
+		Display::Get()->GetUploadQueue()->Wait(m_upload);
 		Texture::CopyImage(m_image, dstImage, dstImageMemory, m_width, m_height, false, arrayLayer, 6);
 
 		VkImageSubresource imageSubresource = {};
@@ -223,13 +226,10 @@ namespace acid
 
 		uint8_t *result = new uint8_t[subresourceLayout.size];
 
-		void *data;
-		vkMapMemory(logicalDevice, dstImageMemory, subresourceLayout.offset, subresourceLayout.size, 0, &data);
-		memcpy(result, data, static_cast<size_t>(subresourceLayout.size));
-		vkUnmapMemory(logicalDevice, dstImageMemory);
+		memcpy(result, dstImageMemory.m_mapped + subresourceLayout.offset, static_cast<size_t>(subresourceLayout.size));
 
-		vkFreeMemory(logicalDevice, dstImageMemory, nullptr);
 		vkDestroyImage(logicalDevice, dstImage, nullptr);
+		Display::Get()->GetMemoryAllocator()->Free(dstImageMemory);
 
 		return result;
 	}
@@ -249,14 +249,21 @@ namespace acid
 
 	void Cubemap::SetPixels(uint8_t *pixels)
 	{
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
-
-		Buffer bufferStaging = Buffer(m_width * m_height * 4 * 6, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-		                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-
-		void *data;
-		vkMapMemory(logicalDevice, bufferStaging.GetBufferMemory(), 0, bufferStaging.GetSize(), 0, &data);
-		memcpy(data, pixels, bufferStaging.GetSize());
-		vkUnmapMemory(logicalDevice, bufferStaging.GetBufferMemory());
+		m_upload = Display::Get()->GetUploadQueue()->Upload(pixels, m_width * m_height * 4 * 6, [this](const VkCommandBuffer &commandBuffer, const VkBuffer &stagingBuffer, const VkDeviceSize &stagingOffset)
+		{
+			// Frames submitted before may still sample the old pixels, they are discarded once those frames are done with them.
+			Texture::InsertImageMemoryBarrier(commandBuffer, m_image, 0, VK_ACCESS_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+				VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, 0, m_mipLevels, 0, 6});
+			Texture::CopyBufferToImage(commandBuffer, stagingBuffer, stagingOffset, m_image, m_width, m_height, 0, 6);
+
+			if (m_mipLevels > 1)
+			{
+				Texture::CreateMipmaps(commandBuffer, m_image, m_width, m_height, m_imageLayout, m_mipLevels, 0, 6);
+			}
+			else
+			{
+				Texture::TransitionImageLayout(commandBuffer, m_image, m_format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_imageLayout, m_mipLevels, 0, 6);
+			}
+		});
 	}
 }
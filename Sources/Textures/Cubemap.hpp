@@ -3,7 +3,9 @@
 #include <string>
 #include <vector>
 #include <vulkan/vulkan.h>
+#include "Renderer/Commands/UploadQueue.hpp"
 #include "Renderer/Descriptors/IDescriptor.hpp"
+#include "Renderer/Memory/MemoryAllocator.hpp"
 #include "Resources/IResource.hpp"
 
 namespace acid
@@ -32,12 +34,13 @@ namespace acid
 		uint32_t m_width, m_height;
 
 		VkImage m_image;
-		VkDeviceMemory m_deviceMemory;
+		MemoryAllocation m_deviceMemory;
 		VkImageView m_imageView;
 		VkSampler m_sampler;
 		VkFormat m_format;
 
 		VkDescriptorImageInfo m_imageInfo;
+		UploadHandle m_upload;
 	public:
 		/// <summary>
 		/// Will find an existing cubemap with the same filename, or create a new cubemap.
@@ -123,6 +126,12 @@ namespace acid
 
 		uint32_t GetHeight() const { return m_height; }
 
+		/// <summary>
+		/// Gets the last upload to the image, frames read the image after it without waiting, anything reading it on the host waits on it first.
+		/// </summary>
+		/// <returns> The upload handle. </returns>
+		UploadHandle GetUpload() const { return m_upload; }
+
 		VkImage GetImage() const { return m_image; }
 
 		VkImageView GetImageView() const { return m_imageView; }
@@ -5,6 +5,7 @@
 #include "Helpers/FileSystem.hpp"
 #include "Files/Files.hpp"
 #include "Renderer/Buffers/Buffer.hpp"
+#include "Renderer/Renderer.hpp"
 #include "Resources/Resources.hpp"
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
@@ -23,16 +24,8 @@ namespace acid
 			return nullptr;
 		}
 
-		auto resource = Resources::Get()->Get(filename);
-
-		if (resource != nullptr)
-		{
-			return std::dynamic_pointer_cast<Texture>(resource);
-		}
-
-		auto result = std::make_shared<Texture>(filename);
-		Resources::Get()->Add(std::dynamic_pointer_cast<IResource>(result));
-		return result;
+		// Goes through the loader so threads asking for the same file at once share one load.
+		return Resources::Get()->Wait(Resources::Get()->Load<Texture>(filename));
 	}
 
 	Texture::Texture(const std::string &filename, const VkFilter &filter, const VkSamplerAddressMode &addressMode, const bool &anisotropic, const bool &mipmap) :
@@ -49,42 +42,38 @@ namespace acid
 		m_width(0),
 		m_height(0),
 		m_image(VK_NULL_HANDLE),
-		m_deviceMemory(VK_NULL_HANDLE),
+		m_deviceMemory(MemoryAllocation()),
 		m_imageView(VK_NULL_HANDLE),
 		m_format(VK_FORMAT_R8G8B8A8_UNORM),
-		m_imageInfo({})
+		m_imageInfo({}),
+		m_upload(0)
 	{
 #if defined(ACID_VERBOSE)
 		auto debugStart = Engine::GetTime();
 #endif
 
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
-
 		auto pixels = LoadPixels(m_filename, &m_width, &m_height, &m_components);
 
 		m_mipLevels = mipmap ? GetMipLevels(m_width, m_height) : 1;
 
-		Buffer bufferStaging = Buffer(m_width * m_height * 4, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-
-		void *data;
-		vkMapMemory(logicalDevice, bufferStaging.GetBufferMemory(), 0, bufferStaging.GetSize(), 0, &data);
-		memcpy(data, pixels, bufferStaging.GetSize());
-		vkUnmapMemory(logicalDevice, bufferStaging.GetBufferMemory());
-
 		CreateImage(m_image, m_deviceMemory, m_width, m_height, VK_IMAGE_TYPE_2D, m_samples, m_mipLevels, m_format, VK_IMAGE_TILING_OPTIMAL,
 			VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 1);
-		TransitionImageLayout(m_image, m_format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_mipLevels, 0, 1);
-		CopyBufferToImage(bufferStaging.GetBuffer(), m_image, m_width, m_height, 0, 1);
 
-		if (mipmap)
+		// The copy is batched with other uploads, frames submitted after it sample the image without waiting here.
+		m_upload = Display::Get()->GetUploadQueue()->Upload(pixels, m_width * m_height * 4, [&](const VkCommandBuffer &commandBuffer, const VkBuffer &stagingBuffer, const VkDeviceSize &stagingOffset)
 		{
-			CreateMipmaps(m_image, m_width, m_height, m_imageLayout, m_mipLevels, 0, 1);
-		}
-		else
-		{
-			TransitionImageLayout(m_image, m_format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_imageLayout, m_mipLevels, 0, 1);
-		}
+			TransitionImageLayout(commandBuffer, m_image, m_format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_mipLevels, 0, 1);
+			CopyBufferToImage(commandBuffer, stagingBuffer, stagingOffset, m_image, m_width, m_height, 0, 1);
+
+			if (mipmap)
+			{
+				CreateMipmaps(commandBuffer, m_image, m_width, m_height, m_imageLayout, m_mipLevels, 0, 1);
+			}
+			else
+			{
+				TransitionImageLayout(commandBuffer, m_image, m_format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_imageLayout, m_mipLevels, 0, 1);
+			}
+		});
 
 		CreateImageSampler(m_sampler, m_filter, m_addressMode, m_anisotropic, m_mipLevels);
 		CreateImageView(m_image, m_imageView, VK_IMAGE_VIEW_TYPE_2D, m_format, VK_IMAGE_ASPECT_COLOR_BIT, m_mipLevels, 0, 1);
@@ -117,49 +106,43 @@ namespace acid
 		m_width(width),
 		m_height(height),
 		m_image(VK_NULL_HANDLE),
-		m_deviceMemory(VK_NULL_HANDLE),
+		m_deviceMemory(MemoryAllocation()),
 		m_imageView(VK_NULL_HANDLE),
 		m_sampler(VK_NULL_HANDLE),
 		m_format(format),
-		m_imageInfo({})
+		m_imageInfo({}),
+		m_upload(0)
 	{
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
-
 		m_mipLevels = mipmap ? GetMipLevels(m_width, m_height) : 1;
 
 		CreateImage(m_image, m_deviceMemory, m_width, m_height, VK_IMAGE_TYPE_2D, m_samples, m_mipLevels, m_format, VK_IMAGE_TILING_OPTIMAL,
 		            usage | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 1);
 
-		if (pixels != nullptr || mipmap)
-		{
-			TransitionImageLayout(m_image, m_format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_mipLevels, 0, 1);
-		}
-
-		if (pixels != nullptr)
+		m_upload = Display::Get()->GetUploadQueue()->Upload(pixels, m_width * m_height * 4, [&](const VkCommandBuffer &commandBuffer, const VkBuffer &stagingBuffer, const VkDeviceSize &stagingOffset)
 		{
-			Buffer bufferStaging = Buffer(m_width * m_height * 4, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-			                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-
-			void *data;
-			Display::CheckVk(vkMapMemory(logicalDevice, bufferStaging.GetBufferMemory(), 0, bufferStaging.GetSize(), 0, &data));
-			memcpy(data, pixels, bufferStaging.GetSize());
-			vkUnmapMemory(logicalDevice, bufferStaging.GetBufferMemory());
+			if (pixels != nullptr || mipmap)
+			{
+				TransitionImageLayout(commandBuffer, m_image, m_format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_mipLevels, 0, 1);
+			}
 
-			CopyBufferToImage(bufferStaging.GetBuffer(), m_image, m_width, m_height, 0, 1);
-		}
+			if (pixels != nullptr)
+			{
+				CopyBufferToImage(commandBuffer, stagingBuffer, stagingOffset, m_image, m_width, m_height, 0, 1);
+			}
 
-		if (mipmap)
-		{
-			CreateMipmaps(m_image, m_width, m_height, m_imageLayout, m_mipLevels, 0, 1);
-		}
-		else if (pixels != nullptr)
-		{
-			TransitionImageLayout(m_image, m_format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_imageLayout, m_mipLevels, 0, 1);
-		}
-		else
-		{
-			TransitionImageLayout(m_image, m_format, VK_IMAGE_LAYOUT_UNDEFINED, m_imageLayout, m_mipLevels, 0, 1);
-		}
+			if (mipmap)
+			{
+				CreateMipmaps(commandBuffer, m_image, m_width, m_height, m_imageLayout, m_mipLevels, 0, 1);
+			}
+			else if (pixels != nullptr)
+			{
+				TransitionImageLayout(commandBuffer, m_image, m_format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_imageLayout, m_mipLevels, 0, 1);
+			}
+			else
+			{
+				TransitionImageLayout(commandBuffer, m_image, m_format, VK_IMAGE_LAYOUT_UNDEFINED, m_imageLayout, m_mipLevels, 0, 1);
+			}
+		});
 
 		CreateImageSampler(m_sampler, m_filter, m_addressMode, m_anisotropic, m_mipLevels);
 		CreateImageView(m_image, m_imageView, VK_IMAGE_VIEW_TYPE_2D, m_format, VK_IMAGE_ASPECT_COLOR_BIT, m_mipLevels, 0, 1);
@@ -172,11 +155,20 @@ namespace acid
 	Texture::~Texture()
 	{
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
-
-		vkDestroySampler(logicalDevice, m_sampler, nullptr);
-		vkDestroyImageView(logicalDevice, m_imageView, nullptr);
-		vkFreeMemory(logicalDevice, m_deviceMemory, nullptr);
-		vkDestroyImage(logicalDevice, m_image, nullptr);
+		auto memoryAllocator = Display::Get()->GetMemoryAllocator();
+		auto sampler = m_sampler;
+		auto imageView = m_imageView;
+		auto deviceMemory = m_deviceMemory;
+		auto image = m_image;
+
+		// Frames still in flight may sample from the image.
+		Renderer::Defer([logicalDevice, memoryAllocator, sampler, imageView, deviceMemory, image]()
+		{
+			vkDestroySampler(logicalDevice, sampler, nullptr);
+			vkDestroyImageView(logicalDevice, imageView, nullptr);
+			vkDestroyImage(logicalDevice, image, nullptr);
+			memoryAllocator->Free(deviceMemory);
+		});
 	}
 
 	DescriptorType Texture::CreateDescriptor(const uint32_t &binding, const VkDescriptorType &descriptorType, const VkShaderStageFlags &stage, const uint32_t &count)
@@ -214,7 +206,10 @@ namespace acid
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 
 		VkImage dstImage;
-		VkDeviceMemory dstImageMemory;
+		MemoryAllocation dstImageMemory;
+
+		// The copy is read on the host, so the upload writing the image must have finished first.
+		Display::Get()->GetUploadQueue()->Wait(m_upload);
 		CopyImage(m_image, dstImage, dstImageMemory, m_width, m_height, false, 0, 1);
 
 		VkImageSubresource imageSubresource = {};
@@ -227,35 +222,39 @@ namespace acid
 
 		uint8_t *result = new uint8_t[subresourceLayout.size];
 
-		void *data;
-		vkMapMemory(logicalDevice, dstImageMemory, subresourceLayout.offset, subresourceLayout.size, 0, &data);
-		memcpy(result, data, static_cast<size_t>(subresourceLayout.size));
-		vkUnmapMemory(logicalDevice, dstImageMemory);
+		memcpy(result, dstImageMemory.m_mapped + subresourceLayout.offset, static_cast<size_t>(subresourceLayout.size));
 
-		vkFreeMemory(logicalDevice, dstImageMemory, nullptr);
 		vkDestroyImage(logicalDevice, dstImage, nullptr);
+		Display::Get()->GetMemoryAllocator()->Free(dstImageMemory);
 
 		return result;
 	}
 
 	void Texture::SetPixels(uint8_t *pixels)
 	{
-		auto logicalDevice = Display::Get()->GetLogicalDevice();
-
-		Buffer bufferStaging = Buffer(m_width * m_height * 4, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+		m_upload = Display::Get()->GetUploadQueue()->Upload(pixels, m_width * m_height * 4, [this](const VkCommandBuffer &commandBuffer, const VkBuffer &stagingBuffer, const VkDeviceSize &stagingOffset)
+		{
+			// Frames submitted before may still sample the old pixels, they are discarded once those frames are done with them.
+			InsertImageMemoryBarrier(commandBuffer, m_image, 0, VK_ACCESS_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+				VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, 0, m_mipLevels, 0, 1});
+			CopyBufferToImage(commandBuffer, stagingBuffer, stagingOffset, m_image, m_width, m_height, 0, 1);
 
-		void *data;
-		vkMapMemory(logicalDevice, bufferStaging.GetBufferMemory(), 0, bufferStaging.GetSize(), 0, &data);
-		memcpy(data, pixels, bufferStaging.GetSize());
-		vkUnmapMemory(logicalDevice, bufferStaging.GetBufferMemory());
+			if (m_mipLevels > 1)
+			{
+				CreateMipmaps(commandBuffer, m_image, m_width, m_height, m_imageLayout, m_mipLevels, 0, 1);
+			}
+			else
+			{
+				TransitionImageLayout(commandBuffer, m_image, m_format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_imageLayout, m_mipLevels, 0, 1);
+			}
+		});
 	}
 
 	uint8_t *Texture::LoadPixels(const std::string &filename, uint32_t *width, uint32_t *height, uint32_t *components)
 	{
-		auto fileLoaded = Files::Read(filename);
+		auto fileLoaded = Files::ReadBuffer(filename);
 
-		if (!fileLoaded)
+		if (fileLoaded == nullptr)
 		{
 			if (filename == FALLBACK_PATH)
 			{
@@ -266,7 +265,7 @@ namespace acid
 			return LoadPixels(FALLBACK_PATH, width, height, components);
 		}
 
-		stbi_uc *data = stbi_load_from_memory((uint8_t*)fileLoaded->data(), (uint32_t)fileLoaded->size(), (int32_t *)width, (int32_t *)height, (int32_t *)components, STBI_rgb_alpha);
+		stbi_uc *data = stbi_load_from_memory((uint8_t*)fileLoaded->GetData(), (uint32_t)fileLoaded->GetSize(), (int32_t *)width, (int32_t *)height, (int32_t *)components, STBI_rgb_alpha);
 
 		if (data == nullptr)
 		{
@@ -317,7 +316,7 @@ namespace acid
 		return static_cast<uint32_t>(std::floor(std::log2(std::max(width, height))) + 1);
 	}
 
-	void Texture::CreateImage(VkImage &image, VkDeviceMemory &imageMemory, const uint32_t &width, const uint32_t &height, const VkImageType &type, const VkSampleCountFlagBits &samples, const uint32_t &mipLevels, const VkFormat &format, const VkImageTiling &tiling, const VkImageUsageFlags &usage, const VkMemoryPropertyFlags &properties, const uint32_t &arrayLayers)
+	void Texture::CreateImage(VkImage &image, MemoryAllocation &imageMemory, const uint32_t &width, const uint32_t &height, const VkImageType &type, const VkSampleCountFlagBits &samples, const uint32_t &mipLevels, const VkFormat &format, const VkImageTiling &tiling, const VkImageUsageFlags &usage, const VkMemoryPropertyFlags &properties, const uint32_t &arrayLayers)
 	{
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 
@@ -339,17 +338,7 @@ namespace acid
 
 		Display::CheckVk(vkCreateImage(logicalDevice, &imageCreateInfo, nullptr, &image));
 
-		VkMemoryRequirements memoryRequirements;
-		vkGetImageMemoryRequirements(logicalDevice, image, &memoryRequirements);
-
-		VkMemoryAllocateInfo memoryAllocateInfo = {};
-		memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-		memoryAllocateInfo.allocationSize = memoryRequirements.size;
-		memoryAllocateInfo.memoryTypeIndex = Buffer::FindMemoryType(memoryRequirements.memoryTypeBits, properties);
-
-		Display::CheckVk(vkAllocateMemory(logicalDevice, &memoryAllocateInfo, nullptr, &imageMemory));
-
-		Display::CheckVk(vkBindImageMemory(logicalDevice, image, imageMemory, 0));
+		imageMemory = Display::Get()->GetMemoryAllocator()->AllocateImage(image, properties, tiling == VK_IMAGE_TILING_LINEAR);
 	}
 
 	bool Texture::HasStencilComponent(const VkFormat &format)
@@ -357,10 +346,8 @@ namespace acid
 		return format == VK_FORMAT_D32_SFLOAT_S8_UINT || format == VK_FORMAT_D24_UNORM_S8_UINT;
 	}
 
-	void Texture::TransitionImageLayout(const VkImage &image, const VkFormat &format, const VkImageLayout &srcImageLayout, const VkImageLayout &dstImageLayout, const uint32_t &mipLevels, const uint32_t &baseArrayLayer, const uint32_t &layerCount)
+	void Texture::TransitionImageLayout(const VkCommandBuffer &commandBuffer, const VkImage &image, const VkFormat &format, const VkImageLayout &srcImageLayout, const VkImageLayout &dstImageLayout, const uint32_t &mipLevels, const uint32_t &baseArrayLayer, const uint32_t &layerCount)
 	{
-		CommandBuffer commandBuffer = CommandBuffer();
-
 		VkImageMemoryBarrier imageMemoryBarrier = {};
 		imageMemoryBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
 		imageMemoryBarrier.oldLayout = srcImageLayout;
@@ -436,18 +423,13 @@ namespace acid
 			assert(false && "Unsupported image layout transition!");
 		}
 
-		vkCmdPipelineBarrier(commandBuffer.GetCommandBuffer(), srcStageMask, dstStageMask, 0, 0, nullptr, 0, nullptr, 1, &imageMemoryBarrier);
-
-		commandBuffer.End();
-		commandBuffer.Submit();
+		vkCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, 0, 0, nullptr, 0, nullptr, 1, &imageMemoryBarrier);
 	}
 
-	void Texture::CopyBufferToImage(const VkBuffer &buffer, const VkImage &image, const uint32_t &width, const uint32_t &height, const uint32_t &baseArrayLayer, const uint32_t &layerCount)
+	void Texture::CopyBufferToImage(const VkCommandBuffer &commandBuffer, const VkBuffer &buffer, const VkDeviceSize &bufferOffset, const VkImage &image, const uint32_t &width, const uint32_t &height, const uint32_t &baseArrayLayer, const uint32_t &layerCount)
 	{
-		CommandBuffer commandBuffer = CommandBuffer();
-
 		VkBufferImageCopy region = {};
-		region.bufferOffset = 0;
+		region.bufferOffset = bufferOffset;
 		region.bufferRowLength = 0;
 		region.bufferImageHeight = 0;
 		region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
@@ -457,16 +439,11 @@ namespace acid
 		region.imageOffset = {0, 0, 0};
 		region.imageExtent = {width, height, 1};
 
-		vkCmdCopyBufferToImage(commandBuffer.GetCommandBuffer(), buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
-
-		commandBuffer.End();
-		commandBuffer.Submit();
+		vkCmdCopyBufferToImage(commandBuffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
 	}
 
-	void Texture::CreateMipmaps(const VkImage &image, const uint32_t &width, const uint32_t &height, const VkImageLayout &dstImageLayout, const uint32_t &mipLevels, const uint32_t &baseArrayLayer, const uint32_t &layerCount)
+	void Texture::CreateMipmaps(const VkCommandBuffer &commandBuffer, const VkImage &image, const uint32_t &width, const uint32_t &height, const VkImageLayout &dstImageLayout, const uint32_t &mipLevels, const uint32_t &baseArrayLayer, const uint32_t &layerCount)
 	{
-		CommandBuffer commandBuffer = CommandBuffer();
-
 		VkImageMemoryBarrier barrier = {};
 		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
 		barrier.image = image;
@@ -488,7 +465,7 @@ namespace acid
 			barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
 			barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
 
-			vkCmdPipelineBarrier(commandBuffer.GetCommandBuffer(),
+			vkCmdPipelineBarrier(commandBuffer,
 				VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
 				0, nullptr,
 				0, nullptr,
@@ -508,7 +485,7 @@ namespace acid
 			imageBlit.dstSubresource.baseArrayLayer = baseArrayLayer;
 			imageBlit.dstSubresource.layerCount = layerCount;
 
-			vkCmdBlitImage(commandBuffer.GetCommandBuffer(),
+			vkCmdBlitImage(commandBuffer,
 				image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
 				image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
 				1, &imageBlit,
@@ -519,7 +496,7 @@ namespace acid
 			barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
 			barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
 
-			vkCmdPipelineBarrier(commandBuffer.GetCommandBuffer(),
+			vkCmdPipelineBarrier(commandBuffer,
 				VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
 				0, nullptr,
 				0, nullptr,
@@ -542,14 +519,11 @@ namespace acid
 		barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
 		barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
 
-		vkCmdPipelineBarrier(commandBuffer.GetCommandBuffer(),
+		vkCmdPipelineBarrier(commandBuffer,
 			VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
 			0, nullptr,
 			0, nullptr,
 			1, &barrier);
-
-		commandBuffer.End();
-		commandBuffer.Submit();
 	}
 
 	void Texture::CreateImageSampler(VkSampler &sampler, const VkFilter &filter, const VkSamplerAddressMode &addressMode, const bool &anisotropic, const uint32_t &mipLevels)
@@ -600,7 +574,7 @@ namespace acid
 		Display::CheckVk(vkCreateImageView(logicalDevice, &imageViewCreateInfo, nullptr, &imageView));
 	}
 
-	bool Texture::CopyImage(const VkImage &srcImage, VkImage &dstImage, VkDeviceMemory &dstImageMemory, const uint32_t &width, const uint32_t &height, const bool &srcSwapchain, const uint32_t &baseArrayLayer, const uint32_t &layerCount)
+	bool Texture::CopyImage(const VkImage &srcImage, VkImage &dstImage, MemoryAllocation &dstImageMemory, const uint32_t &width, const uint32_t &height, const bool &srcSwapchain, const uint32_t &baseArrayLayer, const uint32_t &layerCount)
 	{
 		auto physicalDevice = Display::Get()->GetPhysicalDevice();
 		auto surfaceFormat = Display::Get()->GetSurfaceFormat();
@@ -651,7 +625,7 @@ namespace acid
 				srcImage,
 				VK_ACCESS_MEMORY_READ_BIT,
 				VK_ACCESS_TRANSFER_READ_BIT,
-				VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
+				Swapchain::GetPresentLayout(),
 				VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
 				VK_PIPELINE_STAGE_TRANSFER_BIT,
 				VK_PIPELINE_STAGE_TRANSFER_BIT,
@@ -715,7 +689,7 @@ namespace acid
 				VK_ACCESS_TRANSFER_READ_BIT,
 				VK_ACCESS_MEMORY_READ_BIT,
 				VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-				VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
+				Swapchain::GetPresentLayout(),
 				VK_PIPELINE_STAGE_TRANSFER_BIT,
 				VK_PIPELINE_STAGE_TRANSFER_BIT,
 				VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, baseArrayLayer, layerCount});
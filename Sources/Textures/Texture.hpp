@@ -3,7 +3,9 @@
 #include <string>
 #include <vector>
 #include <vulkan/vulkan.h>
+#include "Renderer/Commands/UploadQueue.hpp"
 #include "Renderer/Descriptors/IDescriptor.hpp"
+#include "Renderer/Memory/MemoryAllocator.hpp"
 #include "Resources/IResource.hpp"
 
 namespace acid
@@ -29,12 +31,13 @@ namespace acid
 		uint32_t m_width, m_height;
 
 		VkImage m_image;
-		VkDeviceMemory m_deviceMemory;
+		MemoryAllocation m_deviceMemory;
 		VkImageView m_imageView;
 		VkSampler m_sampler;
 		VkFormat m_format;
 
 		VkDescriptorImageInfo m_imageInfo;
+		UploadHandle m_upload;
 	public:
 		/// <summary>
 		/// Will find an existing texture with the same filename, or create a new texture.
@@ -109,9 +112,15 @@ namespace acid
 
 		uint32_t GetHeight() const { return m_height; }
 
+		/// <summary>
+		/// Gets the last upload to the image, frames read the image after it without waiting, anything reading it on the host waits on it first.
+		/// </summary>
+		/// <returns> The upload handle. </returns>
+		UploadHandle GetUpload() const { return m_upload; }
+
 		VkImage &GetImage() { return m_image; }
 
-		VkDeviceMemory &GetDeviceMemory() { return m_deviceMemory; }
+		const MemoryAllocation &GetDeviceMemory() const { return m_deviceMemory; }
 
 		VkImageView GetImageView() const { return m_imageView; }
 
@@ -127,21 +136,21 @@ namespace acid
 
 		static uint32_t GetMipLevels(const uint32_t &width, const uint32_t &height);
 
-		static void CreateImage(VkImage &image, VkDeviceMemory &imageMemory, const uint32_t &width, const uint32_t &height, const VkImageType &type, const VkSampleCountFlagBits &samples, const uint32_t &mipLevels, const VkFormat &format, const VkImageTiling &tiling, const VkImageUsageFlags &usage, const VkMemoryPropertyFlags &properties, const uint32_t &arrayLayers);
+		static void CreateImage(VkImage &image, MemoryAllocation &imageMemory, const uint32_t &width, const uint32_t &height, const VkImageType &type, const VkSampleCountFlagBits &samples, const uint32_t &mipLevels, const VkFormat &format, const VkImageTiling &tiling, const VkImageUsageFlags &usage, const VkMemoryPropertyFlags &properties, const uint32_t &arrayLayers);
 
 		static bool HasStencilComponent(const VkFormat &format);
 
-		static void TransitionImageLayout(const VkImage &image, const VkFormat &format, const VkImageLayout &srcImageLayout, const VkImageLayout &dstImageLayout, const uint32_t &mipLevels, const uint32_t &baseArrayLayer, const uint32_t &layerCount);
+		static void TransitionImageLayout(const VkCommandBuffer &commandBuffer, const VkImage &image, const VkFormat &format, const VkImageLayout &srcImageLayout, const VkImageLayout &dstImageLayout, const uint32_t &mipLevels, const uint32_t &baseArrayLayer, const uint32_t &layerCount);
 
-		static void CopyBufferToImage(const VkBuffer &buffer, const VkImage &image, const uint32_t &width, const uint32_t &height, const uint32_t &baseArrayLayer, const uint32_t &layerCount);
+		static void CopyBufferToImage(const VkCommandBuffer &commandBuffer, const VkBuffer &buffer, const VkDeviceSize &bufferOffset, const VkImage &image, const uint32_t &width, const uint32_t &height, const uint32_t &baseArrayLayer, const uint32_t &layerCount);
 
-		static void CreateMipmaps(const VkImage &image, const uint32_t &width, const uint32_t &height, const VkImageLayout &dstImageLayout, const uint32_t &mipLevels, const uint32_t &baseArrayLayer, const uint32_t &layerCount);
+		static void CreateMipmaps(const VkCommandBuffer &commandBuffer, const VkImage &image, const uint32_t &width, const uint32_t &height, const VkImageLayout &dstImageLayout, const uint32_t &mipLevels, const uint32_t &baseArrayLayer, const uint32_t &layerCount);
 
 		static void CreateImageSampler(VkSampler &sampler, const VkFilter &filter, const VkSamplerAddressMode &addressMode, const bool &anisotropic, const uint32_t &mipLevels);
 
 		static void CreateImageView(const VkImage &image, VkImageView &imageView, const VkImageViewType &type, const VkFormat &format, const VkImageAspectFlags &imageAspect, const uint32_t &mipLevels, const uint32_t &baseArrayLayer, const uint32_t &layerCount);
 
-		static bool CopyImage(const VkImage &srcImage, VkImage &dstImage, VkDeviceMemory &dstImageMemory, const uint32_t &width, const uint32_t &height, const bool &srcSwapchain, const uint32_t &baseArrayLayer, const uint32_t &layerCount);
+		static bool CopyImage(const VkImage &srcImage, VkImage &dstImage, MemoryAllocation &dstImageMemory, const uint32_t &width, const uint32_t &height, const bool &srcSwapchain, const uint32_t &baseArrayLayer, const uint32_t &layerCount);
 
 		static void InsertImageMemoryBarrier(const VkCommandBuffer &cmdbuffer, const VkImage &image, const VkAccessFlags &srcAccessMask,
 											 const VkAccessFlags &dstAccessMask, const VkImageLayout &oldImageLayout, const VkImageLayout &newImageLayout,
@@ -0,0 +1,20 @@
+#include "Job.hpp"
+
+namespace acid
+{
+	Job::Job(std::function<void()> function, const std::shared_ptr<Job> &parent) :
+		m_function(std::move(function)),
+		m_parent(parent),
+		m_unfinished(1),
+		m_dependencies(1),
+		m_continuationMutex(),
+		m_continuations(std::vector<std::shared_ptr<Job>>()),
+		m_completed(false),
+		m_keepAlive(nullptr)
+	{
+		if (m_parent != nullptr)
+		{
+			m_parent->m_unfinished.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	class ThreadPool;
+
+	/// <summary>
+	/// A unit of work scheduled on a <seealso cref="ThreadPool"/>.
+	/// A job is finished once its function and all of its child jobs have completed,
+	/// and is only started once all jobs it depends on have finished.
+	/// </summary>
+	class ACID_EXPORT Job
+	{
+	private:
+		friend class ThreadPool;
+
+		std::function<void()> m_function;
+		std::shared_ptr<Job> m_parent;
+		std::atomic<int32_t> m_unfinished;
+		std::atomic<int32_t> m_dependencies;
+
+		std::mutex m_continuationMutex;
+		std::vector<std::shared_ptr<Job>> m_continuations;
+		bool m_completed;
+
+		std::shared_ptr<Job> m_keepAlive;
+	public:
+		/// <summary>
+		/// Creates a new job, use <seealso cref="ThreadPool#CreateJob"/> instead.
+		/// </summary>
+		/// <param name="function"> The function to run, can be null for grouping jobs. </param>
+		/// <param name="parent"> The parent job that will not finish until this job has finished. </param>
+		Job(std::function<void()> function, const std::shared_ptr<Job> &parent);
+
+		Job(const Job&) = delete;
+
+		Job& operator=(const Job&) = delete;
+
+		/// <summary>
+		/// Gets if the job and all of its children have finished.
+		/// </summary>
+		/// <returns> If the job is finished. </returns>
+		bool IsFinished() const { return m_unfinished.load(std::memory_order_acquire) <= 0; }
+
+		Job *GetParent() const { return m_parent.get(); }
+	};
+}
@@ -4,19 +4,300 @@ namespace acid
 {
 	const uint32_t ThreadPool::HARDWARE_CONCURRENCY = std::thread::hardware_concurrency();
 
-	ThreadPool::ThreadPool(const uint32_t &threadCount)
+	static thread_local const ThreadPool *CURRENT_POOL = nullptr;
+	static thread_local int32_t CURRENT_INDEX = -1;
+
+	ThreadPool::ThreadPool(const uint32_t &threadCount) :
+		m_workers(std::vector<std::thread>()),
+		m_queues(std::vector<std::unique_ptr<WorkStealingDeque<Job *>>>()),
+		m_injectedMutex(),
+		m_injected(std::deque<Job *>()),
+		m_sleepMutex(),
+		m_condition(),
+		m_queued(0),
+		m_active(0),
+		m_waiting(0),
+		m_destroying(false)
 	{
 		for (uint32_t i = 0; i < threadCount; i++)
 		{
-			m_threads.emplace_back(std::make_unique<Thread>());
+			m_queues.emplace_back(std::make_unique<WorkStealingDeque<Job *>>());
+		}
+
+		for (uint32_t i = 0; i < threadCount; i++)
+		{
+			m_workers.emplace_back(std::thread(&ThreadPool::WorkerLoop, this, i));
+		}
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		Wait();
+
+		{
+			std::lock_guard<std::mutex> lock(m_sleepMutex);
+			m_destroying = true;
+		}
+
+		m_condition.notify_all();
+
+		for (auto &worker : m_workers)
+		{
+			worker.join();
+		}
+	}
+
+	std::shared_ptr<Job> ThreadPool::CreateJob(std::function<void()> function, const std::shared_ptr<Job> &parent)
+	{
+		return std::make_shared<Job>(std::move(function), parent);
+	}
+
+	void ThreadPool::AddDependency(const std::shared_ptr<Job> &job, const std::shared_ptr<Job> &dependency)
+	{
+		job->m_dependencies.fetch_add(1, std::memory_order_relaxed);
+
+		{
+			std::lock_guard<std::mutex> lock(dependency->m_continuationMutex);
+
+			if (!dependency->m_completed)
+			{
+				dependency->m_continuations.emplace_back(job);
+				return;
+			}
 		}
+
+		// The dependency has already finished.
+		ReleaseDependency(job.get());
+	}
+
+	void ThreadPool::Run(const std::shared_ptr<Job> &job)
+	{
+		job->m_keepAlive = job;
+		ReleaseDependency(job.get());
+	}
+
+	std::shared_ptr<Job> ThreadPool::Schedule(std::function<void()> function, const std::shared_ptr<Job> &parent)
+	{
+		auto job = CreateJob(std::move(function), parent);
+		Run(job);
+		return job;
+	}
+
+	void ThreadPool::Wait(const std::shared_ptr<Job> &job)
+	{
+		WaitUntil([&job]()
+		{
+			return job->IsFinished();
+		});
 	}
 
 	void ThreadPool::Wait()
 	{
-		for (auto &thread : m_threads)
+		WaitUntil([this]()
+		{
+			return m_active.load(std::memory_order_acquire) <= 0;
+		});
+	}
+
+	bool ThreadPool::RunPending()
+	{
+		Job *job = FindJob();
+
+		if (job == nullptr)
+		{
+			return false;
+		}
+
+		Execute(job);
+		return true;
+	}
+
+	int32_t ThreadPool::GetWorkerIndex() const
+	{
+		return CURRENT_POOL == this ? CURRENT_INDEX : -1;
+	}
+
+	void ThreadPool::WorkerLoop(const uint32_t &index)
+	{
+		CURRENT_POOL = this;
+		CURRENT_INDEX = static_cast<int32_t>(index);
+
+		while (!m_destroying)
+		{
+			Job *job = FindJob();
+
+			if (job != nullptr)
+			{
+				Execute(job);
+				continue;
+			}
+
+			// Pushes raise the count while holding the lock, so one can not land between this check and the sleep.
+			std::unique_lock<std::mutex> lock(m_sleepMutex);
+			m_condition.wait(lock, [this]()
+			{
+				return m_queued.load(std::memory_order_acquire) > 0 || m_destroying;
+			});
+		}
+	}
+
+	void ThreadPool::Push(Job *job)
+	{
+		m_active.fetch_add(1, std::memory_order_relaxed);
+
+		int32_t index = GetWorkerIndex();
+
+		if (index == -1 || !m_queues[index]->Push(job))
+		{
+			std::lock_guard<std::mutex> lock(m_injectedMutex);
+			m_injected.emplace_back(job);
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_sleepMutex);
+			m_queued.fetch_add(1, std::memory_order_release);
+		}
+
+		// Waiting threads help with queued jobs too, so they are woken along with a worker.
+		if (m_waiting.load() > 0)
+		{
+			m_condition.notify_all();
+		}
+		else
+		{
+			m_condition.notify_one();
+		}
+	}
+
+	Job *ThreadPool::FindJob()
+	{
+		int32_t index = GetWorkerIndex();
+
+		if (index != -1)
+		{
+			if (auto job = m_queues[index]->Pop(); job)
+			{
+				return *job;
+			}
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_injectedMutex);
+
+			if (!m_injected.empty())
+			{
+				Job *job = m_injected.front();
+				m_injected.pop_front();
+				return job;
+			}
+		}
+
+		auto queueCount = static_cast<int32_t>(m_queues.size());
+
+		for (int32_t i = 1; i <= queueCount; i++)
+		{
+			int32_t victim = (index + i) % queueCount;
+
+			if (victim == index)
+			{
+				continue;
+			}
+
+			if (auto job = m_queues[victim]->Steal(); job)
+			{
+				return *job;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void ThreadPool::Execute(Job *job)
+	{
+		m_queued.fetch_sub(1, std::memory_order_relaxed);
+
+		if (job->m_function)
+		{
+			job->m_function();
+		}
+
+		Finish(job);
+		m_active.fetch_sub(1);
+
+		// Pairs with the fence in WaitUntil, either the waiter sees the job finished or this sees the waiter.
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		if (m_waiting.load() > 0)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_sleepMutex);
+			}
+
+			m_condition.notify_all();
+		}
+	}
+
+	void ThreadPool::Finish(Job *job)
+	{
+		if (job->m_unfinished.fetch_sub(1, std::memory_order_acq_rel) != 1)
+		{
+			return;
+		}
+
+		// Holds the job until its continuations and parent have been released.
+		auto keepAlive = std::move(job->m_keepAlive);
+		auto parent = std::move(job->m_parent);
+		std::vector<std::shared_ptr<Job>> continuations;
+
+		{
+			std::lock_guard<std::mutex> lock(job->m_continuationMutex);
+			job->m_completed = true;
+			continuations.swap(job->m_continuations);
+		}
+
+		for (auto &continuation : continuations)
+		{
+			ReleaseDependency(continuation.get());
+		}
+
+		if (parent != nullptr)
+		{
+			Finish(parent.get());
+		}
+	}
+
+	template<typename Predicate>
+	void ThreadPool::WaitUntil(const Predicate &done)
+	{
+		while (!done())
+		{
+			if (Job *other = FindJob(); other != nullptr)
+			{
+				Execute(other);
+				continue;
+			}
+
+			// Sleeps until a job finishes or there is one to help with, jobs finish outside of the lock so it is taken before they notify.
+			m_waiting.fetch_add(1);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			{
+				std::unique_lock<std::mutex> lock(m_sleepMutex);
+				m_condition.wait(lock, [this, &done]()
+				{
+					return done() || m_queued.load(std::memory_order_acquire) > 0;
+				});
+			}
+
+			m_waiting.fetch_sub(1);
+		}
+	}
+
+	void ThreadPool::ReleaseDependency(Job *job)
+	{
+		if (job->m_dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
 		{
-			thread->Wait();
+			Push(job);
 		}
 	}
 }
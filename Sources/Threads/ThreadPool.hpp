@@ -1,33 +1,173 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include "Engine/Exports.hpp"
-#include "Thread.hpp"
+#include "Job.hpp"
+#include "WorkStealingDeque.hpp"
 
 namespace acid
 {
 	/// <summary>
-	/// A pool of threads.
+	/// A work stealing pool of threads. Each worker owns a lock-free deque, jobs pushed from a worker go onto its own deque,
+	/// and idle workers steal from the others. Jobs pushed from threads outside of the pool go into a shared queue.
 	/// </summary>
 	class ACID_EXPORT ThreadPool
 	{
 	private:
-		std::vector<std::unique_ptr<Thread>> m_threads;
+		std::vector<std::thread> m_workers;
+		std::vector<std::unique_ptr<WorkStealingDeque<Job *>>> m_queues;
+
+		std::mutex m_injectedMutex;
+		std::deque<Job *> m_injected;
+
+		/// Held while m_queued is raised and while sleepers check it, so a push can not slip in between a check and the sleep.
+		std::mutex m_sleepMutex;
+		std::condition_variable m_condition;
+
+		std::atomic<int32_t> m_queued;
+		std::atomic<int32_t> m_active;
+		/// Threads sleeping in <seealso cref="#Wait()"/>, they are woken as jobs finish.
+		std::atomic<int32_t> m_waiting;
+		std::atomic<bool> m_destroying;
 	public:
 		static const uint32_t HARDWARE_CONCURRENCY;
 
+		/// <summary>
+		/// Creates a new thread pool.
+		/// </summary>
+		/// <param name="threadCount"> The number of worker threads, with zero workers jobs are only run by waiting threads. </param>
 		explicit ThreadPool(const uint32_t &threadCount = HARDWARE_CONCURRENCY);
 
-		ThreadPool(const ThreadPool&) = delete; 
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
 
 		ThreadPool& operator=(const ThreadPool&) = delete;
 
 		/// <summary>
-		/// Waits until all threads are finished.
+		/// Creates a new job, the job will not start until <seealso cref="#Run"/> is called.
+		/// </summary>
+		/// <param name="function"> The function to run, can be null for a job that only groups children. </param>
+		/// <param name="parent"> The parent job that will not finish until this job has finished. </param>
+		/// <returns> The job handle. </returns>
+		std::shared_ptr<Job> CreateJob(std::function<void()> function, const std::shared_ptr<Job> &parent = nullptr);
+
+		/// <summary>
+		/// Makes a job wait for another job to finish before starting, must be called before the job is ran.
+		/// </summary>
+		/// <param name="job"> The job that will wait. </param>
+		/// <param name="dependency"> The job that must finish first. </param>
+		void AddDependency(const std::shared_ptr<Job> &job, const std::shared_ptr<Job> &dependency);
+
+		/// <summary>
+		/// Submits a job, it will be queued once all of its dependencies have finished.
+		/// </summary>
+		/// <param name="job"> The job to run. </param>
+		void Run(const std::shared_ptr<Job> &job);
+
+		/// <summary>
+		/// Creates and submits a job.
+		/// </summary>
+		/// <param name="function"> The function to run. </param>
+		/// <param name="parent"> The parent job that will not finish until this job has finished. </param>
+		/// <returns> The job handle. </returns>
+		std::shared_ptr<Job> Schedule(std::function<void()> function, const std::shared_ptr<Job> &parent = nullptr);
+
+		/// <summary>
+		/// Runs other jobs on the calling thread until a job has finished, sleeping while there is nothing to help with.
+		/// </summary>
+		/// <param name="job"> The job to wait for. </param>
+		void Wait(const std::shared_ptr<Job> &job);
+
+		/// <summary>
+		/// Runs jobs on the calling thread until all queued jobs have finished, sleeping while there is nothing to help with.
 		/// </summary>
 		void Wait();
 
-		std::vector<std::unique_ptr<Thread>> &GetThreads() { return m_threads; }
+		/// <summary>
+		/// Runs one queued job on the calling thread, used to help the pool while waiting on something other than a job.
+		/// </summary>
+		/// <returns> If a job was found and ran. </returns>
+		bool RunPending();
+
+		/// <summary>
+		/// Calls a function for every index in a range, split into chunks over the pool. The calling thread helps and returns once every index is done.
+		/// </summary>
+		/// <param name="begin"> The first index. </param>
+		/// <param name="end"> One past the last index. </param>
+		/// <param name="function"> The function to call with each index. </param>
+		/// <param name="grainSize"> The number of indices per job, zero picks a size from the thread count. </param>
+		template<typename Function>
+		void ParallelFor(const uint32_t &begin, const uint32_t &end, const Function &function, const uint32_t &grainSize = 0)
+		{
+			if (end <= begin)
+			{
+				return;
+			}
+
+			uint32_t count = end - begin;
+			uint32_t grain = grainSize != 0 ? grainSize : std::max(count / (4 * (GetThreadCount() + 1)), 1u);
+
+			if (count <= grain)
+			{
+				for (uint32_t i = begin; i < end; i++)
+				{
+					function(i);
+				}
+
+				return;
+			}
+
+			auto root = CreateJob(nullptr);
+
+			for (uint32_t first = begin; first < end; first += std::min(grain, end - first))
+			{
+				uint32_t last = first + std::min(grain, end - first);
+				Schedule([&function, first, last]()
+				{
+					for (uint32_t i = first; i < last; i++)
+					{
+						function(i);
+					}
+				}, root);
+			}
+
+			Run(root);
+			Wait(root);
+		}
+
+		/// <summary>
+		/// Gets the number of worker threads.
+		/// </summary>
+		/// <returns> The worker count. </returns>
+		uint32_t GetThreadCount() const { return static_cast<uint32_t>(m_workers.size()); }
+
+		/// <summary>
+		/// Gets the index of the worker calling this function.
+		/// </summary>
+		/// <returns> The worker index, or -1 if called from a thread outside of this pool. </returns>
+		int32_t GetWorkerIndex() const;
+	private:
+		void WorkerLoop(const uint32_t &index);
+
+		void Push(Job *job);
+
+		Job *FindJob();
+
+		void Execute(Job *job);
+
+		void Finish(Job *job);
+
+		void ReleaseDependency(Job *job);
+
+		template<typename Predicate>
+		void WaitUntil(const Predicate &done);
 	};
 }
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+namespace acid
+{
+	/// <summary>
+	/// A fixed capacity lock-free Chase-Lev deque. Only the owning thread may push and pop from the bottom,
+	/// any thread may steal from the top.
+	/// </summary>
+	/// <param name="T"> The stored type, must be trivially copyable (usually a pointer). </param>
+	template<typename T>
+	class WorkStealingDeque
+	{
+	private:
+		int64_t m_mask;
+		std::unique_ptr<std::atomic<T>[]> m_buffer;
+		alignas(64) std::atomic<int64_t> m_top;
+		alignas(64) std::atomic<int64_t> m_bottom;
+	public:
+		/// <summary>
+		/// Creates a new work stealing deque.
+		/// </summary>
+		/// <param name="capacity"> The maximum number of items, must be a power of two. </param>
+		explicit WorkStealingDeque(const uint32_t &capacity = 4096) :
+			m_mask(static_cast<int64_t>(capacity) - 1),
+			m_buffer(std::make_unique<std::atomic<T>[]>(capacity)),
+			m_top(0),
+			m_bottom(0)
+		{
+		}
+
+		WorkStealingDeque(const WorkStealingDeque&) = delete;
+
+		WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+		/// <summary>
+		/// Pushes a item onto the bottom of the deque, can only be called by the owning thread.
+		/// </summary>
+		/// <param name="item"> The item to push. </param>
+		/// <returns> If the item was pushed, false if the deque is full. </returns>
+		bool Push(const T &item)
+		{
+			int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+			int64_t top = m_top.load(std::memory_order_acquire);
+
+			if (bottom - top > m_mask)
+			{
+				return false;
+			}
+
+			m_buffer[bottom & m_mask].store(item, std::memory_order_release);
+			std::atomic_thread_fence(std::memory_order_release);
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+			return true;
+		}
+
+		/// <summary>
+		/// Pops the most recently pushed item from the bottom, can only be called by the owning thread.
+		/// </summary>
+		/// <returns> The popped item, empty if the deque is empty or the last item was stolen. </returns>
+		std::optional<T> Pop()
+		{
+			int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+			m_bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t top = m_top.load(std::memory_order_relaxed);
+
+			if (top > bottom)
+			{
+				m_bottom.store(bottom + 1, std::memory_order_relaxed);
+				return {};
+			}
+
+			T item = m_buffer[bottom & m_mask].load(std::memory_order_relaxed);
+
+			if (top != bottom)
+			{
+				return item;
+			}
+
+			// Last item, race against stealers.
+			bool won = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+			if (!won)
+			{
+				return {};
+			}
+
+			return item;
+		}
+
+		/// <summary>
+		/// Steals the oldest item from the top, can be called from any thread.
+		/// </summary>
+		/// <returns> The stolen item, empty if the deque is empty or the steal lost a race. </returns>
+		std::optional<T> Steal()
+		{
+			int64_t top = m_top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+			if (top >= bottom)
+			{
+				return {};
+			}
+
+			T item = m_buffer[top & m_mask].load(std::memory_order_acquire);
+
+			if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				return {};
+			}
+
+			return item;
+		}
+
+		/// <summary>
+		/// Gets a approximate count of items in the deque.
+		/// </summary>
+		/// <returns> The approximate item count. </returns>
+		int64_t GetSize() const
+		{
+			int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+			int64_t top = m_top.load(std::memory_order_relaxed);
+			return bottom >= top ? bottom - top : 0;
+		}
+	};
+}
@@ -0,0 +1,86 @@
+#include <iostream>
+#include <vector>
+#include <Engine/Log.hpp>
+#include <Files/Binary/FileBinary.hpp>
+
+using namespace acid;
+
+static bool CompareMetadata(const Metadata &a, const Metadata &b)
+{
+	if (a.GetName() != b.GetName() || a.GetValue() != b.GetValue() || a.GetAttributes() != b.GetAttributes() || a.GetChildCount() != b.GetChildCount())
+	{
+		Log::Error("  '%s' = '%s' read back as '%s' = '%s'\n", a.GetName().c_str(), a.GetValue().c_str(), b.GetName().c_str(), b.GetValue().c_str());
+		return false;
+	}
+
+	for (uint32_t i = 0; i < a.GetChildCount(); i++)
+	{
+		if (!CompareMetadata(*a.GetChildren()[i], *b.GetChildren()[i]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+int main(int argc, char **argv)
+{
+	{
+		Log::Out("Binary Metadata:\n");
+		Metadata original = Metadata("root", "");
+		auto transform = original.AddChild(new Metadata("transform", "", { { "type", "Transform" } }));
+		transform->AddChild(new Metadata("x", "-12"));
+		transform->AddChild(new Metadata("y", "0.500000"));
+		transform->AddChild(new Metadata("z", "1.25"));
+		transform->AddChild(new Metadata("count", "007"));
+		transform->AddChild(new Metadata("name", "\"Player One\""));
+		transform->AddChild(new Metadata("tag", "\"42\""));
+		transform->AddChild(new Metadata("path", "Objects/Player"));
+		transform->AddChild(new Metadata("visible", "true"));
+		transform->AddChild(new Metadata("empty", ""));
+
+		std::vector<char> data;
+		FileBinary::Write(original, data);
+
+		std::vector<std::string_view> keys;
+		BinaryNode root = BinaryNode::ReadDocument(data.data(), data.size(), keys);
+		Metadata restored = Metadata();
+
+		if (root.IsValid())
+		{
+			root.ToMetadata(restored);
+		}
+
+		if (!root.IsValid() || !CompareMetadata(original, restored))
+		{
+			Log::Error("  Metadata did not round trip through the binary format\n");
+		}
+
+		// Typed reads give what the text reads on the metadata tree give.
+		auto node = root.FindChild("transform");
+		auto mismatches = 0;
+		mismatches += node.FindChild("x").Get<std::string>() != transform->FindChild("x")->Get<std::string>();
+		mismatches += node.FindChild("y").Get<std::string>() != transform->FindChild("y")->Get<std::string>();
+		mismatches += node.FindChild("visible").Get<std::string>() != transform->FindChild("visible")->Get<std::string>();
+		mismatches += node.FindChild("name").Get<std::string>() != transform->FindChild("name")->Get<std::string>();
+		mismatches += node.FindChild("x").Get<int32_t>() != transform->FindChild("x")->Get<int32_t>();
+		mismatches += node.FindChild("z").Get<float>() != transform->FindChild("z")->Get<float>();
+		mismatches += node.FindChild("count").Get<int32_t>() != transform->FindChild("count")->Get<int32_t>();
+		mismatches += node.FindChild("tag").Get<int32_t>() != 42;
+		mismatches += node.FindChild("visible").Get<bool>() != transform->FindChild("visible")->Get<bool>();
+
+		if (mismatches != 0)
+		{
+			Log::Error("  %i typed reads disagreed with the metadata tree\n", mismatches);
+		}
+
+		Log::Out("  %i bytes, %i keys\n", static_cast<int>(data.size()), static_cast<int>(keys.size()));
+		Log::Out("\n");
+	}
+
+	// Pauses the console.
+	std::cout << "Press enter to continue...";
+	std::cin.get();
+	return EXIT_SUCCESS;
+}
@@ -1,4 +1,9 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <iostream>
+#include <random>
+#include <vector>
 #include <Engine/Log.hpp>
 #include <Maths/Maths.hpp>
 #include <Maths/Time.hpp>
@@ -10,6 +15,7 @@
 #include <Maths/Vector2.hpp>
 #include <Maths/Vector3.hpp>
 #include <Maths/Vector4.hpp>
+#include <Physics/Frustum.hpp>
 
 using namespace acid;
 
@@ -82,6 +88,130 @@ int main(int argc, char **argv)
 		Log::Out("  %s dist %s = %f\n", a.ToString().c_str(), b.ToString().c_str(), a.Distance(b));
 		Log::Out("\n");
 	}
+	{
+		Log::Out("Frustum Culling:\n");
+		Frustum frustum = Frustum();
+		frustum.Update(Matrix4::ViewMatrix(Vector3(), Vector3()), Matrix4::PerspectiveMatrix(Maths::Radians(70.0f), 16.0f / 9.0f, 0.1f, 500.0f));
+
+		const uint32_t count = 100000;
+		std::mt19937 generator(1337);
+		std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+		std::uniform_real_distribution<float> size(0.1f, 4.0f);
+		auto x = std::vector<float>(count);
+		auto y = std::vector<float>(count);
+		auto z = std::vector<float>(count);
+		auto radius = std::vector<float>(count);
+		auto visible = std::vector<uint32_t>(count);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			x[i] = position(generator);
+			y[i] = position(generator);
+			z[i] = position(generator);
+			radius[i] = size(generator);
+		}
+
+		auto scalarFlags = std::vector<uint8_t>(count);
+		auto batchFlags = std::vector<uint8_t>(count);
+
+		// The batched paths round differently than the scalar tests, so only results that flip when the bounds are nudged by a small tolerance may differ.
+		auto tolerance = [](const float &value)
+		{
+			return 1.0e-4f * (1.0f + std::abs(value));
+		};
+
+		auto start = std::chrono::high_resolution_clock::now();
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			scalarFlags[i] = frustum.SphereInFrustum(Vector3(x[i], y[i], z[i]), radius[i]);
+		}
+
+		auto scalarTime = std::chrono::duration<float, std::micro>(std::chrono::high_resolution_clock::now() - start).count();
+		start = std::chrono::high_resolution_clock::now();
+		uint32_t batchVisible = frustum.CullSpheres(x.data(), y.data(), z.data(), radius.data(), count, visible.data());
+		auto batchTime = std::chrono::duration<float, std::micro>(std::chrono::high_resolution_clock::now() - start).count();
+
+		Log::Out("  %i spheres, %i visible: scalar %fus, batch %fus\n", count, batchVisible, scalarTime, batchTime);
+
+		std::fill(batchFlags.begin(), batchFlags.end(), 0);
+
+		for (uint32_t i = 0; i < batchVisible; i++)
+		{
+			batchFlags[visible[i]] = 1;
+		}
+
+		uint32_t mismatches = 0;
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			if (scalarFlags[i] == batchFlags[i])
+			{
+				continue;
+			}
+
+			Vector3 centre = Vector3(x[i], y[i], z[i]);
+			float slack = tolerance(centre.Length() + radius[i]);
+
+			if (frustum.SphereInFrustum(centre, radius[i] + slack) == frustum.SphereInFrustum(centre, radius[i] - slack))
+			{
+				mismatches++;
+			}
+		}
+
+		if (mismatches != 0)
+		{
+			Log::Error("  Batch sphere culling disagreed with the scalar test on %i spheres\n", mismatches);
+		}
+
+		start = std::chrono::high_resolution_clock::now();
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			Vector3 extent = Vector3(radius[i], radius[i], radius[i]);
+			scalarFlags[i] = frustum.CubeInFrustum(Vector3(x[i], y[i], z[i]) - extent, Vector3(x[i], y[i], z[i]) + extent);
+		}
+
+		scalarTime = std::chrono::duration<float, std::micro>(std::chrono::high_resolution_clock::now() - start).count();
+		start = std::chrono::high_resolution_clock::now();
+		batchVisible = frustum.CullBoxes(x.data(), y.data(), z.data(), radius.data(), radius.data(), radius.data(), count, visible.data());
+		batchTime = std::chrono::duration<float, std::micro>(std::chrono::high_resolution_clock::now() - start).count();
+		Log::Out("  %i boxes, %i visible: scalar %fus, batch %fus\n", count, batchVisible, scalarTime, batchTime);
+
+		std::fill(batchFlags.begin(), batchFlags.end(), 0);
+
+		for (uint32_t i = 0; i < batchVisible; i++)
+		{
+			batchFlags[visible[i]] = 1;
+		}
+
+		mismatches = 0;
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			if (scalarFlags[i] == batchFlags[i])
+			{
+				continue;
+			}
+
+			Vector3 centre = Vector3(x[i], y[i], z[i]);
+			float slack = tolerance(centre.Length() + radius[i]);
+			Vector3 larger = Vector3(radius[i] + slack, radius[i] + slack, radius[i] + slack);
+			Vector3 smaller = Vector3(radius[i] - slack, radius[i] - slack, radius[i] - slack);
+
+			if (frustum.CubeInFrustum(centre - larger, centre + larger) == frustum.CubeInFrustum(centre - smaller, centre + smaller))
+			{
+				mismatches++;
+			}
+		}
+
+		if (mismatches != 0)
+		{
+			Log::Error("  Batch box culling disagreed with the scalar test on %i boxes\n", mismatches);
+		}
+
+		Log::Out("\n");
+	}
 
 	// Pauses the console.
 	std::cout << "Press enter to continue...";
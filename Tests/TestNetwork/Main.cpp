@@ -1,9 +1,20 @@
+#include <chrono>
+#include <cstring>
 #include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#if defined(ACID_BUILD_LINUX)
+#include <sys/resource.h>
+#endif
 #include <Engine/Log.hpp>
 #include <Network/Ftp/Ftp.hpp>
 #include <Network/Http/Http.hpp>
+#include <Network/Tcp/TcpListener.hpp>
+#include <Network/Tcp/TcpSocket.hpp>
 #include <Network/Udp/UdpSocket.hpp>
 #include <Network/Packet.hpp>
+#include <Network/SocketReactor.hpp>
 
 using namespace acid;
 
@@ -66,6 +77,247 @@ int main(int argc, char **argv)
 		// error...
 	}*/
 
+	// Drives many loopback connections through a reactor, every client sends a message that the server echoes back.
+	{
+		uint32_t connectionCount = 4000;
+
+#if defined(ACID_BUILD_LINUX)
+		// Each connection uses two handles, one for each end.
+		rlimit limit = {};
+		getrlimit(RLIMIT_NOFILE, &limit);
+		limit.rlim_cur = limit.rlim_max;
+		setrlimit(RLIMIT_NOFILE, &limit);
+		getrlimit(RLIMIT_NOFILE, &limit);
+		connectionCount = static_cast<uint32_t>(std::min<rlim_t>(connectionCount, (limit.rlim_cur - 64) / 2));
+#endif
+
+		SocketReactor reactor = SocketReactor();
+		TcpListener listener = TcpListener();
+		std::vector<std::unique_ptr<TcpSocket>> servers = std::vector<std::unique_ptr<TcpSocket>>();
+		std::vector<std::unique_ptr<TcpSocket>> clients = std::vector<std::unique_ptr<TcpSocket>>();
+		uint32_t echoed = 0;
+
+		auto echo = [&reactor](Socket &socket, const uint32_t &events)
+		{
+			auto &tcpSocket = static_cast<TcpSocket &>(socket);
+			char buffer[64];
+			std::size_t received = 0;
+			SocketStatus status;
+
+			while ((status = tcpSocket.Receive(buffer, sizeof(buffer), received)) == SOCKET_STATUS_DONE)
+			{
+				std::size_t sent = 0;
+				tcpSocket.Send(buffer, received, sent);
+			}
+
+			if (status == SOCKET_STATUS_DISCONNECTED || status == SOCKET_STATUS_ERROR)
+			{
+				reactor.Remove(socket);
+			}
+		};
+
+		auto receive = [&echoed](Socket &socket, const uint32_t &events)
+		{
+			auto &tcpSocket = static_cast<TcpSocket &>(socket);
+			char buffer[64];
+			std::size_t received = 0;
+
+			while (tcpSocket.Receive(buffer, sizeof(buffer), received) == SOCKET_STATUS_DONE)
+			{
+				echoed += static_cast<uint32_t>(received);
+			}
+		};
+
+		if (listener.Listen(0, IpAddress::LOCAL_HOST) != SOCKET_STATUS_DONE)
+		{
+			Log::Error("Reactor benchmark could not listen on the loopback\n");
+		}
+
+		reactor.Add(listener, SOCKET_EVENT_READ, [&](Socket &socket, const uint32_t &events)
+		{
+			while (true)
+			{
+				auto server = std::make_unique<TcpSocket>();
+
+				if (listener.Accept(*server) != SOCKET_STATUS_DONE)
+				{
+					break;
+				}
+
+				reactor.Add(*server, SOCKET_EVENT_READ, echo);
+				servers.emplace_back(std::move(server));
+			}
+		});
+
+		auto connectStart = std::chrono::high_resolution_clock::now();
+
+		for (uint32_t i = 0; i < connectionCount; i++)
+		{
+			auto client = std::make_unique<TcpSocket>();
+
+			if (client->Connect(IpAddress::LOCAL_HOST, listener.GetLocalPort()) != SOCKET_STATUS_DONE)
+			{
+				Log::Error("Reactor benchmark failed to connect client %i\n", i);
+				break;
+			}
+
+			reactor.Add(*client, SOCKET_EVENT_READ, receive);
+			clients.emplace_back(std::move(client));
+
+			// Accepts in batches so the listen backlog never fills.
+			if (i % 64 == 63)
+			{
+				reactor.Poll(Time::Milliseconds(1));
+			}
+		}
+
+		while (servers.size() < clients.size() && reactor.Poll(Time::Milliseconds(100)) > 0)
+		{
+		}
+
+		auto echoStart = std::chrono::high_resolution_clock::now();
+
+		for (auto &client : clients)
+		{
+			std::size_t sent = 0;
+			client->Send("ping", 4, sent);
+		}
+
+		uint32_t wakeups = 0;
+
+		while (echoed < 4 * clients.size() && reactor.Poll(Time::Seconds(1.0f)) > 0)
+		{
+			wakeups++;
+		}
+
+		auto echoEnd = std::chrono::high_resolution_clock::now();
+
+		Log::Out("Reactor: %i connections accepted in %fms\n", static_cast<uint32_t>(servers.size()), std::chrono::duration<float, std::milli>(echoStart - connectStart).count());
+		Log::Out("Reactor: %i echoes in %fms over %i polls\n", echoed / 4, std::chrono::duration<float, std::milli>(echoEnd - echoStart).count(), wakeups);
+
+		if (echoed != 4 * clients.size())
+		{
+			Log::Error("Reactor benchmark lost echoes, %i of %i bytes arrived\n", echoed, static_cast<uint32_t>(4 * clients.size()));
+		}
+
+		reactor.Clear();
+	}
+
+	// Round trips datagrams over the loopback, once through the batched functions and once segmented with a short final datagram.
+	{
+		UdpSocket sender = UdpSocket();
+		UdpSocket receiver = UdpSocket();
+
+		if (sender.Bind(0, IpAddress::LOCAL_HOST) != SOCKET_STATUS_DONE || receiver.Bind(0, IpAddress::LOCAL_HOST) != SOCKET_STATUS_DONE)
+		{
+			Log::Error("Datagram round trip could not bind on the loopback\n");
+		}
+
+		receiver.SetBlocking(false);
+
+		const std::size_t datagramCount = 48;
+		const std::size_t datagramSize = 1000;
+		std::vector<char> payload(datagramCount * datagramSize);
+
+		for (std::size_t i = 0; i < payload.size(); i++)
+		{
+			payload[i] = static_cast<char>(i * 7 + i / datagramSize);
+		}
+
+		std::vector<char> buffer(datagramCount * 2048);
+		std::vector<UdpDatagram> datagrams(datagramCount);
+
+		// Receives until the expected number of datagrams arrived or a second passed.
+		auto receiveAll = [&](const std::size_t &expected)
+		{
+			for (std::size_t i = 0; i < datagramCount; i++)
+			{
+				datagrams[i].data = &buffer[i * 2048];
+				datagrams[i].size = 2048;
+				datagrams[i].received = 0;
+			}
+
+			std::size_t total = 0;
+			auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+
+			while (total < expected && std::chrono::steady_clock::now() < deadline)
+			{
+				std::size_t received = 0;
+
+				if (receiver.Receive(&datagrams[total], expected - total, received) == SOCKET_STATUS_DONE)
+				{
+					total += received;
+				}
+				else
+				{
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}
+			}
+
+			return total;
+		};
+
+		// Checks the received datagram holds the payload from the offset.
+		auto matches = [&](const std::size_t &index, const std::size_t &offset, const std::size_t &size)
+		{
+			auto &datagram = datagrams[index];
+			return datagram.received == size && datagram.remotePort == sender.GetLocalPort() &&
+				std::memcmp(datagram.data, &payload[offset], size) == 0;
+		};
+
+		std::vector<UdpDatagram> outgoing(datagramCount);
+
+		for (std::size_t i = 0; i < datagramCount; i++)
+		{
+			outgoing[i].data = &payload[i * datagramSize];
+			outgoing[i].size = datagramSize;
+			outgoing[i].remoteAddress = IpAddress::LOCAL_HOST;
+			outgoing[i].remotePort = receiver.GetLocalPort();
+		}
+
+		std::size_t sent = 0;
+
+		if (sender.Send(outgoing.data(), outgoing.size(), sent) != SOCKET_STATUS_DONE || sent != datagramCount)
+		{
+			Log::Error("Batched send only sent %i of %i datagrams\n", static_cast<uint32_t>(sent), static_cast<uint32_t>(datagramCount));
+		}
+
+		std::size_t received = receiveAll(datagramCount);
+		bool batchedOk = received == datagramCount;
+
+		for (std::size_t i = 0; batchedOk && i < received; i++)
+		{
+			batchedOk = matches(i, i * datagramSize, datagramSize);
+		}
+
+		Log::Out("Udp batched: %i of %i datagrams round tripped %s\n", static_cast<uint32_t>(received), static_cast<uint32_t>(datagramCount), batchedOk ? "intact" : "CORRUPTED");
+
+		// Leaves the last datagram short so the kernel has to end the run with a smaller segment.
+		const std::size_t segmentedSize = payload.size() - datagramSize / 3;
+
+		if (sender.SendSegmented(payload.data(), segmentedSize, datagramSize, IpAddress::LOCAL_HOST, receiver.GetLocalPort(), sent) != SOCKET_STATUS_DONE ||
+			sent != segmentedSize)
+		{
+			Log::Error("Segmented send only sent %i of %i bytes\n", static_cast<uint32_t>(sent), static_cast<uint32_t>(segmentedSize));
+		}
+
+		received = receiveAll(datagramCount);
+		bool segmentedOk = received == datagramCount;
+
+		for (std::size_t i = 0; segmentedOk && i < received; i++)
+		{
+			std::size_t offset = i * datagramSize;
+			segmentedOk = matches(i, offset, std::min(datagramSize, segmentedSize - offset));
+		}
+
+		Log::Out("Udp segmented: %i of %i datagrams round tripped %s\n", static_cast<uint32_t>(received), static_cast<uint32_t>(datagramCount), segmentedOk ? "intact" : "CORRUPTED");
+
+		if (!batchedOk || !segmentedOk)
+		{
+			Log::Error("Datagram round trip failed\n");
+		}
+	}
+
 	// Pauses the console.
 	std::cout << "Press enter to continue...";
 	std::cin.get();
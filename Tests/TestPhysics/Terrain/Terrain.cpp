@@ -7,7 +7,7 @@
 namespace test
 {
 	Terrain::Terrain(const float &sideLength, const float &squareSize) :
-		m_noise(Noise(25653345, 0.01f, NOISE_INTERP_QUINTIC, NOISE_TYPE_PERLINFRACTAL, 5, 2.0f, 0.5f, NOISE_FRACTAL_FBM)),
+		m_noise(Noise(25653345, 0.01f, NOISE_INTERP_QUINTIC, NOISE_TYPE_VALUEFRACTAL, 5, 2.0f, 0.5f, NOISE_FRACTAL_FBM)),
 		m_heightmap(std::vector<float>()),
 		m_sideLength(sideLength),
 		m_squareSize(squareSize),
@@ -68,14 +68,16 @@ namespace test
 	{
 		auto transform = GetGameObject()->GetTransform();
 		auto heightmap = std::vector<float>(vertexCount * vertexCount);
+		auto samples = std::vector<float>(vertexCount * vertexCount);
+		m_noise.FillGrid2D(transform.GetPosition().m_x - (m_sideLength / 2.0f), transform.GetPosition().m_z - (m_sideLength / 2.0f), m_squareSize / 2.0f,
+			vertexCount, vertexCount, samples.data());
 
 		for (uint32_t row = 0; row < vertexCount; row++)
 		{
 			for (uint32_t col = 0; col < vertexCount; col++)
 			{
-				float x = ((row * m_squareSize) - m_sideLength) / 2.0f;
-				float z = ((col * m_squareSize) - m_sideLength) / 2.0f;
-				float height = 16.0f * m_noise.GetValueFractal(transform.GetPosition().m_x + x, transform.GetPosition().m_z + z);
+				// Samples are laid out with x along each row, the heightmap has x down its columns.
+				float height = 16.0f * samples[col * vertexCount + row];
 				heightmap[row * vertexCount + col] = height;
 
 				if (height < m_minHeight)
@@ -0,0 +1,252 @@
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <Engine/Log.hpp>
+#include <Objects/GameObject.hpp>
+#include <Scenes/AabbTree.hpp>
+#include <Scenes/SceneTree.hpp>
+
+using namespace acid;
+
+static bool CompareResults(const char *query, std::vector<GameObject *> found, std::vector<GameObject *> expected)
+{
+	std::sort(found.begin(), found.end());
+	std::sort(expected.begin(), expected.end());
+
+	if (found != expected)
+	{
+		Log::Error("  %s query found %i objects, brute force found %i\n", query, static_cast<int32_t>(found.size()), static_cast<int32_t>(expected.size()));
+		return false;
+	}
+
+	return true;
+}
+
+int main(int argc, char **argv)
+{
+	std::mt19937 random(1337);
+	std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+	std::uniform_real_distribution<float> extent(0.1f, 8.0f);
+	std::uniform_real_distribution<float> nudge(-0.5f, 0.5f);
+	std::uniform_real_distribution<float> radius(1.0f, 30.0f);
+	std::uniform_int_distribution<int32_t> operation(0, 9);
+
+	auto randomPoint = [&]()
+	{
+		return Vector3(position(random), position(random), position(random));
+	};
+
+	// The tree never looks into the objects, they only need to be distinct, so they are borrowed from a structure that is otherwise unused.
+	SceneTree owners = SceneTree();
+	std::vector<GameObject *> objects;
+
+	for (uint32_t i = 0; i < 2000; i++)
+	{
+		objects.emplace_back(new GameObject(Transform(), &owners));
+	}
+
+	// Runs random inserts, removes and moves on an AABB tree and checks every query against a brute force test of the live boxes.
+	{
+		Log::Out("AABB Tree:\n");
+
+		struct Entry
+		{
+			int32_t m_proxy;
+			Vector3 m_min;
+			Vector3 m_max;
+		};
+
+		AabbTree tree = AabbTree(1.0f);
+		std::vector<Entry> entries(objects.size(), {AabbTree::NULL_NODE, Vector3(), Vector3()});
+		uint32_t liveCount = 0;
+		uint32_t queries = 0;
+		uint32_t failures = 0;
+		int32_t maxHeight = 0;
+
+		auto bruteForce = [&](const auto &overlaps)
+		{
+			std::vector<GameObject *> result;
+
+			for (std::size_t i = 0; i < entries.size(); i++)
+			{
+				if (entries[i].m_proxy != AabbTree::NULL_NODE && overlaps(entries[i].m_min, entries[i].m_max))
+				{
+					result.emplace_back(objects[i]);
+				}
+			}
+
+			return result;
+		};
+
+		auto check = [&](const char *query, const auto &overlaps)
+		{
+			std::vector<GameObject *> found;
+			tree.Query(overlaps, found);
+			failures += !CompareResults(query, found, bruteForce(overlaps));
+			queries++;
+		};
+
+		for (uint32_t step = 0; step < 50000 && failures == 0; step++)
+		{
+			auto &entry = entries[random() % entries.size()];
+			int32_t op = operation(random);
+
+			if (entry.m_proxy == AabbTree::NULL_NODE)
+			{
+				// Fills up to about three quarters before removes and inserts balance out.
+				if (op < 8)
+				{
+					entry.m_min = randomPoint();
+					entry.m_max = entry.m_min + Vector3(extent(random), extent(random), extent(random));
+					entry.m_proxy = tree.Insert(objects[&entry - entries.data()], entry.m_min, entry.m_max);
+					liveCount++;
+				}
+			}
+			else if (op < 3)
+			{
+				tree.Remove(entry.m_proxy);
+				entry.m_proxy = AabbTree::NULL_NODE;
+				liveCount--;
+			}
+			else
+			{
+				// Small moves mostly stay inside the fattened box, jumps always reinsert the leaf.
+				Vector3 offset = op < 8 ? Vector3(nudge(random), nudge(random), nudge(random)) : randomPoint() - entry.m_min;
+				entry.m_min += offset;
+				entry.m_max += offset;
+				tree.Move(entry.m_proxy, entry.m_min, entry.m_max);
+			}
+
+			maxHeight = std::max(maxHeight, tree.GetHeight());
+
+			if (step % 100 != 0)
+			{
+				continue;
+			}
+
+			Vector3 boxMin = randomPoint();
+			Vector3 boxMax = boxMin + Vector3(radius(random), radius(random), radius(random));
+			check("Box", [&](const Vector3 &min, const Vector3 &max)
+			{
+				return AabbTree::BoxIntersects(min, max, boxMin, boxMax);
+			});
+
+			Vector3 centre = randomPoint();
+			float sphereRadius = radius(random);
+			check("Sphere", [&](const Vector3 &min, const Vector3 &max)
+			{
+				return AabbTree::SphereIntersects(min, max, centre, sphereRadius);
+			});
+
+			// Rays are aimed through the middle of the space so they cross many boxes.
+			Vector3 origin = randomPoint();
+			Vector3 target = Vector3(nudge(random), nudge(random), nudge(random)) * 40.0f;
+			Vector3 direction = (target - origin).Normalize();
+			float distance = origin.Distance(target) * 2.0f;
+			check("Ray", [&](const Vector3 &min, const Vector3 &max)
+			{
+				return AabbTree::RayIntersects(min, max, origin, direction, distance);
+			});
+		}
+
+		// Rotations keep every node within one level of balance, which bounds the height like an AVL tree of the same node count.
+		// Without them the surface area heuristic alone lets the tree grow well past it.
+		auto heightLimit = static_cast<int32_t>(1.44f * std::log2(static_cast<float>(2 * objects.size() + 1)));
+
+		if (maxHeight > heightLimit)
+		{
+			Log::Error("  Tree height reached %i, a balanced tree of %i leaves stays within %i\n", maxHeight, static_cast<int32_t>(objects.size()), heightLimit);
+			failures++;
+		}
+
+		Log::Out("  %i live leaves, %i queries, height %i (max %i)\n", liveCount, queries, tree.GetHeight(), maxHeight);
+
+		if (failures != 0)
+		{
+			Log::Error("  AABB tree checks failed\n");
+		}
+
+		Log::Out("\n");
+	}
+
+	// Adds, moves and removes objects in a scene tree and checks its queries against the brute force scene structure queries it overrides.
+	{
+		Log::Out("Scene Tree:\n");
+		owners.Clear();
+
+		SceneTree scene = SceneTree(2.0f);
+		uint32_t queries = 0;
+		uint32_t failures = 0;
+
+		for (uint32_t i = 0; i < 1000; i++)
+		{
+			new GameObject(Transform(randomPoint()), &scene);
+		}
+
+		for (uint32_t frame = 0; frame < 200 && failures == 0; frame++)
+		{
+			for (auto &object : scene.QueryAll())
+			{
+				int32_t op = operation(random);
+
+				if (op == 0)
+				{
+					object->SetRemoved(true);
+				}
+				else if (op < 6)
+				{
+					object->GetTransform().SetPosition(object->GetTransform().GetPosition() + Vector3(nudge(random), nudge(random), nudge(random)));
+				}
+				else if (op == 6)
+				{
+					object->GetTransform().SetPosition(randomPoint());
+				}
+			}
+
+			// Removed objects are destroyed and moved objects refreshed in the update, new objects are in the tree as soon as they are added.
+			scene.Update();
+
+			while (scene.GetSize() < 1000)
+			{
+				new GameObject(Transform(randomPoint()), &scene);
+			}
+
+			for (uint32_t i = 0; i < 4; i++)
+			{
+				Vector3 boxMin = randomPoint();
+				Vector3 boxMax = boxMin + Vector3(radius(random), radius(random), radius(random));
+				failures += !CompareResults("Box", scene.QueryCube(boxMin, boxMax), scene.SceneStructure::QueryCube(boxMin, boxMax));
+
+				Vector3 centre = randomPoint();
+				float sphereRadius = radius(random);
+				failures += !CompareResults("Sphere", scene.QuerySphere(centre, sphereRadius), scene.SceneStructure::QuerySphere(centre, sphereRadius));
+
+				// Objects are points, so rays are aimed straight at one of them.
+				auto all = scene.QueryAll();
+				Vector3 origin = randomPoint();
+				Vector3 target = all[random() % all.size()]->GetTransform().GetPosition();
+				Vector3 direction = (target - origin).Normalize();
+				float distance = origin.Distance(target) + 1.0f;
+				failures += !CompareResults("Ray", scene.QueryRay(origin, direction, distance), scene.SceneStructure::QueryRay(origin, direction, distance));
+				queries += 3;
+			}
+		}
+
+		Log::Out("  %i objects, %i queries, height %i\n", scene.GetSize(), queries, scene.GetTree().GetHeight());
+
+		if (failures != 0)
+		{
+			Log::Error("  Scene tree checks failed\n");
+		}
+
+		scene.Clear();
+		Log::Out("\n");
+	}
+
+	// Pauses the console.
+	std::cout << "Press enter to continue...";
+	std::cin.get();
+	return EXIT_SUCCESS;
+}
@@ -106,7 +106,9 @@ namespace test
 	void VoxelChunk::Generate()
 	{
 		auto position = GetGameObject()->GetTransform().GetPosition();
-		auto noise = Noise(25653345, 0.01f, NOISE_INTERP_QUINTIC, NOISE_TYPE_PERLINFRACTAL, 5, 2.0f, 0.5f, NOISE_FRACTAL_FBM);
+		auto noise = Noise(25653345, 0.01f, NOISE_INTERP_QUINTIC, NOISE_TYPE_VALUEFRACTAL, 5, 2.0f, 0.5f, NOISE_FRACTAL_FBM);
+		auto heightmap = std::vector<float>(CHUNK_WIDTH * CHUNK_WIDTH);
+		noise.FillGrid2D(position.m_x, position.m_z, VOXEL_SIZE, CHUNK_WIDTH, CHUNK_WIDTH, heightmap.data());
 
 		for (uint32_t x = 0; x < CHUNK_WIDTH; x++)
 		{
@@ -121,7 +123,7 @@ namespace test
 
 					Vector3 blockPosition = (VOXEL_SIZE * Vector3(x, y, z)) + position;
 
-					int height = (int) std::floor(40.0f * noise.GetValueFractal(blockPosition.m_x, blockPosition.m_z));
+					int height = (int) std::floor(40.0f * heightmap[z * CHUNK_WIDTH + x]);
 
 					if (blockPosition.m_y > height)
 					{
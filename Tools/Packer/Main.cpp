@@ -0,0 +1,50 @@
+#include <cstring>
+#include <Engine/Log.hpp>
+#include <Files/Pack/FilePack.hpp>
+
+using namespace acid;
+
+int main(int argc, char **argv)
+{
+	bool compress = true;
+	const char *directory = nullptr;
+	const char *output = nullptr;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (std::strcmp(argv[i], "--store") == 0)
+		{
+			compress = false;
+		}
+		else if (directory == nullptr)
+		{
+			directory = argv[i];
+		}
+		else if (output == nullptr)
+		{
+			output = argv[i];
+		}
+	}
+
+	if (directory == nullptr || output == nullptr)
+	{
+		Log::Out("Usage: Packer <directory> <output.pack> [--store]\n");
+		Log::Out("Packs every file under a directory, --store writes files without compressing them.\n");
+		return 1;
+	}
+
+	if (!FilePack::Write(output, directory, compress))
+	{
+		return 1;
+	}
+
+	FilePack pack = FilePack(output);
+
+	if (!pack.IsValid())
+	{
+		return 1;
+	}
+
+	Log::Out("Packed %i files into '%s'\n", pack.GetFileCount(), output);
+	return 0;
+}